@@ -0,0 +1,249 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryServerExample.cpp
+ *
+ */
+
+#include "HelloWorldPubSubTypes.h"
+
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/attributes/ParticipantAttributes.h>
+#include <fastrtps/publisher/Publisher.h>
+#include <fastrtps/publisher/PublisherListener.h>
+#include <fastrtps/attributes/PublisherAttributes.h>
+#include <fastrtps/subscriber/Subscriber.h>
+#include <fastrtps/subscriber/SubscriberListener.h>
+#include <fastrtps/subscriber/SampleInfo.h>
+#include <fastrtps/attributes/SubscriberAttributes.h>
+#include <fastrtps/Domain.h>
+
+#include <fastrtps/utils/IPLocator.h>
+#include <fastrtps/utils/eClock.h>
+#include <fastrtps/log/Log.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+class PubListener : public PublisherListener
+{
+    public:
+        PubListener() : n_matched(0) {}
+
+        void onPublicationMatched(Publisher* /*pub*/, MatchingInfo& info) override
+        {
+            if(info.status == MATCHED_MATCHING)
+            {
+                n_matched++;
+                std::cout << "Publisher matched" << std::endl;
+            }
+            else
+            {
+                n_matched--;
+                std::cout << "Publisher unmatched" << std::endl;
+            }
+        }
+
+        int n_matched;
+};
+
+class SubListener : public SubscriberListener
+{
+    public:
+        void onSubscriptionMatched(Subscriber* /*sub*/, MatchingInfo& info) override
+        {
+            std::cout << (info.status == MATCHED_MATCHING ? "Subscriber matched" : "Subscriber unmatched") << std::endl;
+        }
+
+        void onNewDataMessage(Subscriber* sub) override
+        {
+            HelloWorld hello;
+            SampleInfo_t info;
+            if(sub->takeNextData((void*)&hello, &info) && info.sampleKind == ALIVE)
+            {
+                std::cout << "Message " << hello.message() << " " << hello.index() << " RECEIVED" << std::endl;
+            }
+        }
+};
+
+/*!
+ * Fills the participant attributes of a discovery server or one of its clients.
+ * Both kinds of participants only use the server locator for the discovery traffic.
+ */
+static void set_discovery_attributes(ParticipantAttributes& PParam, DiscoveryProtocol_t protocol,
+        const std::string& address, uint32_t port)
+{
+    Locator_t server_locator;
+    IPLocator::setIPv4(server_locator, address);
+    server_locator.port = port;
+
+    PParam.rtps.builtin.domainId = 0;
+    PParam.rtps.builtin.discoveryProtocol = protocol;
+    if(protocol == DiscoveryProtocol_t::SERVER)
+    {
+        PParam.rtps.builtin.metatrafficUnicastLocatorList.push_back(server_locator);
+    }
+    else
+    {
+        PParam.rtps.builtin.discoveryServersList.push_back(server_locator);
+    }
+}
+
+static int run_server(const std::string& address, uint32_t port)
+{
+    ParticipantAttributes PParam;
+    set_discovery_attributes(PParam, DiscoveryProtocol_t::SERVER, address, port);
+    PParam.rtps.setName("DiscoveryServer");
+
+    Participant* participant = Domain::createParticipant(PParam);
+    if(participant == nullptr)
+    {
+        std::cout << "Something went wrong while creating the discovery server" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Discovery server listening on " << address << ":" << port <<
+        ". Please press enter to stop it" << std::endl;
+    std::cin.ignore();
+    Domain::removeParticipant(participant);
+    return 0;
+}
+
+static int run_publisher(const std::string& address, uint32_t port, uint32_t samples)
+{
+    ParticipantAttributes PParam;
+    set_discovery_attributes(PParam, DiscoveryProtocol_t::CLIENT, address, port);
+    PParam.rtps.setName("Participant_pub");
+
+    Participant* participant = Domain::createParticipant(PParam);
+    if(participant == nullptr)
+    {
+        std::cout << "Something went wrong while creating the Publisher Participant" << std::endl;
+        return 1;
+    }
+
+    HelloWorldPubSubType type;
+    Domain::registerType(participant, &type);
+
+    PublisherAttributes Wparam;
+    Wparam.topic.topicKind = NO_KEY;
+    Wparam.topic.topicDataType = "HelloWorld";
+    Wparam.topic.topicName = "DiscoveryServerTopic";
+    Wparam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+
+    PubListener listener;
+    Publisher* publisher = Domain::createPublisher(participant, Wparam, &listener);
+    if(publisher == nullptr)
+    {
+        std::cout << "Something went wrong while creating the Publisher" << std::endl;
+        Domain::removeParticipant(participant);
+        return 1;
+    }
+
+    std::cout << "Waiting for subscribers discovered through " << address << ":" << port << std::endl;
+    while(listener.n_matched == 0)
+    {
+        eClock::my_sleep(250);
+    }
+
+    HelloWorld hello;
+    hello.message("HelloWorld");
+    for(uint32_t i = 1; i <= samples; ++i)
+    {
+        hello.index(i);
+        publisher->write((void*)&hello);
+        std::cout << "Message: " << hello.message() << " with index: " << hello.index() << " SENT" << std::endl;
+        eClock::my_sleep(500);
+    }
+
+    Domain::removeParticipant(participant);
+    return 0;
+}
+
+static int run_subscriber(const std::string& address, uint32_t port)
+{
+    ParticipantAttributes PParam;
+    set_discovery_attributes(PParam, DiscoveryProtocol_t::CLIENT, address, port);
+    PParam.rtps.setName("Participant_sub");
+
+    Participant* participant = Domain::createParticipant(PParam);
+    if(participant == nullptr)
+    {
+        std::cout << "Something went wrong while creating the Subscriber Participant" << std::endl;
+        return 1;
+    }
+
+    HelloWorldPubSubType type;
+    Domain::registerType(participant, &type);
+
+    SubscriberAttributes Rparam;
+    Rparam.topic.topicKind = NO_KEY;
+    Rparam.topic.topicDataType = "HelloWorld";
+    Rparam.topic.topicName = "DiscoveryServerTopic";
+    Rparam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+
+    SubListener listener;
+    if(Domain::createSubscriber(participant, Rparam, &listener) == nullptr)
+    {
+        std::cout << "Something went wrong while creating the Subscriber" << std::endl;
+        Domain::removeParticipant(participant);
+        return 1;
+    }
+
+    std::cout << "Subscriber running. Please press enter to stop the Subscriber" << std::endl;
+    std::cin.ignore();
+    Domain::removeParticipant(participant);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    if(argc < 2)
+    {
+        std::cout << "Usage: DiscoveryServerExample server|publisher|subscriber [address] [port] [samples]" << std::endl;
+        return 0;
+    }
+
+    std::string address = argc > 2 ? argv[2] : "127.0.0.1";
+    uint32_t port = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 11811;
+    uint32_t samples = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 10;
+
+    int ret = 0;
+    if(strcmp(argv[1], "server") == 0)
+    {
+        ret = run_server(address, port);
+    }
+    else if(strcmp(argv[1], "publisher") == 0)
+    {
+        ret = run_publisher(address, port, samples);
+    }
+    else if(strcmp(argv[1], "subscriber") == 0)
+    {
+        ret = run_subscriber(address, port);
+    }
+    else
+    {
+        std::cout << "server, publisher OR subscriber argument needed" << std::endl;
+    }
+
+    Domain::stopAll();
+    Log::Reset();
+    return ret;
+}
@@ -80,6 +80,24 @@ class  TopicDataType {
          */
         RTPS_DllAPI virtual bool getKey(void* data, rtps::InstanceHandle_t* ihandle, bool force_md5 = false) = 0;
 
+        /**
+         * Get the key associated with a serialized sample, without deserializing the whole sample.
+         * The default implementation is not able to do it, so the sample has to be deserialized and its key
+         * obtained with getKey.
+         * @param[in] payload Pointer to the payload.
+         * @param[out] ihandle Pointer to the Handle.
+         * @param[in] force_md5 Force the key hash to be the MD5 of the key, like in getKey.
+         * @return True if the key was obtained from the payload.
+         */
+        RTPS_DllAPI virtual bool getKeyFromPayload(rtps::SerializedPayload_t* payload,
+                rtps::InstanceHandle_t* ihandle, bool force_md5 = false)
+        {
+            (void)payload;
+            (void)ihandle;
+            (void)force_md5;
+            return false;
+        }
+
         /**
          * Set topic data type name
          * @param nam Topic data type name
@@ -25,6 +25,7 @@
 #include "../rtps/common/Time_t.h"
 #include "../rtps/attributes/WriterAttributes.h"
 #include <fastrtps/rtps/flowcontrol/ThroughputControllerDescriptor.h>
+#include <fastrtps/rtps/flowcontrol/FlowSchedulingDescriptor.h>
 #include "TopicAttributes.h"
 #include "../qos/WriterQos.h"
 #include "../rtps/attributes/PropertyPolicy.h"
@@ -41,6 +42,7 @@ class PublisherAttributes
 public:
     PublisherAttributes() :
         historyMemoryPolicy(rtps::PREALLOCATED_MEMORY_MODE),
+        sendKeyHash(true),
         m_userDefinedID(-1),
         m_entityID(-1)
     {}
@@ -57,7 +59,9 @@ public:
                (this->unicastLocatorList == b.unicastLocatorList) &&
                (this->multicastLocatorList == b.multicastLocatorList) &&
                (this->remoteLocatorList == b.remoteLocatorList) &&
+               (this->flowScheduling == b.flowScheduling) &&
                (this->historyMemoryPolicy == b.historyMemoryPolicy) &&
+               (this->sendKeyHash == b.sendKeyHash) &&
                (this->properties == b.properties);
     }
 
@@ -75,8 +79,13 @@ public:
     rtps::LocatorList_t remoteLocatorList;
     //!Throughput controller
     rtps::ThroughputControllerDescriptor throughputController;
+    //!Scheduling of this publisher in the throughput controller of its participant
+    rtps::FlowSchedulingDescriptor flowScheduling;
     //!Underlying History memory policy
     rtps::MemoryManagementPolicy_t historyMemoryPolicy;
+    //!Send the key hash of every sample of a keyed topic as inline QoS, so subscribers don't deserialize it to
+    //!get its instance. Default value true.
+    bool sendKeyHash;
     rtps::PropertyPolicy properties;
     ResourceLimitedContainerConfig matched_subscriber_allocation;
 
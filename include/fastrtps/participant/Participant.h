@@ -22,6 +22,7 @@
 
 #include "../rtps/common/Guid.h"
 #include "../rtps/attributes/RTPSParticipantAttributes.h"
+#include "../rtps/common/EntityStatistics.h"
 
 #include <utility>
 
@@ -86,6 +87,13 @@ class RTPS_DllAPI Participant
     bool get_remote_writer_info(const rtps::GUID_t& writerGuid, rtps::WriterProxyData& returnedInfo);
 
     bool get_remote_reader_info(const rtps::GUID_t& readerGuid, rtps::ReaderProxyData& returnedInfo);
+
+    /**
+     * Get a snapshot of the counters of the associated RTPSParticipant.
+     * Counters of its publishers and subscribers are obtained from them.
+     * @return Copy of the counters.
+     */
+    rtps::ParticipantStatistics get_statistics() const;
 };
 
 }
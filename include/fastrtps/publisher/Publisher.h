@@ -25,6 +25,7 @@
 #include "../rtps/common/Guid.h"
 #include "../rtps/common/Time_t.h"
 #include "../attributes/PublisherAttributes.h"
+#include "../rtps/common/EntityStatistics.h"
 
 namespace eprosima {
 namespace fastrtps {
@@ -118,6 +119,12 @@ class RTPS_DllAPI Publisher
      */
     bool updateAttributes(const PublisherAttributes& att);
 
+    /**
+     * Get a snapshot of the counters of the associated RTPSWriter.
+     * @return Copy of the counters.
+     */
+    rtps::WriterStatistics get_statistics() const;
+
     private:
 
     PublisherImpl* mp_impl;
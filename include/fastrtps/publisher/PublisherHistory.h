@@ -73,6 +73,17 @@ class PublisherHistory:public rtps::WriterHistory
                 std::unique_lock<std::recursive_timed_mutex>& lock,
                 std::chrono::time_point<std::chrono::steady_clock> max_blocking_time);
 
+        /**
+         * Make room for a new change when the history is full, following the HistoryQosPolicy.
+         * With KEEP_ALL it waits, until max_blocking_time, for a change to be acknowledged.
+         * @param lock Lock of the writer mutex, already taken.
+         * @param max_blocking_time Maximum time to wait.
+         * @return True if the history is not full anymore.
+         */
+        bool make_room(
+                std::unique_lock<std::recursive_timed_mutex>& lock,
+                std::chrono::time_point<std::chrono::steady_clock> max_blocking_time);
+
         /**
          * Remove all change from the associated history.
          * @param removed Number of elements removed.
@@ -96,6 +107,18 @@ class PublisherHistory:public rtps::WriterHistory
 
         virtual bool remove_change_g(rtps::CacheChange_t* a_change);
 
+        /**
+         * Remove the changes whose lifespan has expired.
+         * @param now Current time.
+         * @param lifespan Lifespan duration of the changes.
+         * @param next_expiration Expiration time of the oldest change remaining in the history.
+         * @return True if there are changes remaining in the history.
+         */
+        bool remove_expired_changes(
+                const rtps::Time_t& now,
+                const rtps::Duration_t& lifespan,
+                rtps::Time_t& next_expiration);
+
     private:
         //!Vector of pointer to the CacheChange_t divided by key.
         t_v_Inst_Caches m_keyedChanges;
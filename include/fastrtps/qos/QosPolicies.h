@@ -23,6 +23,7 @@
 #include <vector>
 #include <fastrtps/rtps/common/Types.h>
 #include <fastrtps/rtps/common/Time_t.h>
+#include <fastrtps/utils/StringMatching.h>
 #include "ParameterTypes.h"
 #include <fastrtps/types/TypeObject.h>
 
@@ -183,8 +184,8 @@ public:
 
 /**
  * Class LatencyBudgetQosPolicy, to indicate the LatencyBudget of the samples.
- * This QosPolicy can be defined and is transmitted to the rest of the network but is not implemented in this version.
- * period: Default value c_TimeZero.
+ * Synchronous publishers use it as the maximum delay to batch samples in the same message.
+ * duration: Default value c_TimeZero.
  */
 class LatencyBudgetQosPolicy : public Parameter_t, public QosPolicy {
     friend class ParameterList;
@@ -576,11 +577,11 @@ public:
      * Appends a name to the list of partition names.
      * @param name Name to append.
      */
-    RTPS_DllAPI inline void push_back(const char* name){ names.push_back(std::string(name)); hasChanged=true; }
+    RTPS_DllAPI void push_back(const char* name);
     /**
      * Clears list of partition names
      */
-    RTPS_DllAPI inline void clear(){ names.clear(); }
+    RTPS_DllAPI void clear();
     /**
      * Returns partition names.
      * @return Vector of partition name strings.
@@ -590,10 +591,25 @@ public:
      * Overrides partition names
      * @param nam Vector of partition name strings.
      */
-    RTPS_DllAPI inline void setNames(std::vector<std::string>& nam){ names = nam; hasChanged=true; }
+    RTPS_DllAPI void setNames(std::vector<std::string>& nam);
+
+    /**
+     * Checks whether two partition policies match, as defined by the DDS specification.
+     * An empty list of names is equivalent to the default partition, which only matches the empty name.
+     * The other names are matched as fnmatch expressions in both directions.
+     * @param other Partition policy of the remote endpoint.
+     * @return True if the policies share a partition.
+     */
+    RTPS_DllAPI bool matches(const PartitionQosPolicy& other) const;
 
 private:
+
+    void add_name(const std::string& name);
+
     std::vector<std::string> names;
+
+    //! Names compiled for matching, kept up to date by the methods changing the names.
+    rtps::StringMatchingIndex compiled_names_;
 };
 
 
@@ -834,8 +850,8 @@ public:
 };
 
 /**
- * Class LifespanQosPolicy, currently unimplemented.
- * This QosPolicy can be defined and is transmitted to the rest of the network but is not implemented in this version.
+ * Class LifespanQosPolicy, to indicate how long a sample is valid since its source timestamp.
+ * Expired samples are removed from the history of the Publisher and the Subscriber.
  * duration: Default value c_TimeInfinite.
  */
 class LifespanQosPolicy : public Parameter_t, public QosPolicy
@@ -905,9 +921,10 @@ public:
 
 
 /**
- * Class TransportPriorityQosPolicy, currently unimplemented.
- * This QosPolicy can be defined and is transmitted to the rest of the network but is not implemented in this version.
- * value: Default value 0.
+ * Class TransportPriorityQosPolicy, to indicate the priority of the traffic sent by a writer.
+ * The value is used as DSCP codepoint (clamped to 63) of the datagrams and TCP connections used by the writer,
+ * and asynchronous writers are serviced in descending order of priority. It can only be set on creation.
+ * value: Default value 0 (no priority).
  */
 class TransportPriorityQosPolicy : public Parameter_t , public QosPolicy
 {
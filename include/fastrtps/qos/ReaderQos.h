@@ -84,7 +84,7 @@ public:
 	GroupDataQosPolicy m_groupData;
 	//!Durability Service Qos, NOT implemented in the library.
 	DurabilityServiceQosPolicy m_durabilityService;
-    //!Lifespan Qos, NOT implemented in the library.
+    //!Lifespan Qos
     LifespanQosPolicy m_lifespan;
     //!Data Representation Qos, NOT implemented in the library.
     DataRepresentationQosPolicy m_dataRepresentation;
@@ -71,7 +71,7 @@ public:
 	LivelinessQosPolicy m_liveliness;
 	//!Reliability Qos, implemented in the library.
 	ReliabilityQosPolicy m_reliability;
-	//!Lifespan Qos, NOT implemented in the library.
+	//!Lifespan Qos
 	LifespanQosPolicy m_lifespan;
 	//!UserData Qos, NOT implemented in the library.
 	UserDataQosPolicy m_userData;
@@ -93,6 +93,8 @@ public:
 	GroupDataQosPolicy m_groupData;
 	//!Publication Mode Qos, implemented in the library.
 	PublishModeQosPolicy m_publishMode;
+	//!Transport Priority Qos, implemented in the library.
+	TransportPriorityQosPolicy m_transportPriority;
 	/**
 	 * Set Qos from another class
 	 * @param qos Reference from a WriterQos object.
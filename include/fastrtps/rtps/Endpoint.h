@@ -83,6 +83,12 @@ class Endpoint
      */
     RTPS_DllAPI inline EndpointAttributes& getAttributes() { return m_att; }
 
+    /**
+     * Get associated attributes
+     * @return Endpoint attributes
+     */
+    RTPS_DllAPI inline const EndpointAttributes& getAttributes() const { return m_att; }
+
 #if HAVE_SECURITY
     bool supports_rtps_protection() { return supports_rtps_protection_; }
 #endif
@@ -40,6 +40,7 @@ class EndpointAttributes
             reliabilityKind(BEST_EFFORT),
             durabilityKind(VOLATILE),
             persistence_guid(),
+            transport_priority(0),
             m_userDefinedID(-1),
             m_entityID(-1)
         {
@@ -73,6 +74,9 @@ class EndpointAttributes
 
         PropertyPolicy properties;
 
+        //! Transport priority used to send the traffic of this endpoint, default value 0 (no priority).
+        int32_t transport_priority;
+
         /**
          * Get the user defined ID
          * @return User defined ID
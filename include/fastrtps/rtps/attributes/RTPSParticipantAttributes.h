@@ -34,6 +34,20 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+/**
+ * Participant discovery mechanism used by the builtin protocols.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+enum class DiscoveryProtocol_t
+{
+    //! Simple Participant Discovery Protocol, announcements are sent to the initial peers (multicast by default).
+    SIMPLE,
+    //! Discovery information is only exchanged with the discovery servers.
+    CLIENT,
+    //! Discovery server, relays the discovery information of its clients.
+    SERVER
+};
+
 /**
  * Class SimpleEDPAttributes, to define the attributes of the Simple Endpoint Discovery Protocol.
  * @ingroup RTPS_ATTRIBUTES_MODULE
@@ -131,6 +145,18 @@ class BuiltinAttributes{
         //! Mutation tries if the port is being used.
         uint32_t mutation_tries;
 
+        /**
+         * Participant discovery mechanism (SIMPLE by default).
+         * Only applies when use_SIMPLE_RTPSParticipantDiscoveryProtocol is true.
+         */
+        DiscoveryProtocol_t discoveryProtocol;
+
+        /**
+         * Metatraffic unicast locators of the discovery servers a CLIENT participant announces itself to.
+         * They must match the metatrafficUnicastLocatorList of the servers.
+         */
+        LocatorList_t discoveryServersList;
+
         BuiltinAttributes()
         {
             use_SIMPLE_RTPSParticipantDiscoveryProtocol = true;
@@ -144,6 +170,7 @@ class BuiltinAttributes{
             readerHistoryMemoryPolicy = MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE;
             writerHistoryMemoryPolicy = MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE;
             mutation_tries = 100u;
+            discoveryProtocol = DiscoveryProtocol_t::SIMPLE;
         }
         virtual ~BuiltinAttributes() {}
 
@@ -163,7 +190,9 @@ class BuiltinAttributes{
                    (this->readerHistoryMemoryPolicy == b.readerHistoryMemoryPolicy) &&
                    (this->writerHistoryMemoryPolicy == b.writerHistoryMemoryPolicy) &&
                    (this->m_staticEndpointXMLFilename == b.m_staticEndpointXMLFilename) &&
-                   (this->mutation_tries == b.mutation_tries);
+                   (this->mutation_tries == b.mutation_tries) &&
+                   (this->discoveryProtocol == b.discoveryProtocol) &&
+                   (this->discoveryServersList == b.discoveryServersList);
         }
 
         /**
@@ -198,6 +227,8 @@ class RTPSParticipantAttributes
             listenSocketBufferSize = 0;
             participantID = -1;
             useBuiltinTransports = true;
+            sharedEventThreads = 0;
+            submessageBatchingWindow = c_TimeZero;
         }
 
         virtual ~RTPSParticipantAttributes() {}
@@ -215,6 +246,8 @@ class RTPSParticipantAttributes
                    (this->participantID == b.participantID) &&
                    (this->throughputController == b.throughputController) &&
                    (this->useBuiltinTransports == b.useBuiltinTransports) &&
+                   (this->sharedEventThreads == b.sharedEventThreads) &&
+                   (this->submessageBatchingWindow == b.submessageBatchingWindow) &&
                    (this->properties == b.properties);
         }
 
@@ -260,6 +293,22 @@ class RTPSParticipantAttributes
         //!Set as false to disable the default UDPv4 implementation.
         bool useBuiltinTransports;
 
+        /*!
+         * @brief Size of the pool of event threads shared by all the participants of the process that use it.
+         * The participant runs its timed events on the least loaded thread of the pool. Zero value indicates
+         * the participant runs its timed events on its own thread.
+         * Default value: 0.
+         */
+        uint32_t sharedEventThreads;
+
+        /*!
+         * @brief Time the HEARTBEAT, ACKNACK, GAP and NACK_FRAG submessages of the endpoints of the participant wait
+         * to be sent along with the ones of other endpoints to the same locator, as one RTPS message.
+         * Zero value indicates each endpoint sends its submessages right away.
+         * Default value: 0.
+         */
+        Duration_t submessageBatchingWindow;
+
         //! Property policies
         PropertyPolicy properties;
 
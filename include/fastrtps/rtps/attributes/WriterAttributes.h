@@ -22,6 +22,7 @@
 #include "../common/Time_t.h"
 #include "../common/Guid.h"
 #include "../flowcontrol/ThroughputControllerDescriptor.h"
+#include "../flowcontrol/FlowSchedulingDescriptor.h"
 #include "EndpointAttributes.h"
 #include "../../utils/collections/ResourceLimitedContainerConfig.hpp"
 
@@ -82,7 +83,9 @@ class  WriterAttributes
     public:
 
         WriterAttributes() : mode(SYNCHRONOUS_WRITER),
-            disableHeartbeatPiggyback(false)
+            disableHeartbeatPiggyback(false),
+            repair_multicast_threshold(2),
+            send_key_hash(false)
         {
             endpoint.endpointKind = WRITER;
             endpoint.durabilityKind = TRANSIENT_LOCAL;
@@ -103,11 +106,25 @@ class  WriterAttributes
         // Throughput controller, always the last one to apply
         ThroughputControllerDescriptor throughputController;
 
+        //! How this writer shares the throughput controller of its participant with the rest of writers.
+        FlowSchedulingDescriptor flowScheduling;
+
         //! Disable the sending of heartbeat piggybacks.
         bool disableHeartbeatPiggyback;
 
+        //! Minimum number of readers requesting the same change for its repair to be sent to their shared
+        //! multicast locator. Repairs requested by fewer readers are sent unicast. 0 means never multicast.
+        uint32_t repair_multicast_threshold;
+
+        //! Send the key hash of the changes of keyed topics as inline QoS, even to readers not expecting it, so
+        //! they get the instance of the change without deserializing it.
+        bool send_key_hash;
+
         //! Define the allocation behaviour for matched-reader-dependent collections.
         ResourceLimitedContainerConfig matched_readers_allocation;
+
+        //! Maximum delay a synchronous writer may add to batch changes in the same message. Default value 0s.
+        Duration_t latency_budget;
 };
 
 /**
@@ -0,0 +1,77 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SerializedParticipantData.h
+ *
+ */
+
+#ifndef _RTPS_BUILTIN_DATA_SERIALIZEDPARTICIPANTDATA_H_
+#define _RTPS_BUILTIN_DATA_SERIALIZEDPARTICIPANTDATA_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "../../common/CDRMessage_t.h"
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ParticipantProxyData;
+
+/**
+ * Serialization of a ParticipantProxyData (without encapsulation), kept until the data is updated.
+ * It is not thread safe.
+ * @ingroup BUILTIN_MODULE
+ */
+class SerializedParticipantData
+{
+    public:
+
+        SerializedParticipantData() = default;
+
+        /**
+         * Discard the kept serialization.
+         * Has to be called every time the participant data is updated.
+         */
+        void invalidate();
+
+        /**
+         * Copy the serialization of the participant data into a message.
+         * The data is only serialized again if it was updated or a different endianness is requested.
+         * @param data Participant data to serialize.
+         * @param endian Endianness of the serialization.
+         * @param msg Message receiving the serialized data. Its buffer is enlarged if needed.
+         * @return false if the data cannot be serialized. The message is left empty.
+         */
+        bool copy_to(
+                ParticipantProxyData& data,
+                Endianness_t endian,
+                CDRMessage_t& msg);
+
+    private:
+
+        SerializedParticipantData(const SerializedParticipantData&) = delete;
+
+        SerializedParticipantData& operator=(const SerializedParticipantData&) = delete;
+
+        //!Kept serialization. Empty when outdated.
+        CDRMessage_t serialized_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* _RTPS_BUILTIN_DATA_SERIALIZEDPARTICIPANTDATA_H_ */
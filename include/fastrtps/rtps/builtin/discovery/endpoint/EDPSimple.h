@@ -22,6 +22,7 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include "EDP.h"
+#include "../../../../utils/fixed_size_string.hpp"
 
 namespace eprosima {
 namespace fastrtps{
@@ -33,8 +34,10 @@ class RTPSWriter;
 class RTPSReader;
 class EDPSimplePUBListener;
 class EDPSimpleSUBListener;
+class EDPRelayFilter;
 class ReaderHistory;
 class WriterHistory;
+struct CacheChange_t;
 
 
 /**
@@ -125,6 +128,37 @@ class EDPSimple : public EDP
      */
     bool removeLocalWriter(RTPSWriter*W) override;
 
+    /**
+     * Relay to the remote participants a publication announcement received from another participant.
+     * Used by discovery servers. Only the participants with readers on its topic receive it.
+     * @param change Announcement received.
+     * @param wdata Information of the announced writer.
+     * @return True if correct.
+     */
+    bool relayPublicationData(const CacheChange_t& change, const WriterProxyData& wdata);
+    /**
+     * Relay to the remote participants a subscription announcement received from another participant.
+     * Used by discovery servers. Only the participants with writers on its topic receive it.
+     * @param change Announcement received.
+     * @param rdata Information of the announced reader.
+     * @return True if correct.
+     */
+    bool relaySubscriptionData(const CacheChange_t& change, const ReaderProxyData& rdata);
+    /**
+     * Relay to the remote participants the disposal of a writer of another participant.
+     * Used by discovery servers.
+     * @param writer_guid GUID of the disposed writer.
+     * @return True if correct.
+     */
+    bool relayPublicationDisposal(const GUID_t& writer_guid);
+    /**
+     * Relay to the remote participants the disposal of a reader of another participant.
+     * Used by discovery servers.
+     * @param reader_guid GUID of the disposed reader.
+     * @return True if correct.
+     */
+    bool relaySubscriptionDisposal(const GUID_t& reader_guid);
+
     private:
 
     /**
@@ -133,6 +167,36 @@ class EDPSimple : public EDP
      */
     bool createSEDPEndpoints();
 
+    /**
+     * Replace the announcement of the same endpoint in a SEDP writer by a copy of the received one.
+     * @param writer SEDP writer used to relay the announcement.
+     * @param remote_change Announcement received.
+     * @param max_size Maximum size of the announcement.
+     * @return True if correct.
+     */
+    bool relayEndpointData(t_p_StatefulWriter& writer, const CacheChange_t& remote_change, uint32_t max_size);
+
+    /**
+     * Add an announcement to a SEDP writer, replacing the previous one of the same endpoint.
+     * When the previous announcement holds the same data it is kept, and the new change is released.
+     * @param writer SEDP writer used to announce the endpoint.
+     * @param change Announcement to add.
+     * @return True if correct.
+     */
+    bool updateEndpointAnnouncement(t_p_StatefulWriter& writer, CacheChange_t* change);
+
+    /**
+     * Announce again the relayed endpoints on a topic, so they reach the participants that were not interested
+     * in them when they were first announced.
+     * @param writer SEDP writer used to relay the announcements.
+     * @param topic_name Topic of the endpoints.
+     * @param max_size Maximum size of the announcements.
+     */
+    void refreshRelayedAnnouncements(t_p_StatefulWriter& writer, const string_255& topic_name, uint32_t max_size);
+
+    //!Filter of the relayed announcements, only created by discovery servers.
+    EDPRelayFilter* relay_filter_;
+
 #if HAVE_SECURITY
     bool create_sedp_secure_endpoints();
 
@@ -0,0 +1,63 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PDPClient.h
+ *
+ */
+
+#ifndef PDPCLIENT_H_
+#define PDPCLIENT_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "PDPSimple.h"
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+/**
+ * Class PDPClient, implements the participant discovery of a discovery client.
+ * The client announces itself only to its discovery servers and matches its builtin endpoints only with them.
+ * The rest of participants are learnt from the announcements relayed by the servers.
+ *@ingroup DISCOVERY_MODULE
+ */
+class PDPClient : public PDPSimple
+{
+    public:
+    /**
+     * Constructor
+     * @param builtin Pointer to the BuiltinProcols object.
+     */
+    PDPClient(BuiltinProtocols* builtin);
+    virtual ~PDPClient();
+
+    /**
+     * Assign the remote builtin endpoints, only when the remote participant is a discovery server.
+     * @param pdata Pointer to the RTPSParticipantProxyData object.
+     */
+    void assignRemoteEndpoints(ParticipantProxyData* pdata) override;
+
+    /**
+     * Remove the remote builtin endpoints, only when the remote participant is a discovery server.
+     * @param pdata Pointer to the ParticipantProxyData to remove
+     */
+    void removeRemoteEndpoints(ParticipantProxyData* pdata) override;
+};
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
+#endif
+#endif /* PDPCLIENT_H_ */
@@ -0,0 +1,90 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PDPServer.h
+ *
+ */
+
+#ifndef PDPSERVER_H_
+#define PDPSERVER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "PDPSimple.h"
+#include "../../../common/SequenceNumber.h"
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+/**
+ * Class PDPServer, implements the participant discovery of a discovery server.
+ * The server announces itself only to the participants that contact it, and relays to all of them the
+ * participant and endpoint announcements it receives, so its clients never need to talk to each other
+ * for discovery purposes.
+ *@ingroup DISCOVERY_MODULE
+ */
+class PDPServer : public PDPSimple
+{
+    public:
+    /**
+     * Constructor
+     * @param builtin Pointer to the BuiltinProcols object.
+     */
+    PDPServer(BuiltinProtocols* builtin);
+    virtual ~PDPServer();
+
+    /**
+     * Fill the local ParticipantProxyData, marking this participant as a discovery server.
+     * @param participant_data Pointer to the local ParticipantProxyData.
+     */
+    void initializeParticipantProxyData(ParticipantProxyData* participant_data) override;
+
+    /**
+     * Announce the local DPD and the relayed ones, discarding the relayed disposals already announced.
+     * @param new_change If true a new change (with new seqNum) is created and sent; if false the last change is re-sent
+     * @param dispose Sets change kind to NOT_ALIVE_DISPOSED_UNREGISTERED
+     */
+    void announceParticipantState(bool new_change, bool dispose = false) override;
+
+    /**
+     * Remove remote endpoints from the participant discovery protocol, relaying the disposal of the
+     * participant and its endpoints to the rest of participants.
+     * @param pdata Pointer to the ParticipantProxyData to remove
+     */
+    void removeRemoteEndpoints(ParticipantProxyData* pdata) override;
+
+    /**
+     * Relay to all the known participants the announcement of a remote RTPSParticipant.
+     * @param change Announcement received.
+     */
+    void relayParticipantAnnouncement(const CacheChange_t& change) override;
+
+    /**
+     * Check if a remote participant is a discovery server.
+     * @param pdata Information announced by the remote participant.
+     * @return True if the participant announced itself as a discovery server.
+     */
+    static bool isDiscoveryServer(const ParticipantProxyData& pdata);
+
+    private:
+    //!Relayed disposals with a lower sequence number have already been announced.
+    SequenceNumber_t m_disposedRelaysMark;
+};
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
+#endif
+#endif /* PDPSERVER_H_ */
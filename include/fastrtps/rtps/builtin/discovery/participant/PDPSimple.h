@@ -22,7 +22,12 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <mutex>
+#include <unordered_map>
+#include <vector>
 #include "../../../common/Guid.h"
+#include "../../../common/InstanceHandle.h"
+#include "../../../common/CDRMessage_t.h"
+#include "../../data/SerializedParticipantData.h"
 #include "../../../attributes/RTPSParticipantAttributes.h"
 
 #include "../../../../qos/QosPolicies.h"
@@ -46,6 +51,7 @@ class ReaderProxyData;
 class WriterProxyData;
 class ParticipantProxyData;
 class PDPSimpleListener;
+struct CacheChange_t;
 
 
 /**
@@ -65,7 +71,7 @@ class PDPSimple
     PDPSimple(BuiltinProtocols* builtin);
     virtual ~PDPSimple();
 
-    void initializeParticipantProxyData(ParticipantProxyData* participant_data);
+    virtual void initializeParticipantProxyData(ParticipantProxyData* participant_data);
 
     /**
      * Initialize the PDP.
@@ -76,10 +82,11 @@ class PDPSimple
 
     /**
      * Force the sending of our local DPD to all remote RTPSParticipants and multicast Locators.
-     * @param new_change If true a new change (with new seqNum) is created and sent; if false the last change is re-sent
+     * @param new_change If true the local data is serialized again and, only if it changed, a new change (with new seqNum)
+     * is created and sent; otherwise the last change is re-sent
      * @param dispose Sets change kind to NOT_ALIVE_DISPOSED_UNREGISTERED 
      */
-    void announceParticipantState(bool new_change, bool dispose = false);
+    virtual void announceParticipantState(bool new_change, bool dispose = false);
     //!Stop the RTPSParticipantAnnouncement (only used in tests).
     void stopParticipantAnnouncement();
     //!Reset the RTPSParticipantAnnouncement (only used in tests).
@@ -139,7 +146,7 @@ class PDPSimple
      * This method assigns remtoe endpoints to the builtin endpoints defined in this protocol. It also calls the corresponding methods in EDP and WLP.
      * @param pdata Pointer to the RTPSParticipantProxyData object.
      */
-    void assignRemoteEndpoints(ParticipantProxyData* pdata);
+    virtual void assignRemoteEndpoints(ParticipantProxyData* pdata);
 
     void notifyAboveRemoteEndpoints(const ParticipantProxyData& pdata);
 
@@ -147,7 +154,14 @@ class PDPSimple
      * Remove remote endpoints from the participant discovery protocol
      * @param pdata Pointer to the ParticipantProxyData to remove
      */
-    void removeRemoteEndpoints(ParticipantProxyData* pdata);
+    virtual void removeRemoteEndpoints(ParticipantProxyData* pdata);
+
+    /**
+     * Called when an announcement with new information of a remote RTPSParticipant is received.
+     * Simple discovery does nothing, discovery servers relay it to their clients.
+     * @param change Announcement received.
+     */
+    virtual void relayParticipantAnnouncement(const CacheChange_t& /*change*/) {}
 
     /**
      * This method removes a remote RTPSParticipant and all its writers and readers.
@@ -219,9 +233,21 @@ class PDPSimple
      */
     inline std::recursive_mutex* getMutex() const {return mp_mutex;}
 
-    CDRMessage_t get_participant_proxy_data_serialized(Endianness_t endian);
+    /**
+     * Copy the serialized data of the local RTPSParticipant into a message.
+     * The serialization is kept until the local data is updated.
+     * @param endian Endianness of the serialization.
+     * @param msg Message receiving the data. It is left empty if the data cannot be serialized.
+     */
+    void get_participant_proxy_data_serialized(Endianness_t endian, CDRMessage_t& msg);
+
+    /**
+     * Notify that the data of the local RTPSParticipant was updated, so its kept serializations are outdated.
+     * Has to be called with the PDP mutex locked.
+     */
+    void local_participant_data_updated();
 
-    private:
+    protected:
     //!Pointer to the local RTPSParticipant.
     RTPSParticipantImpl* mp_RTPSParticipant;
     //!Discovery attributes.
@@ -234,8 +260,24 @@ class PDPSimple
     EDP* mp_EDP;
     //!Registered RTPSParticipants (including the local one, that is the first one.)
     std::vector<ParticipantProxyData*> m_participantProxies;
+
+    //!Registered RTPSParticipant and its last announcement.
+    struct ParticipantProxyEntry
+    {
+        ParticipantProxyData* proxy;
+        //!Hash of the announcement, to discard most of the changed ones without comparing them.
+        uint64_t announcement_fingerprint;
+        //!Serialized data of the announcement.
+        std::vector<octet> announcement;
+    };
+    //!Registered RTPSParticipants indexed by GUID prefix.
+    std::unordered_map<GuidPrefix_t, ParticipantProxyEntry, GuidPrefixHash> m_participantProxiesByPrefix;
     //!Variable to indicate if any parameter has changed.
     bool m_hasChangedLocalPDP;
+    //!Serialized data of the last announcement of the local RTPSParticipant.
+    std::vector<octet> m_localAnnouncement;
+    //!Serialized data of the local RTPSParticipant handed to the security plugins.
+    SerializedParticipantData m_serializedLocalData;
     //!TimedEvent to periodically resend the local RTPSParticipant information.
     ResendParticipantProxyDataPeriod* mp_resendParticipantTimer;
     //!Listener for the SPDP messages.
@@ -250,6 +292,14 @@ class PDPSimple
      * @return True if correct.
      */
     bool createSPDPEndpoints();
+
+    /**
+     * Remove from the SPDP writer history the announcement with the given key.
+     * @param key InstanceHandle_t of the announced RTPSParticipant.
+     * @return True if an announcement was removed.
+     */
+    bool removeParticipantAnnouncement(const InstanceHandle_t& key);
+
     std::recursive_mutex* mp_mutex;
 
 
@@ -87,7 +87,7 @@ namespace eprosima
                     kind(ALIVE),
                     isRead(false),
                     is_untyped_(true),
-                    dataFragments_(new std::vector<uint32_t>()),
+                    dataFragments_(nullptr),
                     fragment_size_(0)
                 {
                 }
@@ -105,7 +105,7 @@ namespace eprosima
                     serializedPayload(payload_size),
                     isRead(false),
                     is_untyped_(is_untyped),
-                    dataFragments_(new std::vector<uint32_t>()),
+                    dataFragments_(nullptr),
                     fragment_size_(0)
                 {
                 }
@@ -127,7 +127,7 @@ namespace eprosima
                     bool ret = serializedPayload.copy(&ch_ptr->serializedPayload, (ch_ptr->is_untyped_ ? false : true));
 
                     setFragmentSize(ch_ptr->fragment_size_);
-                    dataFragments_->assign(ch_ptr->dataFragments_->begin(), ch_ptr->dataFragments_->end());
+                    copy_fragments(ch_ptr);
 
                     isRead = ch_ptr->isRead;
 
@@ -147,7 +147,7 @@ namespace eprosima
                     serializedPayload.encapsulation = ch_ptr->serializedPayload.encapsulation;
 
                     setFragmentSize(ch_ptr->fragment_size_);
-                    dataFragments_->assign(ch_ptr->dataFragments_->begin(), ch_ptr->dataFragments_->end());
+                    copy_fragments(ch_ptr);
 
                     isRead = ch_ptr->isRead;
                 }
@@ -160,10 +160,23 @@ namespace eprosima
 
                 uint32_t getFragmentCount() const
                 { 
-                    return (uint32_t)dataFragments_->size();
+                    return dataFragments_ != nullptr ? (uint32_t)dataFragments_->size() : 0u;
                 }
 
-                std::vector<uint32_t>* getDataFragments() { return dataFragments_; }
+                /*!
+                 * Get the status of the fragments of this change.
+                 * The vector is only allocated the first time fragment information is needed,
+                 * so changes that are never fragmented don't allocate it.
+                 * @return Pointer to the status of each fragment.
+                 */
+                std::vector<uint32_t>* getDataFragments()
+                {
+                    if (dataFragments_ == nullptr)
+                    {
+                        dataFragments_ = new std::vector<uint32_t>();
+                    }
+                    return dataFragments_;
+                }
 
                 uint16_t getFragmentSize() const { return fragment_size_; }
 
@@ -172,21 +185,37 @@ namespace eprosima
                     this->fragment_size_ = fragment_size;
 
                     if (fragment_size == 0) {
-                        dataFragments_->clear();
+                        // Keep the vector (if any) so a reused change doesn't allocate it again.
+                        if (dataFragments_ != nullptr)
+                        {
+                            dataFragments_->clear();
+                        }
                     }
                     else
                     {
                         //TODO Mirar si cuando se compatibilice con RTI funciona el calculo, porque ellos
                         //en el sampleSize incluyen el padding.
                         uint32_t size = (serializedPayload.length + fragment_size - 1) / fragment_size;
-                        dataFragments_->assign(size, ChangeFragmentStatus_t::NOT_PRESENT);
+                        getDataFragments()->assign(size, ChangeFragmentStatus_t::NOT_PRESENT);
                     }
                 }
 
 
                 private:
 
-                // Data fragments
+                void copy_fragments(const CacheChange_t* ch_ptr)
+                {
+                    if (ch_ptr->dataFragments_ != nullptr && !ch_ptr->dataFragments_->empty())
+                    {
+                        getDataFragments()->assign(ch_ptr->dataFragments_->begin(), ch_ptr->dataFragments_->end());
+                    }
+                    else if (dataFragments_ != nullptr)
+                    {
+                        dataFragments_->clear();
+                    }
+                }
+
+                // Data fragments, only allocated for fragmented changes
                 std::vector<uint32_t>* dataFragments_;
 
                 // Fragment size
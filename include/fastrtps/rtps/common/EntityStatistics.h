@@ -0,0 +1,298 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EntityStatistics.h
+ */
+
+#ifndef ENTITY_STATISTICS_H
+#define ENTITY_STATISTICS_H
+
+#include "../writer/RepairStatistics.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+/**
+ * Distribution of a latency. Bucket 0 counts the measures below 1 microsecond, and bucket i the ones
+ * from 2^(i-1) up to 2^i microseconds. The last bucket also counts the slower ones.
+ * @ingroup COMMON_MODULE
+ */
+struct LatencyHistogram
+{
+    static const size_t bucket_count = 24;
+
+    std::array<uint64_t, bucket_count> buckets{};
+    //! Number of measures.
+    uint64_t count = 0;
+    //! Sum of all the measures, in nanoseconds.
+    uint64_t total_ns = 0;
+    //! Highest measure, in nanoseconds.
+    uint64_t max_ns = 0;
+};
+
+/**
+ * Reasons for a reader to discard a received sample.
+ * @ingroup COMMON_MODULE
+ */
+enum SampleDropReason : uint8_t
+{
+    //! The sample came from a writer not matched with the reader.
+    DROP_UNKNOWN_WRITER = 0,
+    //! The sample had already been received.
+    DROP_DUPLICATE,
+    //! There was no cache change available, or it was too small for the sample.
+    DROP_NO_RESOURCES,
+    //! The payload could not be decoded.
+    DROP_SECURITY,
+    //! The history did not accept the sample.
+    DROP_REJECTED_BY_HISTORY,
+    SAMPLE_DROP_REASON_COUNT
+};
+
+/**
+ * Snapshot of the counters of a RTPSWriter.
+ * @ingroup WRITER_MODULE
+ */
+struct WriterStatistics
+{
+    //! Number of DATA submessages sent, including repairs.
+    uint64_t samples_sent = 0;
+    //! Payload bytes sent in DATA and DATA_FRAG submessages.
+    uint64_t bytes_sent = 0;
+    //! Number of DATA_FRAG submessages sent.
+    uint64_t fragments_sent = 0;
+    uint64_t heartbeats_sent = 0;
+    uint64_t gaps_sent = 0;
+    uint64_t acknacks_received = 0;
+    uint64_t nackfrags_received = 0;
+    //! Repairs sent in response to ACKNACK submessages. Only filled by reliable writers.
+    RepairStatistics repairs;
+    //! Number of changes in the history of the writer.
+    uint64_t history_size = 0;
+    /**
+     * Time spent sending each RTPS message through the transports.
+     * Messages only appended to the batches of the participant are not included
+     * (see RTPSParticipantAttributes::submessageBatchingWindow).
+     * Their datagrams are accounted in ParticipantStatistics::send_latency when the batches are sent.
+     */
+    LatencyHistogram send_latency;
+};
+
+/**
+ * Snapshot of the counters of a RTPSReader.
+ * @ingroup READER_MODULE
+ */
+struct ReaderStatistics
+{
+    //! Number of samples received in DATA submessages, or completed from DATA_FRAG submessages.
+    uint64_t samples_received = 0;
+    //! Payload bytes received in DATA and DATA_FRAG submessages.
+    uint64_t bytes_received = 0;
+    //! Number of DATA_FRAG submessages received.
+    uint64_t fragments_received = 0;
+    uint64_t heartbeats_received = 0;
+    uint64_t gaps_received = 0;
+    uint64_t acknacks_sent = 0;
+    uint64_t nackfrags_sent = 0;
+    //! Number of DATA and DATA_FRAG submessages discarded, indexed by SampleDropReason.
+    std::array<uint64_t, SAMPLE_DROP_REASON_COUNT> samples_dropped{};
+    //! Number of changes in the history of the reader.
+    uint64_t history_size = 0;
+    //! Time from the source timestamp of each sample to its reception. Affected by clock differences between hosts.
+    LatencyHistogram reception_latency;
+};
+
+/**
+ * Snapshot of the counters of a RTPSParticipant, which include the traffic of all its transports.
+ * @ingroup RTPS_MODULE
+ */
+struct ParticipantStatistics
+{
+    uint64_t datagrams_sent = 0;
+    uint64_t bytes_sent = 0;
+    //! Number of datagrams the transports failed to send.
+    uint64_t send_errors = 0;
+    uint64_t datagrams_received = 0;
+    uint64_t bytes_received = 0;
+    //! Time spent by the transports sending each datagram.
+    LatencyHistogram send_latency;
+};
+
+/**
+ * Lock-free accumulator of a LatencyHistogram.
+ * @ingroup COMMON_MODULE
+ */
+class LatencyRecorder
+{
+public:
+
+    LatencyRecorder()
+    {
+        for (std::atomic<uint64_t>& bucket : buckets_)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void record(std::chrono::nanoseconds latency)
+    {
+        uint64_t ns = latency.count() < 0 ? 0 : static_cast<uint64_t>(latency.count());
+        uint64_t us = ns / 1000;
+        size_t bucket = 0;
+        while (us != 0 && bucket < (LatencyHistogram::bucket_count - 1))
+        {
+            us >>= 1;
+            ++bucket;
+        }
+
+        buckets_[bucket].fetch_add(1, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+        total_ns_.fetch_add(ns, std::memory_order_relaxed);
+
+        uint64_t max = max_ns_.load(std::memory_order_relaxed);
+        while (ns > max && !max_ns_.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void snapshot(LatencyHistogram& histogram) const
+    {
+        for (size_t i = 0; i < LatencyHistogram::bucket_count; ++i)
+        {
+            histogram.buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+        }
+        histogram.count = count_.load(std::memory_order_relaxed);
+        histogram.total_ns = total_ns_.load(std::memory_order_relaxed);
+        histogram.max_ns = max_ns_.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    std::array<std::atomic<uint64_t>, LatencyHistogram::bucket_count> buckets_;
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> total_ns_{0};
+    std::atomic<uint64_t> max_ns_{0};
+};
+
+/**
+ * Counters of a RTPSWriter, updated without locking the writer.
+ * @ingroup WRITER_MODULE
+ */
+struct WriterCounters
+{
+    std::atomic<uint64_t> samples_sent{0};
+    std::atomic<uint64_t> bytes_sent{0};
+    std::atomic<uint64_t> fragments_sent{0};
+    std::atomic<uint64_t> heartbeats_sent{0};
+    std::atomic<uint64_t> gaps_sent{0};
+    std::atomic<uint64_t> acknacks_received{0};
+    std::atomic<uint64_t> nackfrags_received{0};
+    LatencyRecorder send_latency;
+
+    void snapshot(WriterStatistics& statistics) const
+    {
+        statistics.samples_sent = samples_sent.load(std::memory_order_relaxed);
+        statistics.bytes_sent = bytes_sent.load(std::memory_order_relaxed);
+        statistics.fragments_sent = fragments_sent.load(std::memory_order_relaxed);
+        statistics.heartbeats_sent = heartbeats_sent.load(std::memory_order_relaxed);
+        statistics.gaps_sent = gaps_sent.load(std::memory_order_relaxed);
+        statistics.acknacks_received = acknacks_received.load(std::memory_order_relaxed);
+        statistics.nackfrags_received = nackfrags_received.load(std::memory_order_relaxed);
+        send_latency.snapshot(statistics.send_latency);
+    }
+};
+
+/**
+ * Counters of a RTPSReader, updated without locking the reader.
+ * @ingroup READER_MODULE
+ */
+struct ReaderCounters
+{
+    std::atomic<uint64_t> samples_received{0};
+    std::atomic<uint64_t> bytes_received{0};
+    std::atomic<uint64_t> fragments_received{0};
+    std::atomic<uint64_t> heartbeats_received{0};
+    std::atomic<uint64_t> gaps_received{0};
+    std::atomic<uint64_t> acknacks_sent{0};
+    std::atomic<uint64_t> nackfrags_sent{0};
+    std::array<std::atomic<uint64_t>, SAMPLE_DROP_REASON_COUNT> samples_dropped;
+    LatencyRecorder reception_latency;
+
+    ReaderCounters()
+    {
+        for (std::atomic<uint64_t>& dropped : samples_dropped)
+        {
+            dropped.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    void drop(SampleDropReason reason)
+    {
+        samples_dropped[reason].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void snapshot(ReaderStatistics& statistics) const
+    {
+        statistics.samples_received = samples_received.load(std::memory_order_relaxed);
+        statistics.bytes_received = bytes_received.load(std::memory_order_relaxed);
+        statistics.fragments_received = fragments_received.load(std::memory_order_relaxed);
+        statistics.heartbeats_received = heartbeats_received.load(std::memory_order_relaxed);
+        statistics.gaps_received = gaps_received.load(std::memory_order_relaxed);
+        statistics.acknacks_sent = acknacks_sent.load(std::memory_order_relaxed);
+        statistics.nackfrags_sent = nackfrags_sent.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < SAMPLE_DROP_REASON_COUNT; ++i)
+        {
+            statistics.samples_dropped[i] = samples_dropped[i].load(std::memory_order_relaxed);
+        }
+        reception_latency.snapshot(statistics.reception_latency);
+    }
+};
+
+/**
+ * Counters of a RTPSParticipant, updated without locking the participant.
+ * @ingroup RTPS_MODULE
+ */
+struct ParticipantCounters
+{
+    std::atomic<uint64_t> datagrams_sent{0};
+    std::atomic<uint64_t> bytes_sent{0};
+    std::atomic<uint64_t> send_errors{0};
+    std::atomic<uint64_t> datagrams_received{0};
+    std::atomic<uint64_t> bytes_received{0};
+    LatencyRecorder send_latency;
+
+    void snapshot(ParticipantStatistics& statistics) const
+    {
+        statistics.datagrams_sent = datagrams_sent.load(std::memory_order_relaxed);
+        statistics.bytes_sent = bytes_sent.load(std::memory_order_relaxed);
+        statistics.send_errors = send_errors.load(std::memory_order_relaxed);
+        statistics.datagrams_received = datagrams_received.load(std::memory_order_relaxed);
+        statistics.bytes_received = bytes_received.load(std::memory_order_relaxed);
+        send_latency.snapshot(statistics.send_latency);
+    }
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // ENTITY_STATISTICS_H
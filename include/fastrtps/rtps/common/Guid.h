@@ -123,6 +123,22 @@ struct RTPS_DllAPI GuidPrefix_t
 
 const GuidPrefix_t c_GuidPrefix_Unknown;
 
+/*!
+ * @brief Defines the STL hash function for type GuidPrefix_t.
+ */
+struct GuidPrefixHash
+{
+    std::size_t operator()(const GuidPrefix_t& prefix) const noexcept
+    {
+        std::size_t h = 0;
+        for (unsigned int i = 0; i < GuidPrefix_t::size; ++i)
+        {
+            h = (h * 31) + prefix.value[i];
+        }
+        return h;
+    }
+};
+
 
 inline std::ostream& operator<<(std::ostream& output,const GuidPrefix_t& guiP){
     output << std::hex;
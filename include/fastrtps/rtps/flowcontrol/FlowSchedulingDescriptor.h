@@ -0,0 +1,51 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FLOW_SCHEDULING_DESCRIPTOR_H
+#define FLOW_SCHEDULING_DESCRIPTOR_H
+
+#include <cstdint>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+/**
+ * Descriptor of how a writer shares the throughput controller of its participant with the rest of writers.
+ * Writers with higher priority are always served first. The budget left is shared between the writers with
+ * the same priority proportionally to their weights.
+ * @ingroup NETWORK_MODULE
+ */
+struct FlowSchedulingDescriptor
+{
+    //! Relative share of the participant budget among the writers with the same priority. Default value 1.
+    uint32_t weight;
+    //! Strict priority. Writers with higher values are served first. Default value 0.
+    int32_t priority;
+
+    FlowSchedulingDescriptor() : weight(1), priority(0) {}
+    FlowSchedulingDescriptor(uint32_t w, int32_t p) : weight(w), priority(p) {}
+
+    bool operator==(const FlowSchedulingDescriptor& b) const
+    {
+        return (this->weight == b.weight) &&
+               (this->priority == b.priority);
+    }
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // FLOW_SCHEDULING_DESCRIPTOR_H
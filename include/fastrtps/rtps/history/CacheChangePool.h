@@ -29,6 +29,8 @@
 #include <cstdint>
 #include <cstddef>
 #include <mutex>
+#include <atomic>
+#include <memory>
 
 
 namespace eprosima {
@@ -36,6 +38,7 @@ namespace fastrtps{
 namespace rtps {
 
 struct CacheChange_t;
+class CacheChangeFreeList;
 
 /**
  * Class CacheChangePool, used by the HistoryCache to pre-reserve a number of CacheChange_t to avoid dynamically reserving memory in the middle of execution loops.
@@ -57,8 +60,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param calculateSizeFunc Function that returns the size of the data which will go into the CacheChange.
-         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE and
-         * PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
+         * This function is executed depending on the memory management policy (DYNAMIC_RESERVE_MEMORY_MODE,
+         * DYNAMIC_REUSABLE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE)
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, const std::function<uint32_t()>& calculateSizeFunc);
@@ -67,7 +70,8 @@ class CacheChangePool {
          * @brief Reserves a CacheChange from the pool.
          * @param chan Returned pointer to the reserved CacheChange.
          * @param dataSize Size of the data which will go into the CacheChange if it is necessary (on memory management
-         * policy DYNAMIC_RESERVE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE). In other case this variable is not used.
+         * policy DYNAMIC_RESERVE_MEMORY_MODE, DYNAMIC_REUSABLE_MEMORY_MODE and PREALLOCATED_WITH_REALLOC_MEMORY_MODE).
+         * In other case this variable is not used.
          * @return True whether the CacheChange could be allocated. In other case returns false.
          */
         bool reserve_Cache(CacheChange_t** chan, uint32_t dataSize);
@@ -80,6 +84,11 @@ class CacheChangePool {
         size_t get_freeCachesSize(){return m_freeCaches.size();}
         //!Get the initial payload size associated with the Pool.
         inline uint32_t getInitialPayloadSize(){return m_initial_payload_size;};
+        /**
+         * Check if the pool can be accessed concurrently without an external lock.
+         * @return True when the memory management policy is DYNAMIC_REUSABLE_MEMORY_MODE.
+         */
+        inline bool is_thread_safe() const {return memoryMode == DYNAMIC_REUSABLE_MEMORY_MODE;}
     private:
         uint32_t m_initial_payload_size;
         uint32_t m_payload_size;
@@ -90,6 +99,17 @@ class CacheChangePool {
         bool allocateGroup(uint32_t pool_size);
         CacheChange_t* allocateSingle(uint32_t dataSize);
         MemoryManagementPolicy_t memoryMode;
+
+        //!Free lists of DYNAMIC_REUSABLE_MEMORY_MODE, one for each payload size class, from smaller to bigger.
+        std::vector<std::unique_ptr<CacheChangeFreeList>> m_sizeClasses;
+        //!Number of CacheChanges allocated on DYNAMIC_REUSABLE_MEMORY_MODE.
+        std::atomic<uint32_t> m_reusable_pool_size;
+        //!Protects m_allCaches on DYNAMIC_REUSABLE_MEMORY_MODE, only when a CacheChange is allocated or deleted.
+        std::mutex m_allCachesMutex;
+        bool reserveReusable(CacheChange_t** chan, uint32_t dataSize);
+        void releaseReusable(CacheChange_t* ch);
+        bool deleteUnusedReusable();
+        void deleteReusable(CacheChange_t* ch);
 };
 }
 } /* namespace rtps */
@@ -50,17 +50,28 @@ class History
         HistoryAttributes m_att;
         /**
          * Reserve a CacheChange_t from the CacheChange pool.
+         * The History mutex is not taken when the pool is lock-free (DYNAMIC_REUSABLE_MEMORY_MODE).
          * @param[out] change Pointer to pointer to the CacheChange_t to reserve
          * @return True is reserved
          */
         RTPS_DllAPI inline bool reserve_Cache(CacheChange_t** change, const std::function<uint32_t()>& calculateSizeFunc)
         {
+            if(m_changePool.is_thread_safe())
+            {
+                return m_changePool.reserve_Cache(change, calculateSizeFunc);
+            }
+
             std::lock_guard<std::recursive_timed_mutex> guard(*mp_mutex);
             return m_changePool.reserve_Cache(change, calculateSizeFunc);
         }
 
         RTPS_DllAPI inline bool reserve_Cache(CacheChange_t** change, uint32_t dataSize)
         {
+            if(m_changePool.is_thread_safe())
+            {
+                return m_changePool.reserve_Cache(change, dataSize);
+            }
+
             std::lock_guard<std::recursive_timed_mutex> guard(*mp_mutex);
             return m_changePool.reserve_Cache(change, dataSize);
         }
@@ -71,6 +82,11 @@ class History
          */
         RTPS_DllAPI inline void release_Cache(CacheChange_t* ch)
         {
+            if(m_changePool.is_thread_safe())
+            {
+                return m_changePool.release_Cache(ch);
+            }
+
             std::lock_guard<std::recursive_timed_mutex> guard(*mp_mutex);
             return m_changePool.release_Cache(ch);
         }
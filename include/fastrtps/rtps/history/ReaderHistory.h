@@ -53,6 +53,14 @@ public:
      */
     RTPS_DllAPI virtual bool received_change(CacheChange_t* change, size_t);
 
+    /**
+     * Virtual method that is called to check whether a received change has already expired and has
+     * to be discarded. In this implementation changes never expire.
+     * @param change Pointer to the change
+     * @return True if expired.
+     */
+    RTPS_DllAPI virtual bool is_change_expired(const CacheChange_t* change) const;
+
     /**
      * Add a CacheChange_t to the ReaderHistory.
      * @param a_change Pointer to the CacheChange to add.
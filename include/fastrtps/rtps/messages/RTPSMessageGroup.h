@@ -35,6 +35,8 @@ namespace rtps {
 
 class RTPSParticipantImpl;
 class Endpoint;
+struct WriterCounters;
+struct ReaderCounters;
 
 /**
  * Class RTPSMessageGroup_t that contains the messages used to send multiples changes as one message.
@@ -224,12 +226,24 @@ class RTPSMessageGroup
 
         bool add_info_dst_in_buffer(CDRMessage_t* buffer, const std::vector<GUID_t>& remote_endpoints);
 
-        bool add_info_ts_in_buffer(const std::vector<GUID_t>& remote_readers);
+        bool add_info_ts_in_buffer(const Time_t& timestamp, const std::vector<GUID_t>& remote_readers);
+
+#if HAVE_TRACEPOINTS
+        void trace_data_added(const SequenceNumber_t& seq);
+#endif
 
         RTPSParticipantImpl* participant_;
 
         Endpoint* endpoint_;
 
+        //! Counters of the endpoint, depending on its type. The other one is nullptr.
+        WriterCounters* writer_counters_;
+
+        ReaderCounters* reader_counters_;
+
+        //! The endpoint is a writer sending the key hash of its changes as inline QoS.
+        bool send_key_hash_;
+
         CDRMessage_t* full_msg_;
 
         CDRMessage_t* submessage_msg_;
@@ -248,12 +262,22 @@ class RTPSMessageGroup
 
         GuidPrefix_t fixed_destination_prefix_;
 
+        //! The current message has DATA or DATA_FRAG submessages, so it is not handed to the participant batcher.
+        bool has_data_;
+
 #if HAVE_SECURITY
         CDRMessage_t* encrypt_msg_;
 
         std::vector<GuidPrefix_t> current_remote_participants_;
 #endif
 
+#if HAVE_TRACEPOINTS
+        //! Lowest and highest sequence numbers of the DATA and DATA_FRAG submessages in the current message.
+        uint64_t trace_first_seq_;
+
+        uint64_t trace_last_seq_;
+#endif
+
         std::chrono::steady_clock::time_point max_blocking_time_point_;
 
 };
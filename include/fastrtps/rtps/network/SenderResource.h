@@ -45,15 +45,21 @@ public:
      * @param dataLength Length of the data to be sent. Will be used as a boundary for
      * the previous parameter.
      * @param destination_locator Locator describing the destination endpoint.
+     * @param transport_priority TransportPriority QoS of the sending endpoint. Transports supporting it use it to
+     * mark the traffic (i.e. DSCP). Non-positive values mean default priority.
      * @return Success of the send operation.
      */
-    bool send(const octet* data, uint32_t dataLength, const Locator_t& destination_locator)
+    bool send(
+            const octet* data,
+            uint32_t dataLength,
+            const Locator_t& destination_locator,
+            int32_t transport_priority = 0)
     {
         bool returned_value = false;
 
         if (send_lambda_)
         {
-            returned_value = send_lambda_(data, dataLength, destination_locator);
+            returned_value = send_lambda_(data, dataLength, destination_locator, transport_priority);
         }
 
         return returned_value;
@@ -80,7 +86,7 @@ protected:
     int32_t transport_kind_;
 
     std::function<void()> clean_up;
-    std::function<bool(const octet*, uint32_t, const Locator_t&)> send_lambda_;
+    std::function<bool(const octet*, uint32_t, const Locator_t&, int32_t)> send_lambda_;
 
 private:
 
@@ -24,6 +24,7 @@
 #include <memory>
 #include "../../fastrtps_dll.h"
 #include "../common/Guid.h"
+#include "../common/EntityStatistics.h"
 #include <fastrtps/rtps/reader/StatefulReader.h>
 
 #include <fastrtps/rtps/attributes/RTPSParticipantAttributes.h>
@@ -141,6 +142,12 @@ class RTPS_DllAPI RTPSParticipant
 
     bool get_remote_reader_info(const GUID_t& readerGuid, ReaderProxyData& returnedInfo);
 
+    /**
+     * Get a snapshot of the counters of this participant.
+     * @return Copy of the counters.
+     */
+    ParticipantStatistics get_statistics() const;
+
     private:
 
     //!Pointer to the implementation.
@@ -25,6 +25,7 @@
 #include "../Endpoint.h"
 #include "../attributes/ReaderAttributes.h"
 #include "../common/SequenceNumber.h"
+#include "../common/EntityStatistics.h"
 
 #include <map>
 
@@ -52,6 +53,7 @@ namespace eprosima
                 friend class RTPSParticipantImpl;
                 friend class MessageReceiver;
                 friend class EDP;
+                friend class RTPSMessageGroup;
                 protected:
                 RTPSReader(RTPSParticipantImpl*,GUID_t& guid,
                         ReaderAttributes& att,ReaderHistory* hist,ReaderListener* listen=nullptr);
@@ -170,6 +172,9 @@ namespace eprosima
                 //! Returns a pointer to the associated History.
                 RTPS_DllAPI inline ReaderHistory* getHistory() {return mp_history;};
 
+                //!Get the associated RTPSParticipantImpl.
+                inline RTPSParticipantImpl* getRTPSParticipant() const {return mp_RTPSParticipant;}
+
                 /*!
                  * @brief Search if there is a CacheChange_t, giving SequenceNumber_t and writer GUID_t,
                  * waiting to be completed because it is fragmented.
@@ -188,6 +193,12 @@ namespace eprosima
                 */
                 virtual bool isInCleanState() = 0;
 
+                /**
+                 * Get a snapshot of the counters of this reader.
+                 * @return Copy of the counters.
+                 */
+                ReaderStatistics get_statistics();
+
                 protected:
                 void setTrustedWriter(EntityId_t writer)
                 {
@@ -255,6 +266,15 @@ namespace eprosima
                 //TODO Select one
                 FragmentedChangePitStop* fragmentedChangePitStop_;
 
+                //!Counters of the traffic of this reader.
+                ReaderCounters statistics_counters_;
+
+                /**
+                 * Account a sample accepted by this reader, and the time since it was written.
+                 * @param change Received change, with its source timestamp.
+                 */
+                void sample_received(const CacheChange_t* change);
+
                 private:
 
                 RTPSReader& operator=(const RTPSReader&) = delete;
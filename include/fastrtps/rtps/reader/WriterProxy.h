@@ -27,7 +27,7 @@
 #include "../common/CacheChange.h"
 #include "../attributes/ReaderAttributes.h"
 
-#include<set>
+#include <deque>
 
 // Testing purpose
 #ifndef TEST_FRIENDS
@@ -115,6 +115,32 @@ namespace eprosima
                      */
                     const std::vector<ChangeFromWriter_t>  missing_changes();
 
+                    /**
+                     * Applies the given function object to every MISSING change, in order, without building
+                     * the list of missing changes. Used to generate the ACKNACK bitmap straight from the state.
+                     * @param f Function to apply. Will receive a SequenceNumber_t and has to return
+                     *          false to stop the iteration.
+                     */
+                    template <class UnaryPredicate>
+                    void for_each_missing_change(UnaryPredicate f) const
+                    {
+                        std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
+
+                        if(pendingChangesFromW_ == 0)
+                            return;
+
+                        // Only the changes up to missingHighMark_ may be MISSING.
+                        SequenceNumber_t seq = changesFromWLowMark_;
+                        for(uint8_t state : m_changesFromW)
+                        {
+                            ++seq;
+                            if(seq > missingHighMark_)
+                                break;
+                            if(change_status(seq, state) == ChangeFromWriterStatus_t::MISSING && !f(seq))
+                                break;
+                        }
+                    }
+
                     size_t unknown_missing_changes_up_to(const SequenceNumber_t& seqNum);
 
                     //! Pointer to associated StatefulReader.
@@ -185,6 +211,33 @@ namespace eprosima
 
                     void cleanup();
 
+                    /*!
+                     * @brief Returns the status of a change, taking into account the UNKNOWN changes marked as
+                     * MISSING in bulk by missing_changes_update.
+                     * @param seq_num Sequence number of the change.
+                     * @param state Entry of the change in the m_changesFromW container.
+                     * @remarks No thread-safe.
+                     */
+                    ChangeFromWriterStatus_t change_status(const SequenceNumber_t& seq_num, uint8_t state) const;
+
+                    /*!
+                     * @brief Returns the state of a change that is in the m_changesFromW container.
+                     * @remarks No thread-safe.
+                     */
+                    ChangeFromWriter_t change_from_writer(const SequenceNumber_t& seq_num) const;
+
+                    //! Position of a change in the m_changesFromW container.
+                    size_t change_index(const SequenceNumber_t& seq_num) const
+                    {
+                        return static_cast<size_t>((seq_num - changesFromWLowMark_).to64long() - 1);
+                    }
+
+                    //! Sequence number of the last change in the m_changesFromW container.
+                    SequenceNumber_t last_change_from_writer() const
+                    {
+                        return changesFromWLowMark_ + static_cast<uint32_t>(m_changesFromW.size());
+                    }
+
                     //!Is the writer alive
                     bool m_isAlive;
                     //Print Method for log purposes
@@ -193,23 +246,18 @@ namespace eprosima
                     //!Mutex Pointer
                     std::recursive_mutex* mp_mutex;
 
-                    //!Vector containing the ChangeFromWriter_t objects.
-                    std::set<ChangeFromWriter_t, ChangeFromWriterCmp> m_changesFromW;
+                    //! State of each change after changesFromWLowMark_, one byte per sequence number.
+                    std::deque<uint8_t> m_changesFromW;
                     SequenceNumber_t changesFromWLowMark_;
 
-                    //! Store last ChacheChange_t notified.
-                    SequenceNumber_t lastNotified_;
+                    //! UNKNOWN changes up to this sequence number are MISSING.
+                    SequenceNumber_t missingHighMark_;
 
-                    void for_each_set_status_from(decltype(m_changesFromW)::iterator first,
-                            decltype(m_changesFromW)::iterator last,
-                            ChangeFromWriterStatus_t status,
-                            ChangeFromWriterStatus_t new_status);
+                    //! Number of UNKNOWN or MISSING changes in the m_changesFromW container.
+                    size_t pendingChangesFromW_;
 
-                    void for_each_set_status_from_and_maybe_remove(decltype(m_changesFromW)::iterator first,
-                            decltype(m_changesFromW)::iterator last,
-                            ChangeFromWriterStatus_t status,
-                            ChangeFromWriterStatus_t orstatus,
-                            ChangeFromWriterStatus_t new_status);
+                    //! Store last ChacheChange_t notified.
+                    SequenceNumber_t lastNotified_;
             };
 
         } /* namespace rtps */
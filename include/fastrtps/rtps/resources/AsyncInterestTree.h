@@ -49,6 +49,9 @@ public:
    //! Extracts from the visible set 
    std::set<const RTPSWriter*> GetInterestedWriters() const;
 
+   //! Checks whether there are writers registered in the hidden set.
+   bool HasPendingInterest() const;
+
 private:
    std::set<const RTPSWriter*> mInterestAlpha, mInterestBeta;
    mutable std::mutex mMutexActive, mMutexHidden;
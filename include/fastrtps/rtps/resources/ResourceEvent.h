@@ -21,6 +21,8 @@
 #define RESOURCEEVENT_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include "../../fastrtps_dll.h"
+
 #include <thread>
 #include <asio.hpp>
 
@@ -45,6 +47,27 @@ public:
     */
     void init_thread(RTPSParticipantImpl*p);
 
+    /**
+     * Get one of the event resources shared by the participants of the process.
+     * A new resource, with its thread, is created while the pool is smaller than the requested size. Otherwise
+     * the least used resource is returned.
+     * @param pool_size Size of the pool of shared event resources.
+     * @return Pointer to the shared event resource.
+     */
+    static ResourceEvent* acquire_shared(uint32_t pool_size);
+
+    /**
+     * Return a shared event resource got with acquire_shared. Its thread is stopped when no participant uses it.
+     * @param event Pointer to the shared event resource.
+     */
+    static void release_shared(ResourceEvent* event);
+
+    /**
+     * Get the number of threads of the pool of shared event resources.
+     * @return Number of shared event resources in use.
+     */
+    RTPS_DllAPI static size_t shared_threads_count();
+
 	/**
 	* Get the associated IO service
 	* @return Associated IO service
@@ -67,6 +90,9 @@ private:
 	 */
 	void announce_thread();
 
+    //!Starts the thread of a shared event resource.
+    void init_shared_thread();
+
 	//!Method to run the tasks
 	void run_io_service();
 
@@ -0,0 +1,57 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IReaderDataFilter.h
+ *
+ */
+
+#ifndef IREADERDATAFILTER_H_
+#define IREADERDATAFILTER_H_
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+struct CacheChange_t;
+struct GUID_t;
+
+/**
+ * Interface used by a writer to decide which of its changes are sent to each matched reader.
+ * The changes that are not relevant for a reader are announced to it as a GAP.
+ * @ingroup WRITER_MODULE
+ */
+class IReaderDataFilter
+{
+    public:
+
+        virtual ~IReaderDataFilter() = default;
+
+        /**
+         * Check if a change has to be sent to a reader.
+         * Called with the writer mutex locked.
+         * @param change Change to check.
+         * @param reader_guid GUID of the matched reader.
+         * @return true if the change is relevant for the reader.
+         */
+        virtual bool is_relevant(
+                const CacheChange_t& change,
+                const GUID_t& reader_guid) const = 0;
+};
+
+} /* namespace rtps */
+}  /* namespace fastrtps */
+}  /* namespace eprosima */
+
+#endif /* IREADERDATAFILTER_H_ */
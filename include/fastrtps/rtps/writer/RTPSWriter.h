@@ -22,6 +22,7 @@
 #include "../Endpoint.h"
 #include "../messages/RTPSMessageGroup.h"
 #include "../attributes/WriterAttributes.h"
+#include "../common/EntityStatistics.h"
 #include "../../utils/collections/ResourceLimitedVector.hpp"
 #include <vector>
 #include <memory>
@@ -35,6 +36,8 @@ namespace rtps {
 class WriterListener;
 class WriterHistory;
 class FlowController;
+class LatencyBudgetFlush;
+class IReaderDataFilter;
 struct CacheChange_t;
 
 
@@ -158,6 +161,23 @@ class RTPSWriter : public Endpoint
      */
     RTPS_DllAPI inline bool isAsync() const { return is_async_; };
 
+    /**
+     * Get whether the changes of this synchronous writer are batched during its latency budget.
+     * @return true if changes are batched
+     */
+    inline bool is_batching() const { return latency_budget_flush_ != nullptr; }
+
+    /**
+     * Get whether the key hash of the changes is always sent as inline QoS.
+     * @return true if the key hash is always sent
+     */
+    inline bool send_key_hash() const { return send_key_hash_; }
+
+    /**
+     * Send the changes batched during the latency budget.
+     */
+    void flush_batch();
+
     /**
      * Remove an specified max number of changes
      * @return at least one change has been removed
@@ -192,6 +212,28 @@ class RTPSWriter : public Endpoint
      */
     bool get_separate_sending () const { return m_separateSendingEnabled; }
 
+    /**
+     * Set the filter deciding which changes are sent to each matched reader.
+     * The filter is not owned by the writer and has to outlive it.
+     * @param filter Pointer to the filter, nullptr to send all the changes to every reader.
+     */
+    void reader_data_filter(IReaderDataFilter* filter) { reader_data_filter_ = filter; }
+
+    /**
+     * Check if a change has to be sent to a matched reader.
+     * Has to be called with the writer mutex locked.
+     * @param change Change to check.
+     * @param reader_guid GUID of the matched reader.
+     * @return true if the change is relevant for the reader.
+     */
+    bool is_relevant(const CacheChange_t& change, const GUID_t& reader_guid) const;
+
+    /**
+     * Get a snapshot of the counters of this writer.
+     * @return Copy of the counters.
+     */
+    virtual WriterStatistics get_statistics();
+
     /**
      * Process an incoming ACKNACK submessage.
      * @param writer_guid[in]      GUID of the writer the submessage is directed to.
@@ -258,13 +300,60 @@ class RTPSWriter : public Endpoint
     bool is_async_;
     //!Separate sending activated
     bool m_separateSendingEnabled;
+    //!Key hash always sent as inline QoS
+    bool send_key_hash_;
 
     LocatorList_t mAllShrinkedLocatorList;
 
     ResourceLimitedVector<GUID_t> all_remote_readers_;
 
+    //!Counters of the traffic of this writer.
+    WriterCounters statistics_counters_;
+
     void update_cached_info_nts(std::vector<LocatorList_t>& allLocatorLists);
 
+    //!Event used to send the batched changes when the latency budget expires.
+    LatencyBudgetFlush* latency_budget_flush_;
+
+    //!Estimated size of the changes batched in the next message.
+    uint32_t batched_bytes_;
+
+    //!Filter of the changes sent to each matched reader.
+    IReaderDataFilter* reader_data_filter_;
+
+    /**
+     * Account a change in the current batch, sending the batch first if the change would not fit in the
+     * same message, and start the latency budget for the batch.
+     * Has to be called with the writer mutex locked, before the change is added to the unsent changes.
+     * @param change Pointer to the change to batch.
+     */
+    void add_to_batch_nts(const CacheChange_t* change);
+
+    /**
+     * Send the changes batched during the latency budget.
+     * Has to be called with the writer mutex locked.
+     */
+    void flush_batch_nts();
+
+    /**
+     * Add a change to a message group from the calling thread, as a DATA submessage or, when the change is
+     * fragmented, as all its DATA_FRAG submessages.
+     * @param group Message group where the change is added.
+     * @param change Change to send.
+     * @param remote_readers GUIDs of the destination readers.
+     * @param locators Locators of the destination readers.
+     * @param expectsInlineQos True if the destination readers expect inline QoS.
+     * @param fragment_sent Optional function called with the number of each fragment added to the group.
+     * @return True if the whole change was added.
+     */
+    bool send_data_or_fragments(
+            RTPSMessageGroup& group,
+            const CacheChange_t& change,
+            const std::vector<GUID_t>& remote_readers,
+            const LocatorList_t& locators,
+            bool expectsInlineQos,
+            const std::function<void(FragmentNumber_t)>& fragment_sent = nullptr);
+
     /**
      * Initialize the header of hte CDRMessages.
      */
@@ -285,6 +374,13 @@ class RTPSWriter : public Endpoint
      */
     virtual bool change_removed_by_history(CacheChange_t* a_change)=0;
 
+    /**
+     * Get the number of changes still pending to be sent, counted once for each reader they are pending for.
+     * Has to be called with the writer mutex locked.
+     * @return Number of unsent changes.
+     */
+    virtual size_t unsent_changes_count_nts() const = 0;
+
 #if HAVE_SECURITY
     SerializedPayload_t encrypt_payload_;
 
@@ -20,7 +20,6 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 #include <algorithm>
 #include <mutex>
-#include <set>
 #include "../common/Types.h"
 #include "../common/Locator.h"
 #include "../common/SequenceNumber.h"
@@ -29,8 +28,6 @@
 #include "../attributes/WriterAttributes.h"
 #include "../../utils/collections/ResourceLimitedVector.hpp"
 
-#include <set>
-
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -44,7 +41,57 @@ class NackSupressionDuration;
  */
 class ReaderProxy
 {
+    struct ChangeState;
+
 public:
+
+    /**
+     * Unsent change of this reader, as informed by for_each_unsent_change.
+     * It only refers to the state kept by the proxy, so it is valid until the proxy is modified.
+     */
+    class UnsentChange
+    {
+    public:
+
+        UnsentChange(
+                const ChangeState& state,
+                const FragmentNumberSet_t* requested_fragments)
+            : state_(state)
+            , requested_fragments_(requested_fragments)
+        {
+        }
+
+        /**
+         * Get the cache change.
+         * @return Cache change, or nullptr if it is not valid.
+         */
+        CacheChange_t* getChange() const
+        {
+            return state_.change;
+        }
+
+        bool isRelevant() const
+        {
+            return state_.is_relevant;
+        }
+
+        bool isValid() const
+        {
+            return state_.change != nullptr;
+        }
+
+        /**
+         * Get the fragments not sent to the reader, up to the size of a FragmentNumberSet_t.
+         * @return Unsent fragments, starting with the lowest one. Empty if the change is not fragmented.
+         */
+        FragmentNumberSet_t getUnsentFragments() const;
+
+    private:
+
+        const ChangeState& state_;
+        const FragmentNumberSet_t* requested_fragments_;
+    };
+
     ~ReaderProxy();
 
     /**
@@ -69,11 +116,15 @@ public:
 
     /**
      * Called when a change is added to the writer's history.
-     * @param change Information regarding the change added.
+     * @param change Change added. It has to stay in the history until change_has_been_removed is called.
+     * @param status Initial status of the change for this reader.
+     * @param is_relevant Whether the change is relevant for this reader.
      * @param restart_nack_supression Whether nack-supression event should be restarted.
      */
     void add_change(
-            const ChangeForReader_t& change,
+            CacheChange_t* change,
+            ChangeForReaderStatus_t status,
+            bool is_relevant,
             bool restart_nack_supression);
 
     /**
@@ -82,6 +133,24 @@ public:
      */
     bool has_changes() const;
 
+    /**
+     * Check if there are changes pending to be sent to this reader.
+     * @return true when some change is UNSENT, false otherwise.
+     */
+    inline bool has_unsent_changes() const
+    {
+        return unsent_changes_count_ > 0;
+    }
+
+    /**
+     * Get the number of changes pending to be sent to this reader.
+     * @return Number of UNSENT changes.
+     */
+    inline size_t unsent_changes_count() const
+    {
+        return unsent_changes_count_;
+    }
+
     /**
      * Check if a specific change has been already acknowledged for this reader.
      * @param seq_num Sequence number of the change to be checked.
@@ -107,7 +176,7 @@ public:
     * Applies the given function object to every unsent change.
     * @param max_seq Maximum sequence number to be considered without including it.
     * @param f Function to apply. 
-    *          Will receive a SequenceNumber_t and a ChangeForReader_t*.
+    *          Will receive a SequenceNumber_t and a const UnsentChange*.
     *          The second argument may be nullptr for irrelevant changes.
     */
     template <class BinaryFunction>
@@ -122,16 +191,17 @@ public:
             while (it != changes_for_reader_.end())
             {
                 // Holes before this change are informed as irrelevant.
-                SequenceNumber_t change_seq = it->getSequenceNumber();
+                SequenceNumber_t change_seq = it->seq_num;
                 for(; current_seq < change_seq; ++current_seq)
                 { 
                     f(current_seq, nullptr);
                 }
 
                 // We then inform of this change if it is unsent, and go to the next one.
-                if (it->getStatus() == UNSENT)
+                if (it->status == UNSENT)
                 {
-                    f(current_seq, &(*it));
+                    UnsentChange unsent_change(*it, find_requested_fragments(it->seq_num));
+                    f(current_seq, &unsent_change);
                 }
                 ++current_seq;
                 ++it;
@@ -189,6 +259,28 @@ public:
      */
     bool perform_acknack_response();
 
+    /**
+     * Turns all REQUESTED changes into UNSENT.
+     * @param f Function to apply. Will receive the SequenceNumber_t of each change turned into UNSENT.
+     * @return true if at least one change changed its status, false otherwise.
+     */
+    template <class UnaryFunction>
+    bool perform_acknack_response(UnaryFunction f)
+    {
+        bool at_least_one_modified = false;
+        for (ChangeState& change : changes_for_reader_)
+        {
+            if (change.status == REQUESTED)
+            {
+                at_least_one_modified = true;
+                set_status(change, UNSENT);
+                f(change.seq_num);
+            }
+        }
+
+        return at_least_one_modified;
+    }
+
     /**
      * Call this to inform a change was removed from history.
      * @param seq_num Sequence number of the removed change.
@@ -307,14 +399,11 @@ public:
             const FragmentNumberSet_t& fragments_state);
 
     /**
-     * Filter a CacheChange_t, in this version always returns true.
+     * Filter a CacheChange_t using the reader data filter of the writer.
      * @param change
      * @return true if the change is relevant, false otherwise.
      */
-    inline bool rtps_is_relevant(CacheChange_t* change)
-    {
-        (void)change; return true;
-    };
+    bool rtps_is_relevant(CacheChange_t* change) const;
 
     /**
      * Get the highest fully acknowledged sequence number.
@@ -333,6 +422,33 @@ public:
 
 private:
 
+    /**
+     * State of a change with respect to this reader.
+     * Fragments are sent in order, so only the first fragment never sent is kept for each change. Fragments
+     * requested again by the reader are kept apart, only for the changes being repaired.
+     */
+    struct ChangeState
+    {
+        //!Sequence number of the change.
+        SequenceNumber_t seq_num;
+        //!Change in the writer's history.
+        CacheChange_t* change;
+        //!First fragment not sent yet. The following ones are not sent either.
+        FragmentNumber_t next_fragment;
+        //!Status of the change, as a ChangeForReaderStatus_t.
+        uint8_t status;
+        //!Boolean specifying if this change is relevant.
+        bool is_relevant;
+    };
+
+    //! Fragments requested again by the reader, lower than the next fragment of the change.
+    struct FragmentRequest
+    {
+        SequenceNumber_t seq_num;
+        //! The base is always the lowest requested fragment.
+        FragmentNumberSet_t fragments;
+    };
+
     //!Is this proxy active? I.e. does it have a remote reader associated?
     bool is_active_;
     //!Attributes of the Remote Reader
@@ -342,7 +458,9 @@ private:
     //!To fool RTPSMessageGroup when using this proxy as single destination
     ResourceLimitedVector<GUID_t> guid_as_vector_;
     //!Set of the changes and its state.
-    ResourceLimitedVector<ChangeForReader_t, std::true_type> changes_for_reader_;
+    ResourceLimitedVector<ChangeState, std::true_type> changes_for_reader_;
+    //!Fragments requested again by the reader, for the changes being repaired by fragments.
+    ResourceLimitedVector<FragmentRequest> requested_fragments_;
     //! Timed Event to manage the delay to mark a change as UNACKED after sending it.
     std::shared_ptr<NackSupressionDuration> nack_supression_event_;
     //! Are timed events enabled?
@@ -353,9 +471,11 @@ private:
     uint32_t last_nackfrag_count_;
 
     SequenceNumber_t changes_low_mark_;
+    //! Number of changes in changes_for_reader_ with UNSENT status.
+    size_t unsent_changes_count_;
 
-    using ChangeIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::iterator;
-    using ChangeConstIterator = ResourceLimitedVector<ChangeForReader_t, std::true_type>::const_iterator;
+    using ChangeIterator = ResourceLimitedVector<ChangeState, std::true_type>::iterator;
+    using ChangeConstIterator = ResourceLimitedVector<ChangeState, std::true_type>::const_iterator;
 
     void disable_timers();
 
@@ -369,6 +489,15 @@ private:
             ChangeForReaderStatus_t previous, 
             ChangeForReaderStatus_t next);
 
+    /**
+     * Change the status of a change, keeping the count of unsent changes.
+     * @param change Change to modify.
+     * @param status Status to adopt.
+     */
+    void set_status(
+            ChangeState& change,
+            ChangeForReaderStatus_t status);
+
     /*!
      * @brief Adds requested fragments. These fragments will be sent in next NackResponseDelay.
      * @param[in] seq_num Sequence number to be paired with the requested fragments.
@@ -392,6 +521,42 @@ private:
      * @return Iterator pointing to the change, changes_for_reader_.end() if not found.
      */
     ChangeConstIterator find_change(const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Find a change in the writer's history.
+     * @param seq_num Sequence number to find.
+     * @return Pointer to the change, nullptr if it is not in the history.
+     */
+    CacheChange_t* find_change_in_history(const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Find the fragments requested again for a change.
+     * @param seq_num Sequence number of the change.
+     * @return Pointer to the requested fragments, nullptr if there are none.
+     */
+    const FragmentNumberSet_t* find_requested_fragments(const SequenceNumber_t& seq_num) const;
+
+    /**
+     * @brief Marks fragments of a change as not sent.
+     * @param change State of the change.
+     * @param frag_set Fragments to send again.
+     */
+    void add_requested_fragments(
+            ChangeState& change,
+            const FragmentNumberSet_t& frag_set);
+
+    /**
+     * @brief Removes the fragments requested again for a change.
+     * @param seq_num Sequence number of the change.
+     */
+    void clear_requested_fragments(const SequenceNumber_t& seq_num);
+
+    /**
+     * @brief Removes the changes in the range [first, last) and their fragments information.
+     */
+    void erase_changes(
+            ChangeIterator first,
+            ChangeIterator last);
 };
 
 } /* namespace rtps */
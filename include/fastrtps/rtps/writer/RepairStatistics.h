@@ -0,0 +1,52 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RepairStatistics.h
+ */
+
+#ifndef REPAIR_STATISTICS_H
+#define REPAIR_STATISTICS_H
+
+#include <cstdint>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+/**
+ * Counters of the retransmissions a reliable writer sends in response to ACKNACK submessages.
+ * All the requests received during the same nack response delay are served together, so a change
+ * requested by several readers is only sent once to all of them.
+ * @ingroup WRITER_MODULE
+ */
+struct RepairStatistics
+{
+    //! Number of (reader, change) pairs requested through ACKNACK submessages.
+    uint64_t requested_changes = 0;
+    //! Number of DATA and DATA_FRAG submessages sent as repairs.
+    uint64_t repairs_sent = 0;
+    //! Number of repairs sent to a multicast locator.
+    uint64_t multicast_repairs = 0;
+    //! Number of repairs not sent thanks to aggregating the requests of several readers.
+    uint64_t saved_repairs = 0;
+    //! Payload bytes not sent thanks to aggregating the requests of several readers.
+    uint64_t saved_bytes = 0;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // REPAIR_STATISTICS_H
@@ -22,9 +22,11 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include "RTPSWriter.h"
+#include "RepairStatistics.h"
 #include "timedevent/PeriodicHeartbeat.h"
 #include "../../utils/collections/ResourceLimitedVector.hpp"
 #include <condition_variable>
+#include <map>
 #include <mutex>
 
 namespace eprosima {
@@ -33,6 +35,7 @@ namespace rtps {
 
 class ReaderProxy;
 class NackResponseDelay;
+template<class T> class RTPSWriterCollector;
 
 /**
  * Class StatefulWriter, specialization of RTPSWriter that maintains information of each matched Reader.
@@ -102,6 +105,12 @@ public:
      */
     bool change_removed_by_history(CacheChange_t* a_change) override;
 
+    /**
+     * Get the number of changes still pending to be sent, added up for all the ReaderProxy.
+     * @return Number of unsent changes.
+     */
+    size_t unsent_changes_count_nts() const override;
+
     /**
      * Method to indicate that there are changes not sent in some of all ReaderProxy.
      */
@@ -214,6 +223,14 @@ public:
 
     void perform_nack_response();
 
+    /**
+     * Get the counters of the repairs sent by this writer.
+     * @return Copy of the counters.
+     */
+    RepairStatistics get_repair_statistics();
+
+    WriterStatistics get_statistics() override;
+
     void perform_nack_supression(const GUID_t& reader_guid);
 
     /**
@@ -282,6 +299,61 @@ private:
 
     std::vector<std::unique_ptr<FlowController> > m_controllers;
 
+    //! Destination of the asynchronous sends to one set of readers.
+    struct AsyncDestination
+    {
+        //! Whether the rest of fields are filled for the current set of readers.
+        bool valid = false;
+        std::vector<GUID_t> guids;
+        LocatorList_t locators;
+        //! Locators used to repair changes requested by less than repair_multicast_threshold_ readers.
+        LocatorList_t unicast_locators;
+        bool expects_inline_qos = false;
+    };
+
+    /**
+     * Get the destination of a set of readers of async_changes_, filling it the first time it is used.
+     * @param readers_group Index of the set of readers in async_changes_.
+     * @return Destination of the set of readers.
+     */
+    const AsyncDestination& async_destination_nts_(uint32_t readers_group);
+
+    //! Forget the sets of readers and their destinations. Called when a reader is matched or unmatched.
+    void invalidate_async_destinations_nts_();
+
+    //! Changes pending to be sent asynchronously. Kept between sends to reuse its memory.
+    std::unique_ptr<RTPSWriterCollector<ReaderProxy*>> async_changes_;
+
+    //! Cached destination of each set of readers of async_changes_.
+    std::vector<AsyncDestination> async_destinations_;
+
+    //! Readers of the GAP being sent. Kept between sends to reuse its memory.
+    std::vector<GUID_t> gap_readers_;
+
+    //! Locators of the readers of the GAP being sent. Kept between sends to reuse its memory.
+    std::vector<LocatorList_t> gap_locator_lists_;
+
+    /**
+     * Get the locators a change should be sent to, updating the repair counters when it was requested by readers.
+     * @param sequence_number Sequence number of the change.
+     * @param payload_size Bytes of the change, or fragment, being sent.
+     * @param readers_count Number of readers the change is sent to.
+     * @param destination Destination of the set of readers.
+     * @return Locators the change should be sent to.
+     */
+    const LocatorList_t& repair_locators_nts_(
+            const SequenceNumber_t& sequence_number,
+            uint32_t payload_size,
+            size_t readers_count,
+            const AsyncDestination& destination);
+
+    //! Number of readers that requested each change in the last nack response windows, until it is repaired.
+    std::map<SequenceNumber_t, uint32_t> pending_repairs_;
+
+    const uint32_t repair_multicast_threshold_;
+
+    RepairStatistics repair_statistics_;
+
     StatefulWriter& operator=(const StatefulWriter&) = delete;
 };
 
@@ -69,6 +69,12 @@ class StatelessWriter : public RTPSWriter
      */
     bool change_removed_by_history(CacheChange_t* change) override;
 
+    /**
+     * Get the number of changes still pending to be sent.
+     * @return Number of unsent changes.
+     */
+    size_t unsent_changes_count_nts() const override;
+
     /**
      * Add a matched reader.
      * @param reader_attributes Attributes of the reader to add.
@@ -0,0 +1,74 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyBudgetFlush.h
+ *
+ */
+
+#ifndef  FASTRTPS_RTPS_WRITER_TIMEDEVENT_LATENCYBUDGETFLUSH_H_
+#define  FASTRTPS_RTPS_WRITER_TIMEDEVENT_LATENCYBUDGETFLUSH_H_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "../../resources/TimedEvent.h"
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSWriter;
+
+/**
+ * LatencyBudgetFlush class used to send the changes batched by a synchronous writer
+ * when its latency budget expires.
+ * @ingroup WRITER_MODULE
+ */
+class LatencyBudgetFlush : public TimedEvent
+{
+public:
+    /**
+     * Construct a LatencyBudgetFlush event.
+     *
+     * @param writer           Pointer to the RTPSWriter creating this event
+     * @param interval_in_ms   Event interval in miliseconds
+     */
+    LatencyBudgetFlush(
+            RTPSWriter* writer,
+            double interval_in_ms);
+
+    virtual ~LatencyBudgetFlush();
+
+    /**
+     * Method invoked when the event occurs
+     *
+     * @param code Code representing the status of the event
+     * @param msg Message associated to the event
+     */
+    void event(
+            EventCode code,
+            const char* msg = nullptr) override;
+
+private:
+
+    //! Associated writer
+    RTPSWriter* writer_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /*  FASTRTPS_RTPS_WRITER_TIMEDEVENT_LATENCYBUDGETFLUSH_H_ */
@@ -22,6 +22,7 @@
 
 #include "../rtps/common/Guid.h"
 #include "../attributes/SubscriberAttributes.h"
+#include "../rtps/common/EntityStatistics.h"
 
 
 
@@ -101,6 +102,12 @@ public:
      */
     uint64_t getUnreadCount() const;
 
+    /**
+     * Get a snapshot of the counters of the associated RTPSReader.
+     * @return Copy of the counters.
+     */
+    rtps::ReaderStatistics get_statistics() const;
+
 private:
     SubscriberImpl* mp_impl;
 };
@@ -99,6 +99,23 @@ class SubscriberHistory: public rtps::ReaderHistory
          */
         bool remove_change_sub(rtps::CacheChange_t* change,t_v_Inst_Caches::iterator* vit=nullptr);
 
+        /**
+         * Check whether the lifespan of a received change has already expired.
+         * @param change Pointer to the change.
+         * @return True if the change has expired.
+         */
+        bool is_change_expired(const rtps::CacheChange_t* change) const override;
+
+        /**
+         * Remove the changes whose lifespan, given by the writer that sent them, has expired.
+         * @param now Current time.
+         * @param next_expiration Expiration time of the first change remaining in the history to expire.
+         * @return True if there are changes with finite lifespan remaining in the history.
+         */
+        bool remove_expired_changes(
+                const rtps::Time_t& now,
+                rtps::Time_t& next_expiration);
+
         //!Increase the unread count.
         inline void increaseUnreadCount()
         {
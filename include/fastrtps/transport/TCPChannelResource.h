@@ -72,6 +72,7 @@ protected:
     std::mutex write_mutex_;
     std::recursive_mutex pending_logical_mutex_;
     std::atomic<eConnectionStatus> connection_status_;
+    std::atomic<int32_t> transport_priority_;
 
 public:
 
@@ -131,6 +132,14 @@ public:
 
     virtual void set_options(const TCPTransportDescriptor* options) = 0;
 
+    /**
+     * Requests the traffic of this connection to be marked with the given transport priority.
+     * The connection is shared by all the writers sending to the remote locator, so it is marked with the
+     * highest priority requested so far.
+     * @param priority Value of the TransportPriority QoS of the sending writer.
+     */
+    void transport_priority(int32_t priority);
+
     virtual void cancel() = 0;
 
     virtual void close() = 0;
@@ -180,6 +189,9 @@ protected:
         return old;
     }
 
+    //! Marks the traffic of the underlying socket with the given transport priority.
+    virtual void apply_transport_priority(int32_t priority) = 0;
+
     void add_logical_port_response(const TCPTransactionId &id, bool success, RTCPMessageManager* rtcp_manager);
 
     void process_check_logical_ports_response(
@@ -66,6 +66,8 @@ public:
 
     void set_options(const TCPTransportDescriptor* options) override;
 
+    void apply_transport_priority(int32_t priority) override;
+
     void cancel() override;
     void close() override;
     void shutdown(asio::socket_base::shutdown_type what) override;
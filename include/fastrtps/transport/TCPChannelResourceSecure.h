@@ -68,6 +68,8 @@ class TCPChannelResourceSecure : public TCPChannelResource
 
         void set_options(const TCPTransportDescriptor* options) override;
 
+        void apply_transport_priority(int32_t priority) override;
+
         void set_tls_verify_mode(const TCPTransportDescriptor* options);
 
         void cancel() override;
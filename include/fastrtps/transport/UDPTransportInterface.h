@@ -64,6 +64,17 @@ public:
            SendResourceList& sender_resource_list,
            const Locator_t&) override;
 
+   /**
+   * Opens an output socket bound to the same local address and outbound interface as the given one, whose traffic
+   * is marked with the given transport priority.
+   * @param socket Output socket used as template.
+   * @param transport_priority Value of the TransportPriority QoS. Must be greater than zero.
+   * @return The new socket. Throws asio::system_error when it cannot be opened or bound.
+   */
+   eProsimaUDPSocket OpenPriorityOutputSocket(
+           eProsimaUDPSocket& socket,
+           int32_t transport_priority);
+
    /**
    * Blocking Receive from the specified channel.
    * @param p_channel_resource Pointer to the channer resource that stores the socket.
@@ -57,10 +57,12 @@ private:
     uint8_t drop_ack_nack_messages_percentage_;
     std::vector<SequenceNumber_t> sequence_number_data_messages_to_drop_;
     uint8_t percentage_of_messages_to_drop_;
+    bool remove_info_timestamps_;
 
     bool log_drop(const octet* buffer, uint32_t size);
     bool packet_should_drop(const octet* send_buffer, uint32_t send_buffer_size);
     bool random_chance_drop();
+    uint32_t remove_info_timestamps(octet* buffer, uint32_t size);
 };
 
 } // namespace rtps
@@ -37,6 +37,9 @@ typedef struct test_UDPv4TransportDescriptor : public SocketTransportDescriptor{
    uint8_t percentageOfMessagesToDrop;
    std::vector<SequenceNumber_t> sequenceNumberDataMessagesToDrop;
 
+   // Sends the messages without their INFO_TS submessages, as implementations not sending source timestamps.
+   bool removeInfoTimestamps;
+
    uint32_t dropLogLength; // logs dropped packets.
 
    RTPS_DllAPI test_UDPv4TransportDescriptor();
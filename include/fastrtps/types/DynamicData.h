@@ -340,6 +340,10 @@ protected:
     static size_t getMaxCdrSerializedSize(const DynamicType_ptr type, size_t current_alignment = 0);
     void serialize(eprosima::fastcdr::Cdr &cdr) const;
     void serializeKey(eprosima::fastcdr::Cdr &cdr) const;
+    // Reads a sample of the given type from cdr, serializing into key the same key that serializeKey would.
+    // Returns false if the key of the type cannot be obtained without deserializing the sample.
+    static bool extractKey(const DynamicType_ptr type, eprosima::fastcdr::Cdr &cdr, eprosima::fastcdr::Cdr &key,
+        bool copy = false);
 
     DynamicType_ptr mType;
     std::map<MemberId, MemberDescriptor*> mDescriptors;
@@ -36,6 +36,8 @@ public:
     RTPS_DllAPI void deleteData(void * data);
     RTPS_DllAPI bool deserialize(eprosima::fastrtps::rtps::SerializedPayload_t *payload, void *data);
     RTPS_DllAPI bool getKey(void *data, eprosima::fastrtps::rtps::InstanceHandle_t *ihandle, bool force_md5=false);
+    RTPS_DllAPI bool getKeyFromPayload(eprosima::fastrtps::rtps::SerializedPayload_t *payload,
+            eprosima::fastrtps::rtps::InstanceHandle_t *ihandle, bool force_md5=false);
     RTPS_DllAPI std::function<uint32_t()> getSerializedSizeProvider(void* data);
     RTPS_DllAPI bool serialize(void *data, eprosima::fastrtps::rtps::SerializedPayload_t *payload);
 
@@ -48,6 +50,10 @@ protected:
 
     void UpdateDynamicTypeInfo();
 
+    // Fills the handle from the key serialized in m_keyBuffer.
+    void ComputeKeyHash(size_t keyBufferSize, size_t keyLength, eprosima::fastrtps::rtps::InstanceHandle_t* handle,
+        bool force_md5);
+
     DynamicType_ptr mDynamicType;
     MD5 m_md5;
     unsigned char* m_keyBuffer;
@@ -20,6 +20,16 @@
 #ifndef STRINGMATCHING_H_
 #define STRINGMATCHING_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include "../fastrtps_dll.h"
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
@@ -38,6 +48,53 @@ class StringMatching
          */
         static bool matchString(const char* pattern,const char* input);
 };
+
+/**
+ * Class StringMatchingIndex, a set of expressions compiled to be matched against many strings.
+ * Each expression is added with a position, and lookups return the lowest position of the expressions matching
+ * a string, with the same semantics as StringMatching::matchString.
+ * Literal expressions are found with a hash lookup, and expressions whose only wildcard is a trailing '*' with
+ * a hash lookup per distinct prefix length, so only the rest of expressions are evaluated one by one.
+ @ingroup UTILITIES_MODULE
+ */
+class RTPS_DllAPI StringMatchingIndex
+{
+    public:
+        //! Value returned when no expression matches.
+        static const size_t npos = static_cast<size_t>(-1);
+
+        /**
+         * Adds an expression to the index.
+         * @param expression Expression, which may contain wildcards.
+         * @param position Position of the expression. Must not be lower than the one of previous expressions.
+         */
+        void add(const std::string& expression, size_t position);
+
+        /**
+         * Finds the first expression matching a string.
+         * @param input String to match. It may also contain wildcards, in which case all expressions are evaluated.
+         * @return Position of the first matching expression, or npos if none matches.
+         */
+        size_t find_first(const char* input) const;
+
+        //! Checks whether any expression matches a string.
+        bool matches(const char* input) const { return find_first(input) != npos; }
+
+        //! Removes all the expressions.
+        void clear();
+
+        //! Checks whether the index has no expressions.
+        bool empty() const { return expressions_.empty(); }
+
+        //! Returns the number of expressions in the index.
+        size_t size() const { return expressions_.size(); }
+
+    private:
+        std::unordered_map<std::string, size_t> literals_;
+        std::map<size_t, std::unordered_map<std::string, size_t>> prefixes_;
+        std::vector<std::pair<std::string, size_t>> wildcards_;
+        std::vector<std::pair<std::string, size_t>> expressions_;
+};
 }
 } /* namespace rtps */
 } /* namespace eprosima */
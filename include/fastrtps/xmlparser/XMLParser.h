@@ -374,6 +374,11 @@ class XMLParser
         LatencyBudgetQosPolicy& latencyBudget,
         uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLTransportPriorityQos(
+        tinyxml2::XMLElement* elem,
+        TransportPriorityQosPolicy& transportPriority,
+        uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLDeadlineQos(
         tinyxml2::XMLElement* elem,
         DeadlineQosPolicy& deadline,
@@ -414,6 +419,11 @@ class XMLParser
         rtps::ThroughputControllerDescriptor& throughputController,
         uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLFlowScheduling(
+        tinyxml2::XMLElement* elem,
+        rtps::FlowSchedulingDescriptor& flowScheduling,
+        uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLPortParameters(
         tinyxml2::XMLElement* elem,
         rtps::PortParameters& port,
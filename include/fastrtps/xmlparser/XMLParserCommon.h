@@ -93,6 +93,8 @@ extern const char* IP6_TO_SEND;
 extern const char* THROUGHPUT_CONT;
 extern const char* USER_TRANS;
 extern const char* USE_BUILTIN_TRANS;
+extern const char* SHARED_EVENT_THREADS;
+extern const char* SUBMESSAGE_BATCHING_WINDOW;
 extern const char* PROPERTIES_POLICY;
 extern const char* NAME;
 
@@ -106,6 +108,8 @@ extern const char* REM_LOC_LIST;
 //extern const char* THROUGHPUT_CONT;
 extern const char* EXP_INLINE_QOS;
 extern const char* HIST_MEM_POLICY;
+extern const char* FLOW_SCHEDULING;
+extern const char* SEND_KEY_HASH;
 //extern const char* PROPERTIES_POLICY;
 extern const char* USER_DEF_ID;
 extern const char* ENTITY_ID;
@@ -120,6 +124,7 @@ extern const char* PROPAGATE;
 extern const char* PREALLOCATED;
 extern const char* PREALLOCATED_WITH_REALLOC;
 extern const char* DYNAMIC;
+extern const char* DYNAMIC_REUSABLE;
 extern const char* LOCATOR;
 extern const char* UDPv4_LOCATOR;
 extern const char* UDPv6_LOCATOR;
@@ -167,6 +172,7 @@ extern const char* PARTITION;
 extern const char* TOPIC_DATA;
 extern const char* GROUP_DATA;
 extern const char* PUB_MODE;
+extern const char* TRANSPORT_PRIORITY;
 
 extern const char* SYNCHRONOUS;
 extern const char* ASYNCHRONOUS;
@@ -209,6 +215,8 @@ extern const char* DEPTH;
 extern const char* ALLOCATED_SAMPLES;
 extern const char* BYTES_PER_SECOND;
 extern const char* PERIOD_MILLISECS;
+extern const char* WEIGHT;
+extern const char* PRIORITY;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -234,6 +242,10 @@ extern const char* STATIC_ENDPOINT_XML;
 extern const char* READER_HIST_MEM_POLICY;
 extern const char* WRITER_HIST_MEM_POLICY;
 extern const char* MUTATION_TRIES;
+extern const char* DISCOVERY_PROTOCOL;
+extern const char* DISCOVERY_SERVERS_LIST;
+extern const char* DISCOVERY_CLIENT;
+extern const char* DISCOVERY_SERVER;
 extern const char* ACCESS_SCOPE;
 
 // Endpoint parser
@@ -44,6 +44,9 @@
 
 #include <fastrtps/log/Log.h>
 
+#include <algorithm>
+#include <limits>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -171,6 +174,8 @@ Publisher* ParticipantImpl::createPublisher(
 
     WriterAttributes watt;
     watt.throughputController = att.throughputController;
+    watt.flowScheduling = att.flowScheduling;
+    watt.send_key_hash = att.sendKeyHash;
     watt.endpoint.durabilityKind = att.qos.m_durability.durabilityKind();
     watt.endpoint.endpointKind = WRITER;
     watt.endpoint.multicastLocatorList = att.multicastLocatorList;
@@ -180,6 +185,8 @@ Publisher* ParticipantImpl::createPublisher(
     watt.endpoint.remoteLocatorList = att.remoteLocatorList;
     watt.mode = att.qos.m_publishMode.kind == eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
     watt.endpoint.properties = att.properties;
+    watt.endpoint.transport_priority = static_cast<int32_t>(std::min<uint32_t>(
+        att.qos.m_transportPriority.value, std::numeric_limits<int32_t>::max()));
     if(att.getEntityID()>0)
     {
         watt.endpoint.setEntityID((uint8_t)att.getEntityID());
@@ -190,6 +197,7 @@ Publisher* ParticipantImpl::createPublisher(
     }
     watt.times = att.times;
     watt.matched_readers_allocation = att.matched_subscriber_allocation;
+    watt.latency_budget = att.qos.m_latencyBudget.duration;
 
     // TODO(Ricardo) Remove in future
     // Insert topic_name and partitions
@@ -496,3 +504,8 @@ bool ParticipantImpl::get_remote_reader_info(
 {
     return mp_rtpsParticipant->get_remote_reader_info(readerGuid, returnedInfo);
 }
+
+ParticipantStatistics ParticipantImpl::get_statistics() const
+{
+    return mp_rtpsParticipant->get_statistics();
+}
@@ -158,6 +158,8 @@ class ParticipantImpl
         const rtps::GUID_t& readerGuid,
         rtps::ReaderProxyData& returnedInfo);
 
+    rtps::ParticipantStatistics get_statistics() const;
+
     private:
     //!Participant Attributes
     ParticipantAttributes m_att;
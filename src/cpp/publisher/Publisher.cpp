@@ -89,3 +89,8 @@ bool Publisher::updateAttributes(const PublisherAttributes& att)
 {
     return mp_impl->updateAttributes(att);
 }
+
+WriterStatistics Publisher::get_statistics() const
+{
+    return mp_impl->get_statistics();
+}
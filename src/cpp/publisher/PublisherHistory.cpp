@@ -64,9 +64,7 @@ PublisherHistory::~PublisherHistory() {
 }
 
 
-bool PublisherHistory::add_pub_change(
-        CacheChange_t* change,
-        WriteParams &wparams,
+bool PublisherHistory::make_room(
         std::unique_lock<std::recursive_timed_mutex>& lock,
         std::chrono::time_point<std::chrono::steady_clock> max_blocking_time)
 {
@@ -90,6 +88,20 @@ bool PublisherHistory::add_pub_change(
         }
     }
 
+    return true;
+}
+
+bool PublisherHistory::add_pub_change(
+        CacheChange_t* change,
+        WriteParams &wparams,
+        std::unique_lock<std::recursive_timed_mutex>& lock,
+        std::chrono::time_point<std::chrono::steady_clock> max_blocking_time)
+{
+    if(!make_room(lock, max_blocking_time))
+    {
+        return false;
+    }
+
     assert(!m_isHistoryFull);
 
     bool returnedValue = false;
@@ -286,3 +298,37 @@ bool PublisherHistory::remove_change_g(CacheChange_t* a_change)
 {
     return remove_change_pub(a_change);
 }
+
+bool PublisherHistory::remove_expired_changes(
+        const Time_t& now,
+        const Duration_t& lifespan,
+        Time_t& next_expiration)
+{
+    if(mp_writer == nullptr || mp_mutex == nullptr)
+    {
+        logError(RTPS_HISTORY,"You need to create a Writer with this History before using it");
+        return false;
+    }
+
+    std::lock_guard<std::recursive_timed_mutex> guard(*this->mp_mutex);
+
+    // Changes are ordered by sequence number, which is also the order of their source timestamps.
+    while(m_changes.size() > 0)
+    {
+        CacheChange_t* change = m_changes.front();
+        Time_t expiration = change->sourceTimestamp + lifespan;
+        if(now < expiration)
+        {
+            next_expiration = expiration;
+            return true;
+        }
+
+        logInfo(PUBLISHER, "Removing change " << change->sequenceNumber << " because its lifespan expired");
+        if(!remove_change_pub(change))
+        {
+            break;
+        }
+    }
+
+    return false;
+}
@@ -19,6 +19,9 @@
 
 #include "PublisherImpl.h"
 #include "../participant/ParticipantImpl.h"
+#include "../timedevent/TimedCallback.h"
+#include "../rtps/participant/RTPSParticipantImpl.h"
+#include "../utils/Tracepoints.hpp"
 #include <fastrtps/publisher/Publisher.h>
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/publisher/PublisherListener.h>
@@ -28,9 +31,11 @@
 
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
 #include <fastrtps/rtps/RTPSDomain.h>
+#include <fastrtps/rtps/resources/ResourceEvent.h>
 
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/TimeConversion.h>
+#include <fastrtps/utils/eClock.h>
 
 using namespace eprosima::fastrtps;
 using namespace ::rtps;
@@ -58,6 +63,9 @@ PublisherImpl::PublisherImpl(
     , mp_userPublisher(nullptr)
     , mp_rtpsParticipant(nullptr)
     , high_mark_for_frag_(0)
+    , lifespan_timer_(nullptr)
+    , lifespan_scheduled_(false)
+    , in_flight_changes_(0)
 {
 }
 
@@ -68,6 +76,9 @@ PublisherImpl::~PublisherImpl()
         logInfo(PUBLISHER, this->getGuid().entityId << " in topic: " << this->m_att.topic.topicName);
     }
 
+    // Timer has to be destroyed before the writer, as its callback uses it.
+    delete(lifespan_timer_);
+
     RTPSDomain::removeRTPSWriter(mp_writer);
     delete(this->mp_userPublisher);
 }
@@ -87,7 +98,6 @@ bool PublisherImpl::create_new_change_with_params(
         void* data,
         WriteParams& wparams)
 {
-
     /// Preconditions
     if (data == nullptr)
     {
@@ -105,6 +115,9 @@ bool PublisherImpl::create_new_change_with_params(
         }
     }
 
+    // Every return from here on emits WRITE_END, with sequence number 0 when the sample is not written.
+    FASTRTPS_TRACE_WRITE_BEGIN(mp_writer->getGuid());
+
     InstanceHandle_t handle;
     if(m_att.topic.topicKind == WITH_KEY)
     {
@@ -115,84 +128,190 @@ bool PublisherImpl::create_new_change_with_params(
         mp_type->getKey(data,&handle,is_key_protected);
     }
 
-    // Block lowlevel writer
     auto max_blocking_time = std::chrono::steady_clock::now() +
         std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(m_att.qos.m_reliability.max_blocking_time));
     std::unique_lock<std::recursive_timed_mutex> lock(mp_writer->getMutex(), std::defer_lock);
 
-    if(lock.try_lock_until(max_blocking_time))
+    // The payload is reserved and serialized without blocking the lowlevel writer, so the serialization of big
+    // samples doesn't delay the processing of ACKNACKs, heartbeats or other writing threads.
+    {
+        std::lock_guard<std::mutex> in_flight_guard(in_flight_mutex_);
+        ++in_flight_changes_;
+    }
+    CacheChange_t* ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+    if(ch != nullptr && changeKind == ALIVE)
+    {
+        //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
+        if(!mp_type->serialize(data, &ch->serializedPayload))
+        {
+            logWarning(RTPS_WRITER,"RTPSWriter:Serialization returns false";);
+            m_history.release_Cache(ch);
+            in_flight_change_done();
+            FASTRTPS_TRACE_WRITE_END(mp_writer->getGuid(), SequenceNumber_t());
+            return false;
+        }
+    }
+
+    // Block lowlevel writer
+    if(!lock.try_lock_until(max_blocking_time))
     {
-        CacheChange_t* ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
         if(ch != nullptr)
         {
-            if(changeKind == ALIVE)
-            {
-                //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
-                if(!mp_type->serialize(data, &ch->serializedPayload))
-                {
-                    logWarning(RTPS_WRITER,"RTPSWriter:Serialization returns false";);
-                    m_history.release_Cache(ch);
-                    return false;
-                }
-            }
+            m_history.release_Cache(ch);
+        }
+        in_flight_change_done();
+        FASTRTPS_TRACE_WRITE_END(mp_writer->getGuid(), SequenceNumber_t());
+        return false;
+    }
 
-            //TODO(Ricardo) This logic in a class. Then a user of rtps layer can use it.
-            if(high_mark_for_frag_ == 0)
-            {
-                uint32_t max_data_size = mp_writer->getMaxDataSize();
-                uint32_t writer_throughput_controller_bytes =
-                    mp_writer->calculateMaxDataSize(m_att.throughputController.bytesPerPeriod);
-                uint32_t participant_throughput_controller_bytes =
-                    mp_writer->calculateMaxDataSize(mp_rtpsParticipant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod);
-
-                high_mark_for_frag_ =
-                    max_data_size > writer_throughput_controller_bytes ?
-                    writer_throughput_controller_bytes :
-                    (max_data_size > participant_throughput_controller_bytes ?
-                     participant_throughput_controller_bytes :
-                     max_data_size);
-            }
+    if(ch == nullptr)
+    {
+        in_flight_change_done();
+
+        // Every cache is in the history or being filled by another thread. Keep the lowlevel writer blocked until the
+        // change is added, so the cache freed for it cannot be taken by other threads.
+        ch = reserve_change_nts(changeKind, data, handle, lock, max_blocking_time);
+        if(ch == nullptr)
+        {
+            FASTRTPS_TRACE_WRITE_END(mp_writer->getGuid(), SequenceNumber_t());
+            return false;
+        }
 
-            uint32_t final_high_mark_for_frag = high_mark_for_frag_;
+        if(changeKind == ALIVE && !mp_type->serialize(data, &ch->serializedPayload))
+        {
+            logWarning(RTPS_WRITER,"RTPSWriter:Serialization returns false";);
+            m_history.release_Cache(ch);
+            notify_cache_waiters();
+            FASTRTPS_TRACE_WRITE_END(mp_writer->getGuid(), SequenceNumber_t());
+            return false;
+        }
+    }
+    else
+    {
+        // The change is added below, and waiting threads are notified then.
+        std::lock_guard<std::mutex> in_flight_guard(in_flight_mutex_);
+        --in_flight_changes_;
+    }
+
+    //TODO(Ricardo) This logic in a class. Then a user of rtps layer can use it.
+    if(high_mark_for_frag_ == 0)
+    {
+        uint32_t max_data_size = mp_writer->getMaxDataSize();
+        uint32_t writer_throughput_controller_bytes =
+            mp_writer->calculateMaxDataSize(m_att.throughputController.bytesPerPeriod);
+        uint32_t participant_throughput_controller_bytes =
+            mp_writer->calculateMaxDataSize(mp_rtpsParticipant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod);
+
+        high_mark_for_frag_ =
+            max_data_size > writer_throughput_controller_bytes ?
+            writer_throughput_controller_bytes :
+            (max_data_size > participant_throughput_controller_bytes ?
+             participant_throughput_controller_bytes :
+             max_data_size);
+    }
+
+    uint32_t final_high_mark_for_frag = high_mark_for_frag_;
 
-            // If needed inlineqos for related_sample_identity, then remove the inlinqos size from final fragment size.
-            if(wparams.related_sample_identity() != SampleIdentity::unknown())
+    // If needed inlineqos for related_sample_identity, then remove the inlinqos size from final fragment size.
+    if(wparams.related_sample_identity() != SampleIdentity::unknown())
+    {
+        final_high_mark_for_frag -= 32;
+    }
+
+    // If it is big data, fragment it.
+    // In SYNCHRONOUS_PUBLISH_MODE the fragments are sent from the calling thread.
+    if(ch->serializedPayload.length > final_high_mark_for_frag)
+    {
+        /// Fragment the data.
+        // Set the fragment size to the cachechange.
+        // Note: high_mark will always be a value that can be casted to uint16_t)
+        ch->setFragmentSize((uint16_t)final_high_mark_for_frag);
+    }
+
+    bool added = this->m_history.add_pub_change(ch, wparams, lock, max_blocking_time);
+    if(!added)
+    {
+        m_history.release_Cache(ch);
+    }
+
+    // Threads waiting for a cache may now make room in the history or reserve the released one.
+    notify_cache_waiters();
+
+    if(!added)
+    {
+        FASTRTPS_TRACE_WRITE_END(mp_writer->getGuid(), SequenceNumber_t());
+        return false;
+    }
+
+    if(m_att.qos.m_lifespan.duration != c_TimeInfinite)
+    {
+        schedule_lifespan_timer(ch->sourceTimestamp + m_att.qos.m_lifespan.duration);
+    }
+
+    FASTRTPS_TRACE_WRITE_END(mp_writer->getGuid(), ch->sequenceNumber);
+
+    return true;
+}
+
+CacheChange_t* PublisherImpl::reserve_change_nts(
+        ChangeKind_t changeKind,
+        void* data,
+        const InstanceHandle_t& handle,
+        std::unique_lock<std::recursive_timed_mutex>& lock,
+        std::chrono::time_point<std::chrono::steady_clock> max_blocking_time)
+{
+    CacheChange_t* ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
+
+    while(ch == nullptr)
+    {
+        if(m_history.isFull())
+        {
+            if(!m_history.make_room(lock, max_blocking_time))
             {
-                final_high_mark_for_frag -= 32;
+                return nullptr;
             }
-
-            // If it is big data, fragment it.
-            if(ch->serializedPayload.length > final_high_mark_for_frag)
+        }
+        else
+        {
+            std::unique_lock<std::mutex> in_flight_lock(in_flight_mutex_);
+            if(in_flight_changes_ == 0)
             {
-                // Check ASYNCHRONOUS_PUBLISH_MODE is being used, but it is an error case.
-                if( m_att.qos.m_publishMode.kind != ASYNCHRONOUS_PUBLISH_MODE)
-                {
-                    logError(PUBLISHER, "Data cannot be sent. It's serialized size is " <<
-                            ch->serializedPayload.length << "' which exceeds the maximum payload size of '" <<
-                            final_high_mark_for_frag << "' and therefore ASYNCHRONOUS_PUBLISH_MODE must be used.");
-                    m_history.release_Cache(ch);
-                    return false;
-                }
-
-                /// Fragment the data.
-                // Set the fragment size to the cachechange.
-                // Note: high_mark will always be a value that can be casted to uint16_t)
-                ch->setFragmentSize((uint16_t)final_high_mark_for_frag);
+                logWarning(PUBLISHER, "No free cache for the new change");
+                return nullptr;
             }
 
-            if(!this->m_history.add_pub_change(ch, wparams, lock, max_blocking_time))
+            // The free caches are being filled by other threads. They notify when adding or releasing them, so
+            // in_flight_mutex_ is taken before releasing the writer mutex to not miss their notification.
+            lock.unlock();
+            bool timeout = in_flight_changes_cond_.wait_until(in_flight_lock, max_blocking_time) ==
+                std::cv_status::timeout;
+            in_flight_lock.unlock();
+
+            if(timeout || !lock.try_lock_until(max_blocking_time))
             {
-                m_history.release_Cache(ch);
-                return false;
+                logWarning(PUBLISHER, "No free cache for the new change before max_blocking_time");
+                return nullptr;
             }
-
-            return true;
         }
+
+        ch = mp_writer->new_change(mp_type->getSerializedSizeProvider(data), changeKind, handle);
     }
 
-    return false;
+    return ch;
 }
 
+void PublisherImpl::in_flight_change_done()
+{
+    std::lock_guard<std::mutex> in_flight_guard(in_flight_mutex_);
+    --in_flight_changes_;
+    in_flight_changes_cond_.notify_all();
+}
+
+void PublisherImpl::notify_cache_waiters()
+{
+    std::lock_guard<std::mutex> in_flight_guard(in_flight_mutex_);
+    in_flight_changes_cond_.notify_all();
+}
 
 bool PublisherImpl::removeMinSeqChange()
 {
@@ -208,6 +327,11 @@ const GUID_t& PublisherImpl::getGuid()
 {
     return mp_writer->getGuid();
 }
+
+WriterStatistics PublisherImpl::get_statistics() const
+{
+    return mp_writer->get_statistics();
+}
 //
 bool PublisherImpl::updateAttributes(const PublisherAttributes& att)
 {
@@ -316,3 +440,46 @@ bool PublisherImpl::wait_for_all_acked(const Time_t& max_wait)
 {
     return mp_writer->wait_for_all_acked(max_wait);
 }
+
+void PublisherImpl::schedule_lifespan_timer(const Time_t& expiration)
+{
+    if(lifespan_scheduled_ && lifespan_next_expiration_ <= expiration)
+    {
+        return;
+    }
+
+    if(lifespan_timer_ == nullptr)
+    {
+        rtps::ResourceEvent& event_resource = mp_writer->getRTPSParticipant()->getEventResource();
+        lifespan_timer_ = new TimedCallback(std::bind(&PublisherImpl::lifespan_expired, this), 0,
+                event_resource.getIOService(), event_resource.getThread());
+    }
+
+    Time_t now;
+    eClock clock;
+    clock.setTimeNow(&now);
+
+    lifespan_timer_->cancel_timer();
+    lifespan_timer_->update_interval_millisec(expiration > now ?
+            TimeConv::Time_t2MilliSecondsDouble(expiration - now) : 0);
+    lifespan_timer_->restart_timer();
+
+    lifespan_next_expiration_ = expiration;
+    lifespan_scheduled_ = true;
+}
+
+void PublisherImpl::lifespan_expired()
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_writer->getMutex());
+    lifespan_scheduled_ = false;
+
+    Time_t now;
+    eClock clock;
+    clock.setTimeNow(&now);
+
+    Time_t next_expiration;
+    if(m_history.remove_expired_changes(now, m_att.qos.m_lifespan.duration, next_expiration))
+    {
+        schedule_lifespan_timer(next_expiration);
+    }
+}
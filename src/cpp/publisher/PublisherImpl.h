@@ -24,6 +24,7 @@
 
 #include <fastrtps/rtps/common/Locator.h>
 #include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/rtps/common/EntityStatistics.h>
 
 #include <fastrtps/attributes/PublisherAttributes.h>
 
@@ -31,6 +32,9 @@
 
 #include <fastrtps/rtps/writer/WriterListener.h>
 
+#include <condition_variable>
+#include <mutex>
+
 namespace eprosima {
 namespace fastrtps{
 namespace rtps
@@ -45,6 +49,7 @@ class TopicDataType;
 class PublisherListener;
 class ParticipantImpl;
 class Publisher;
+class TimedCallback;
 
 
 /**
@@ -108,6 +113,12 @@ class PublisherImpl
      */
     const rtps::GUID_t& getGuid();
 
+    /**
+     * Get a snapshot of the counters of the associated RTPSWriter.
+     * @return Copy of the counters.
+     */
+    rtps::WriterStatistics get_statistics() const;
+
     /**
      * Update the Attributes of the publisher;
      * @param att Reference to a PublisherAttributes object to update the parameters;
@@ -130,6 +141,42 @@ class PublisherImpl
     bool wait_for_all_acked(const rtps::Time_t& max_wait);
 
     private:
+
+    /**
+     * Schedule the lifespan timer to expire at the given time, unless it is already scheduled earlier.
+     * Must be called with the writer mutex locked.
+     * @param expiration Time when the oldest change in the history expires.
+     */
+    void schedule_lifespan_timer(const rtps::Time_t& expiration);
+
+    /**
+     * Method called when the lifespan timer expires. Removes expired changes from the history.
+     */
+    void lifespan_expired();
+
+    /**
+     * Finish with a change filled without the writer mutex locked, and wake up the threads waiting for a cache.
+     */
+    void in_flight_change_done();
+
+    /**
+     * Wake up the threads waiting for a cache, after a change was added to the history or released.
+     */
+    void notify_cache_waiters();
+
+    /**
+     * Reserve a change when the pool had no free cache. Must be called with the writer mutex locked.
+     * Makes room in the history when it is full, or waits for the changes being filled by other threads to be added
+     * to the history or released, until max_blocking_time.
+     * @return The reserved change, or nullptr if no cache was freed on time.
+     */
+    rtps::CacheChange_t* reserve_change_nts(
+            rtps::ChangeKind_t changeKind,
+            void* data,
+            const rtps::InstanceHandle_t& handle,
+            std::unique_lock<std::recursive_timed_mutex>& lock,
+            std::chrono::time_point<std::chrono::steady_clock> max_blocking_time);
+
     ParticipantImpl* mp_participant;
     //! Pointer to the associated Data Writer.
 	rtps::RTPSWriter* mp_writer;
@@ -157,6 +204,24 @@ class PublisherImpl
 	rtps::RTPSParticipant* mp_rtpsParticipant;
 
     uint32_t high_mark_for_frag_;
+
+    //! Timer used to remove the changes whose lifespan has expired.
+    TimedCallback* lifespan_timer_;
+
+    //! Expiration time the lifespan timer is scheduled for.
+    rtps::Time_t lifespan_next_expiration_;
+
+    //! Whether the lifespan timer is scheduled.
+    bool lifespan_scheduled_;
+
+    //! Protects in_flight_changes_ and the waits on in_flight_changes_cond_.
+    std::mutex in_flight_mutex_;
+
+    //! Number of threads reserving or filling a change without the writer mutex locked.
+    uint32_t in_flight_changes_;
+
+    //! Notified, with in_flight_mutex_ locked, when a change filled without the writer mutex is added or released.
+    std::condition_variable in_flight_changes_cond_;
 };
 
 
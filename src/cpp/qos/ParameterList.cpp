@@ -468,7 +468,7 @@ bool ParameterList::readParameterListfromCDRMsg(CDRMessage_t& msg, std::function
                             return false;
                         }
 
-                        p.names.push_back(auxstr);
+                        p.add_name(auxstr);
                     }
 
                     IF_VALID_CALL
@@ -23,6 +23,8 @@
 #include <fastrtps/log/Log.h>
 #include <fastcdr/Cdr.h>
 
+#include <algorithm>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -145,6 +147,63 @@ bool PartitionQosPolicy::addToCDRMessage(CDRMessage_t* msg)
     return valid;
 }
 
+void PartitionQosPolicy::push_back(const char* name)
+{
+    add_name(std::string(name));
+    hasChanged = true;
+}
+
+void PartitionQosPolicy::clear()
+{
+    names.clear();
+    compiled_names_.clear();
+}
+
+void PartitionQosPolicy::setNames(std::vector<std::string>& nam)
+{
+    clear();
+    for(const std::string& name : nam)
+    {
+        add_name(name);
+    }
+    hasChanged = true;
+}
+
+void PartitionQosPolicy::add_name(const std::string& name)
+{
+    names.push_back(name);
+    compiled_names_.add(name, names.size() - 1);
+}
+
+bool PartitionQosPolicy::matches(const PartitionQosPolicy& other) const
+{
+    if(names.empty() && other.names.empty())
+    {
+        return true;
+    }
+
+    // The default partition only matches the empty name, without evaluating wildcards.
+    if(names.empty() || other.names.empty())
+    {
+        const std::vector<std::string>& other_names = names.empty() ? other.names : names;
+        return std::find(other_names.begin(), other_names.end(), std::string()) != other_names.end();
+    }
+
+    // Look up the names of the smaller list in the compiled names of the bigger one.
+    const PartitionQosPolicy& smaller = names.size() <= other.names.size() ? *this : other;
+    const PartitionQosPolicy& bigger = names.size() <= other.names.size() ? other : *this;
+
+    for(const std::string& name : smaller.names)
+    {
+        if(bigger.compiled_names_.matches(name.c_str()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool UserDataQosPolicy::addToCDRMessage(CDRMessage_t* msg)
 {
     bool valid = CDRMessage::addUInt16(msg, this->Pid);
@@ -131,6 +131,10 @@ void WriterQos::setQos(const WriterQos& qos, bool first_time)
         m_ownershipStrength = qos.m_ownershipStrength;
         m_ownershipStrength.hasChanged = true;
     }
+    if(first_time)
+    {
+        m_transportPriority = qos.m_transportPriority;
+    }
 }
 
 bool WriterQos::checkQos() const
@@ -21,6 +21,8 @@
 #include <fastrtps/rtps/common/Locator.h>
 
 #include <fastrtps/rtps/builtin/discovery/participant/PDPSimple.h>
+#include <fastrtps/rtps/builtin/discovery/participant/PDPClient.h>
+#include <fastrtps/rtps/builtin/discovery/participant/PDPServer.h>
 #include <fastrtps/rtps/builtin/discovery/endpoint/EDP.h>
 
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
@@ -77,7 +79,24 @@ bool BuiltinProtocols::initBuiltinProtocols(RTPSParticipantImpl* p_part, Builtin
 
     if(m_att.use_SIMPLE_RTPSParticipantDiscoveryProtocol)
     {
-        mp_PDP = new PDPSimple(this);
+        if(m_att.discoveryProtocol == DiscoveryProtocol_t::CLIENT)
+        {
+            if(m_att.discoveryServersList.empty())
+            {
+                logError(RTPS_PDP, "Discovery client configured without discovery servers");
+                return false;
+            }
+            mp_PDP = new PDPClient(this);
+        }
+        else if(m_att.discoveryProtocol == DiscoveryProtocol_t::SERVER)
+        {
+            mp_PDP = new PDPServer(this);
+        }
+        else
+        {
+            mp_PDP = new PDPSimple(this);
+        }
+
         if(!mp_PDP->initPDP(mp_participantImpl)){
             logError(RTPS_PDP,"Participant discovery configuration failed");
             return false;
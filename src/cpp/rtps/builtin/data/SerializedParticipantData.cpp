@@ -0,0 +1,73 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SerializedParticipantData.cpp
+ *
+ */
+
+#include <fastrtps/rtps/builtin/data/SerializedParticipantData.h>
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+void SerializedParticipantData::invalidate()
+{
+    serialized_.pos = 0;
+    serialized_.length = 0;
+}
+
+bool SerializedParticipantData::copy_to(
+        ParticipantProxyData& data,
+        Endianness_t endian,
+        CDRMessage_t& msg)
+{
+    msg.pos = 0;
+    msg.length = 0;
+
+    if(serialized_.length == 0 || serialized_.msg_endian != endian)
+    {
+        invalidate();
+        serialized_.msg_endian = endian;
+
+        if(!data.writeToCDRMessage(&serialized_, false))
+        {
+            invalidate();
+            return false;
+        }
+    }
+
+    if(msg.max_size < serialized_.length)
+    {
+        assert(!msg.wraps);
+        free(msg.buffer);
+        msg.buffer = (octet*)malloc(serialized_.length);
+        msg.max_size = serialized_.length;
+    }
+
+    memcpy(msg.buffer, serialized_.buffer, serialized_.length);
+    msg.length = serialized_.length;
+    msg.msg_endian = serialized_.msg_endian;
+    return true;
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
@@ -36,12 +36,12 @@
 #include <fastrtps/attributes/TopicAttributes.h>
 #include <fastrtps/rtps/common/MatchingInfo.h>
 
-#include <fastrtps/utils/StringMatching.h>
 #include <fastrtps/log/Log.h>
 
 #include <fastrtps/types/TypeObjectFactory.h>
 
 #include <mutex>
+#include <cstring>
 
 using namespace eprosima::fastrtps;
 
@@ -432,53 +432,7 @@ bool EDP::validMatching(const WriterProxyData* wdata, const ReaderProxyData* rda
 #endif
 
     //Partition check:
-    bool matched = false;
-    if(wdata->m_qos.m_partition.names.empty() && rdata->m_qos.m_partition.names.empty())
-    {
-        matched = true;
-    }
-    else if(wdata->m_qos.m_partition.names.empty() && rdata->m_qos.m_partition.names.size()>0)
-    {
-        for(std::vector<std::string>::const_iterator rnameit = rdata->m_qos.m_partition.names.begin();
-                rnameit!=rdata->m_qos.m_partition.names.end();++rnameit)
-        {
-            if(rnameit->size()==0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if(wdata->m_qos.m_partition.names.size()>0 && rdata->m_qos.m_partition.names.empty() )
-    {
-        for(std::vector<std::string>::const_iterator wnameit = wdata->m_qos.m_partition.names.begin();
-                wnameit !=  wdata->m_qos.m_partition.names.end();++wnameit)
-        {
-            if(wnameit->size()==0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for(std::vector<std::string>::const_iterator wnameit = wdata->m_qos.m_partition.names.begin();
-                wnameit !=  wdata->m_qos.m_partition.names.end();++wnameit)
-        {
-            for(std::vector<std::string>::const_iterator rnameit = rdata->m_qos.m_partition.names.begin();
-                    rnameit!=rdata->m_qos.m_partition.names.end();++rnameit)
-            {
-                if(StringMatching::matchString(wnameit->c_str(),rnameit->c_str()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if(matched)
-                break;
-        }
-    }
+    bool matched = wdata->m_qos.m_partition.matches(rdata->m_qos.m_partition);
     if(!matched) //Different partitions
         logWarning(RTPS_EDP,"INCOMPATIBLE QOS (topic: "<< rdata->topicName() <<"): Different Partitions");
     return matched;
@@ -532,53 +486,7 @@ bool EDP::validMatching(const ReaderProxyData* rdata, const WriterProxyData* wda
 #endif
 
     //Partition check:
-    bool matched = false;
-    if(rdata->m_qos.m_partition.names.empty() && wdata->m_qos.m_partition.names.empty())
-    {
-        matched = true;
-    }
-    else if(rdata->m_qos.m_partition.names.empty() && wdata->m_qos.m_partition.names.size()>0)
-    {
-        for(std::vector<std::string>::const_iterator rnameit = wdata->m_qos.m_partition.names.begin();
-                rnameit!=wdata->m_qos.m_partition.names.end();++rnameit)
-        {
-            if(rnameit->size()==0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if(rdata->m_qos.m_partition.names.size()>0 && wdata->m_qos.m_partition.names.empty() )
-    {
-        for(std::vector<std::string>::const_iterator wnameit = rdata->m_qos.m_partition.names.begin();
-                wnameit !=  rdata->m_qos.m_partition.names.end();++wnameit)
-        {
-            if(wnameit->size()==0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for(std::vector<std::string>::const_iterator wnameit = rdata->m_qos.m_partition.names.begin();
-                wnameit !=  rdata->m_qos.m_partition.names.end();++wnameit)
-        {
-            for(std::vector<std::string>::const_iterator rnameit = wdata->m_qos.m_partition.names.begin();
-                    rnameit!=wdata->m_qos.m_partition.names.end();++rnameit)
-            {
-                if(StringMatching::matchString(wnameit->c_str(),rnameit->c_str()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if(matched)
-                break;
-        }
-    }
+    bool matched = rdata->m_qos.m_partition.matches(wdata->m_qos.m_partition);
     if(!matched) //Different partitions
         logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " <<  wdata->topicName() << "): Different Partitions");
 
@@ -1124,6 +1032,18 @@ bool EDP::checkTypeIdentifier(const TypeIdentifier * wti, const TypeIdentifier *
     return false;
 }
 */
+// The const type_id() accessors of the proxy data return copies to keep the exported interface unchanged.
+// The non-const ones give access to the stored identifiers, which are only read here.
+static const TypeIdentifier& stored_type_identifier(const WriterProxyData* wdata)
+{
+    return const_cast<WriterProxyData*>(wdata)->type_id().m_type_identifier;
+}
+
+static const TypeIdentifier& stored_type_identifier(const ReaderProxyData* rdata)
+{
+    return const_cast<ReaderProxyData*>(rdata)->type_id().m_type_identifier;
+}
+
 bool EDP::checkTypeIdentifier(const WriterProxyData* wdata, const ReaderProxyData* rdata) const
 {
     if (wdata->topicDiscoveryKind() == NO_CHECK || rdata->topicDiscoveryKind() == NO_CHECK)
@@ -1136,7 +1056,16 @@ bool EDP::checkTypeIdentifier(const WriterProxyData* wdata, const ReaderProxyDat
         return false;
     }
 
-    return wdata->type_id().m_type_identifier == rdata->type_id().m_type_identifier;
+    const TypeIdentifier& wti = stored_type_identifier(wdata);
+    const TypeIdentifier& rti = stored_type_identifier(rdata);
+
+    // Hashed identifiers are equal only if their equivalence hashes are.
+    if ((wti._d() == EK_MINIMAL || wti._d() == EK_COMPLETE) && wti._d() == rti._d())
+    {
+        return memcmp(wti.equivalence_hash(), rti.equivalence_hash(), sizeof(EquivalenceHash)) == 0;
+    }
+
+    return wti == rti;
 }
 
 }
@@ -0,0 +1,104 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EDPRelayFilter.cpp
+ *
+ */
+
+#include "EDPRelayFilter.h"
+
+#include <fastrtps/rtps/common/CacheChange.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+bool EDPRelayFilter::is_relevant(
+        const CacheChange_t& change,
+        const GUID_t& reader_guid) const
+{
+    if(change.kind != ALIVE)
+    {
+        return true;
+    }
+
+    GUID_t endpoint_guid = iHandle2GUID(change.instanceHandle);
+    if(endpoint_guid.guidPrefix == local_prefix_)
+    {
+        return true;
+    }
+
+    if(endpoint_guid.guidPrefix == reader_guid.guidPrefix)
+    {
+        // The participant announced the endpoint itself.
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto endpoint = endpoints_.find(endpoint_guid);
+    if(endpoint == endpoints_.end())
+    {
+        return true;
+    }
+
+    return has_endpoint_nts(reader_guid.guidPrefix, endpoint->second.topic_name, !endpoint->second.is_writer);
+}
+
+bool EDPRelayFilter::endpoint_alive(
+        const GUID_t& guid,
+        const string_255& topic_name,
+        bool is_writer)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    bool new_interest = !has_endpoint_nts(guid.guidPrefix, topic_name, is_writer);
+    endpoints_[guid] = Endpoint{topic_name, is_writer};
+    return new_interest;
+}
+
+void EDPRelayFilter::endpoint_disposed(const GUID_t& guid)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    endpoints_.erase(guid);
+}
+
+bool EDPRelayFilter::is_on_topic(
+        const GUID_t& guid,
+        const string_255& topic_name) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto endpoint = endpoints_.find(guid);
+    return endpoint != endpoints_.end() && endpoint->second.topic_name == topic_name;
+}
+
+bool EDPRelayFilter::has_endpoint_nts(
+        const GuidPrefix_t& participant,
+        const string_255& topic_name,
+        bool is_writer) const
+{
+    for(auto it = endpoints_.lower_bound(GUID_t(participant, EntityId_t()));
+            it != endpoints_.end() && it->first.guidPrefix == participant; ++it)
+    {
+        if(it->second.is_writer == is_writer && it->second.topic_name == topic_name)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
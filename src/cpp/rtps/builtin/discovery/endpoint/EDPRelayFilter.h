@@ -0,0 +1,117 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EDPRelayFilter.h
+ *
+ */
+
+#ifndef EDPRELAYFILTER_H_
+#define EDPRELAYFILTER_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/rtps/writer/IReaderDataFilter.h>
+#include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/utils/fixed_size_string.hpp>
+
+#include <map>
+#include <mutex>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Filter of the endpoint announcements relayed by a discovery server.
+ * An announcement of a remote endpoint is only sent to the participants with a matching endpoint on its topic,
+ * i.e. publications to participants with readers on the topic and subscriptions to participants with writers.
+ * The announcements of the local endpoints and the disposals are sent to every participant.
+ * @ingroup DISCOVERY_MODULE
+ */
+class EDPRelayFilter : public IReaderDataFilter
+{
+    public:
+
+        /**
+         * Constructor.
+         * @param local_prefix GUID prefix of the local participant.
+         */
+        EDPRelayFilter(const GuidPrefix_t& local_prefix) : local_prefix_(local_prefix) {}
+
+        virtual ~EDPRelayFilter() = default;
+
+        bool is_relevant(
+                const CacheChange_t& change,
+                const GUID_t& reader_guid) const override;
+
+        /**
+         * Register an alive remote endpoint.
+         * @param guid GUID of the endpoint.
+         * @param topic_name Topic of the endpoint.
+         * @param is_writer Whether the endpoint is a writer.
+         * @return true if its participant had no other endpoint of the same kind on the topic. The announcements
+         * previously filtered out for that participant have to be sent again.
+         */
+        bool endpoint_alive(
+                const GUID_t& guid,
+                const string_255& topic_name,
+                bool is_writer);
+
+        /**
+         * Unregister a disposed remote endpoint.
+         * @param guid GUID of the endpoint.
+         */
+        void endpoint_disposed(const GUID_t& guid);
+
+        /**
+         * Check if a remote endpoint is registered on a topic.
+         * @param guid GUID of the endpoint.
+         * @param topic_name Topic to check.
+         * @return true if the endpoint is alive on the topic.
+         */
+        bool is_on_topic(
+                const GUID_t& guid,
+                const string_255& topic_name) const;
+
+    private:
+
+        struct Endpoint
+        {
+            string_255 topic_name;
+            bool is_writer;
+        };
+
+        /**
+         * Check if a participant has an endpoint of some kind on a topic.
+         * Has to be called with the mutex locked.
+         */
+        bool has_endpoint_nts(
+                const GuidPrefix_t& participant,
+                const string_255& topic_name,
+                bool is_writer) const;
+
+        GuidPrefix_t local_prefix_;
+
+        mutable std::mutex mutex_;
+
+        //!Alive remote endpoints, sorted by GUID so the endpoints of a participant are contiguous.
+        std::map<GUID_t, Endpoint> endpoints_;
+};
+
+} /* namespace rtps */
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* EDPRELAYFILTER_H_ */
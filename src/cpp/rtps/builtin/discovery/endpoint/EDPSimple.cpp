@@ -19,6 +19,7 @@
 
 #include <fastrtps/rtps/builtin/discovery/endpoint/EDPSimple.h>
 #include "EDPSimpleListeners.h"
+#include "EDPRelayFilter.h"
 #include <fastrtps/rtps/builtin/discovery/participant/PDPSimple.h>
 #include "../../../participant/RTPSParticipantImpl.h"
 #include <fastrtps/rtps/writer/StatefulWriter.h>
@@ -37,6 +38,8 @@
 #include <fastrtps/log/Log.h>
 
 #include <mutex>
+#include <cstring>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps{
@@ -57,6 +60,7 @@ EDPSimple::EDPSimple(
     : EDP(p,part)
     , publications_listener_(nullptr)
     , subscriptions_listener_(nullptr)
+    , relay_filter_(nullptr)
 {
 }
 
@@ -118,6 +122,11 @@ EDPSimple::~EDPSimple()
     {
         delete(subscriptions_listener_);
     }
+
+    if(nullptr != relay_filter_)
+    {
+        delete(relay_filter_);
+    }
 }
 
 
@@ -156,6 +165,11 @@ bool EDPSimple::createSEDPEndpoints()
     publications_listener_ = new EDPSimplePUBListener(this);
     subscriptions_listener_ = new EDPSimpleSUBListener(this);
 
+    if(m_discovery.discoveryProtocol == DiscoveryProtocol_t::SERVER)
+    {
+        relay_filter_ = new EDPRelayFilter(mp_RTPSParticipant->getGuid().guidPrefix);
+    }
+
     if(m_discovery.m_simpleEDP.use_PublicationWriterANDSubscriptionReader)
     {
         hatt.initialReservedCaches = edp_initial_reserved_caches;
@@ -183,6 +197,7 @@ bool EDPSimple::createSEDPEndpoints()
         {
             publications_writer_.first = dynamic_cast<StatefulWriter*>(waux);
             logInfo(RTPS_EDP,"SEDP Publication Writer created");
+            publications_writer_.first->reader_data_filter(relay_filter_);
         }
         else
         {
@@ -272,6 +287,7 @@ bool EDPSimple::createSEDPEndpoints()
         {
             subscriptions_writer_.first = dynamic_cast<StatefulWriter*>(waux);
             logInfo(RTPS_EDP,"SEDP Subscription Writer created");
+            subscriptions_writer_.first->reader_data_filter(relay_filter_);
 
         }
         else
@@ -498,21 +514,7 @@ bool EDPSimple::processLocalReaderProxyData(RTPSReader* local_reader, ReaderProx
             rdata->writeToCDRMessage(&aux_msg, true);
             change->serializedPayload.length = (uint16_t)aux_msg.length;
 
-            {
-                std::unique_lock<std::recursive_timed_mutex> lock(*writer->second->getMutex());
-                for(auto ch = writer->second->changesBegin(); ch != writer->second->changesEnd(); ++ch)
-                {
-                    if((*ch)->instanceHandle == change->instanceHandle)
-                    {
-                        writer->second->remove_change(*ch);
-                        break;
-                    }
-                }
-            }
-
-            writer->second->add_change(change);
-
-            return true;
+            return updateEndpointAnnouncement(*writer, change);
         }
 
         return false;
@@ -553,25 +555,150 @@ bool EDPSimple::processLocalWriterProxyData(RTPSWriter* local_writer, WriterProx
             wdata->writeToCDRMessage(&aux_msg, true);
             change->serializedPayload.length = (uint16_t)aux_msg.length;
 
+            return updateEndpointAnnouncement(*writer, change);
+        }
+        return false;
+    }
+    return true;
+}
+
+bool EDPSimple::relayPublicationData(const CacheChange_t& change, const WriterProxyData& wdata)
+{
+    if(relay_filter_ != nullptr && relay_filter_->endpoint_alive(wdata.guid(), wdata.topicName(), true))
+    {
+        // Its participant has not received the subscriptions on the topic yet.
+        refreshRelayedAnnouncements(subscriptions_writer_, wdata.topicName(), DISCOVERY_SUBSCRIPTION_DATA_MAX_SIZE);
+    }
+
+    return relayEndpointData(publications_writer_, change, DISCOVERY_PUBLICATION_DATA_MAX_SIZE);
+}
+
+bool EDPSimple::relaySubscriptionData(const CacheChange_t& change, const ReaderProxyData& rdata)
+{
+    if(relay_filter_ != nullptr && relay_filter_->endpoint_alive(rdata.guid(), rdata.topicName(), false))
+    {
+        // Its participant has not received the publications on the topic yet.
+        refreshRelayedAnnouncements(publications_writer_, rdata.topicName(), DISCOVERY_PUBLICATION_DATA_MAX_SIZE);
+    }
+
+    return relayEndpointData(subscriptions_writer_, change, DISCOVERY_SUBSCRIPTION_DATA_MAX_SIZE);
+}
+
+bool EDPSimple::relayPublicationDisposal(const GUID_t& writer_guid)
+{
+    if(relay_filter_ != nullptr)
+    {
+        relay_filter_->endpoint_disposed(writer_guid);
+    }
+
+    CacheChange_t disposal;
+    disposal.kind = NOT_ALIVE_DISPOSED_UNREGISTERED;
+    disposal.instanceHandle = writer_guid;
+    return relayEndpointData(publications_writer_, disposal, DISCOVERY_PUBLICATION_DATA_MAX_SIZE);
+}
+
+bool EDPSimple::relaySubscriptionDisposal(const GUID_t& reader_guid)
+{
+    if(relay_filter_ != nullptr)
+    {
+        relay_filter_->endpoint_disposed(reader_guid);
+    }
+
+    CacheChange_t disposal;
+    disposal.kind = NOT_ALIVE_DISPOSED_UNREGISTERED;
+    disposal.instanceHandle = reader_guid;
+    return relayEndpointData(subscriptions_writer_, disposal, DISCOVERY_SUBSCRIPTION_DATA_MAX_SIZE);
+}
+
+bool EDPSimple::relayEndpointData(t_p_StatefulWriter& writer, const CacheChange_t& remote_change, uint32_t max_size)
+{
+    if(writer.first == nullptr)
+    {
+        return false;
+    }
+
+    CacheChange_t* change = writer.first->new_change([max_size]() -> uint32_t {return max_size;},
+            remote_change.kind, remote_change.instanceHandle);
+    if(change == nullptr)
+    {
+        return false;
+    }
+
+    // Disposals are sent without payload, as done for the local endpoints.
+    if(remote_change.kind == ALIVE && !change->serializedPayload.copy(&remote_change.serializedPayload, true))
+    {
+        logWarning(RTPS_EDP, "Cannot relay the announcement of " << iHandle2GUID(remote_change.instanceHandle));
+        writer.second->release_Cache(change);
+        return false;
+    }
+
+    return updateEndpointAnnouncement(writer, change);
+}
+
+bool EDPSimple::updateEndpointAnnouncement(t_p_StatefulWriter& writer, CacheChange_t* change)
+{
+    {
+        std::lock_guard<std::recursive_timed_mutex> guard(*writer.second->getMutex());
+        for(auto ch = writer.second->changesBegin(); ch != writer.second->changesEnd(); ++ch)
+        {
+            if((*ch)->instanceHandle == change->instanceHandle)
             {
-                std::unique_lock<std::recursive_timed_mutex> lock(*writer->second->getMutex());
-                for(auto ch = writer->second->changesBegin(); ch != writer->second->changesEnd(); ++ch)
+                const SerializedPayload_t& announced = (*ch)->serializedPayload;
+                if((*ch)->kind == change->kind && announced.length == change->serializedPayload.length &&
+                        memcmp(announced.data, change->serializedPayload.data, announced.length) == 0)
                 {
-                    if((*ch)->instanceHandle == change->instanceHandle)
-                    {
-                        writer->second->remove_change(*ch);
-                        break;
-                    }
+                    // Matched readers already have, or are receiving, this same announcement.
+                    writer.second->release_Cache(change);
+                    return true;
                 }
+
+                writer.second->remove_change(*ch);
+                break;
             }
+        }
+    }
 
-            writer->second->add_change(change);
+    return writer.second->add_change(change);
+}
 
-            return true;
+void EDPSimple::refreshRelayedAnnouncements(t_p_StatefulWriter& writer, const string_255& topic_name,
+        uint32_t max_size)
+{
+    if(writer.first == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::recursive_timed_mutex> guard(*writer.second->getMutex());
+    std::vector<CacheChange_t*> announcements;
+    for(auto ch = writer.second->changesBegin(); ch != writer.second->changesEnd(); ++ch)
+    {
+        if((*ch)->kind == ALIVE && relay_filter_->is_on_topic(iHandle2GUID((*ch)->instanceHandle), topic_name))
+        {
+            announcements.push_back(*ch);
         }
-        return false;
     }
-    return true;
+
+    // The relevance of a change for each reader is decided when it is added, so the announcements are replaced
+    // by new copies.
+    for(CacheChange_t* announced : announcements)
+    {
+        CacheChange_t* change = writer.first->new_change([max_size]() -> uint32_t {return max_size;},
+                ALIVE, announced->instanceHandle);
+        if(change == nullptr)
+        {
+            continue;
+        }
+
+        if(!change->serializedPayload.copy(&announced->serializedPayload, true))
+        {
+            writer.second->release_Cache(change);
+            continue;
+        }
+
+        writer.second->remove_change(announced);
+        writer.second->add_change(change);
+    }
 }
 
 bool EDPSimple::removeLocalWriter(RTPSWriter* W)
@@ -83,6 +83,11 @@ void EDPSimplePUBListener::onNewCacheChangeAdded(RTPSReader* reader, const Cache
 
                 sedp_->pairing_writer_proxy_with_any_local_reader(&pdata, &writerProxyData);
 
+                if(relay_enabled(reader))
+                {
+                    sedp_->relayPublicationData(*change, writerProxyData);
+                }
+
                 // Take again the reader lock.
                 reader->getMutex().lock();
             }
@@ -98,7 +103,12 @@ void EDPSimplePUBListener::onNewCacheChangeAdded(RTPSReader* reader, const Cache
         logInfo(RTPS_EDP,"Disposed Remote Writer, removing...");
 
         GUID_t auxGUID = iHandle2GUID(change->instanceHandle);
-        this->sedp_->mp_PDP->removeWriterProxyData(auxGUID);
+        if(this->sedp_->mp_PDP->removeWriterProxyData(auxGUID) && relay_enabled(reader))
+        {
+            reader->getMutex().unlock();
+            sedp_->relayPublicationDisposal(auxGUID);
+            reader->getMutex().lock();
+        }
     }
 
     //Removing change from history
@@ -107,11 +117,25 @@ void EDPSimplePUBListener::onNewCacheChangeAdded(RTPSReader* reader, const Cache
     return;
 }
 
+bool EDPSimplePUBListener::relay_enabled(RTPSReader* reader) const
+{
+    // Discovery servers relay the announcements received through the non secure endpoints.
+    return sedp_->m_discovery.discoveryProtocol == DiscoveryProtocol_t::SERVER &&
+        reader == sedp_->publications_reader_.first;
+}
+
 bool EDPSimplePUBListener::computeKey(CacheChange_t* change)
 {
     return ParameterList::readInstanceHandleFromCDRMsg(change, PID_ENDPOINT_GUID);
 }
 
+bool EDPSimpleSUBListener::relay_enabled(RTPSReader* reader) const
+{
+    // Discovery servers relay the announcements received through the non secure endpoints.
+    return sedp_->m_discovery.discoveryProtocol == DiscoveryProtocol_t::SERVER &&
+        reader == sedp_->subscriptions_reader_.first;
+}
+
 bool EDPSimpleSUBListener::computeKey(CacheChange_t* change)
 {
     return ParameterList::readInstanceHandleFromCDRMsg(change, PID_ENDPOINT_GUID);
@@ -159,6 +183,11 @@ void EDPSimpleSUBListener::onNewCacheChangeAdded(RTPSReader* reader, const Cache
 
                 sedp_->pairing_reader_proxy_with_any_local_writer(&pdata, &readerProxyData);
 
+                if(relay_enabled(reader))
+                {
+                    sedp_->relaySubscriptionData(*change, readerProxyData);
+                }
+
                 // Take again the reader lock.
                 reader->getMutex().lock();
             }
@@ -174,7 +203,12 @@ void EDPSimpleSUBListener::onNewCacheChangeAdded(RTPSReader* reader, const Cache
         logInfo(RTPS_EDP,"Disposed Remote Reader, removing...");
 
         GUID_t auxGUID = iHandle2GUID(change->instanceHandle);
-        this->sedp_->mp_PDP->removeReaderProxyData(auxGUID);
+        if(this->sedp_->mp_PDP->removeReaderProxyData(auxGUID) && relay_enabled(reader))
+        {
+            reader->getMutex().unlock();
+            sedp_->relaySubscriptionDisposal(auxGUID);
+            reader->getMutex().lock();
+        }
     }
 
     // Remove change from history.
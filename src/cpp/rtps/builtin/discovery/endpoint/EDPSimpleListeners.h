@@ -76,6 +76,12 @@ class EDPSimplePUBListener : public ReaderListener, public WriterListener
 
     private:
 
+        /**
+         * Check if the announcements received by a reader must be relayed to the rest of participants.
+         * @param reader Pointer to the SEDP reader.
+         */
+        bool relay_enabled(RTPSReader* reader) const;
+
         //!Pointer to the EDPSimple
         EDPSimple* sedp_;
 };
@@ -120,6 +126,12 @@ class EDPSimpleSUBListener : public ReaderListener, public WriterListener
 
     private:
 
+        /**
+         * Check if the announcements received by a reader must be relayed to the rest of participants.
+         * @param reader Pointer to the SEDP reader.
+         */
+        bool relay_enabled(RTPSReader* reader) const;
+
         //!Pointer to the EDPSimple
         EDPSimple* sedp_;
 };
@@ -108,6 +108,7 @@ bool EDPStatic::processLocalReaderProxyData(RTPSReader*, ReaderProxyData* rdata)
     //Add the property list entry to our local pdp
     ParticipantProxyData* localpdata = this->mp_PDP->getLocalParticipantProxyData();
     localpdata->m_properties.properties.push_back(EDPStaticProperty::toProperty("Reader","ALIVE", rdata->userDefinedId(), rdata->guid().entityId));
+    mp_PDP->local_participant_data_updated();
     mp_PDP->getMutex()->unlock();
     this->mp_PDP->announceParticipantState(true);
     return true;
@@ -121,6 +122,7 @@ bool EDPStatic::processLocalWriterProxyData(RTPSWriter*, WriterProxyData* wdata)
     ParticipantProxyData* localpdata = this->mp_PDP->getLocalParticipantProxyData();
     localpdata->m_properties.properties.push_back(EDPStaticProperty::toProperty("Writer","ALIVE",
                 wdata->userDefinedId(), wdata->guid().entityId));
+    mp_PDP->local_participant_data_updated();
     mp_PDP->getMutex()->unlock();
     this->mp_PDP->announceParticipantState(true);
     return true;
@@ -143,6 +145,7 @@ bool EDPStatic::removeLocalReader(RTPSReader* R)
             }
         }
     }
+    mp_PDP->local_participant_data_updated();
     return false;
 }
 
@@ -163,6 +166,7 @@ bool EDPStatic::removeLocalWriter(RTPSWriter*W)
             }
         }
     }
+    mp_PDP->local_participant_data_updated();
     return false;
 }
 
@@ -0,0 +1,62 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PDPClient.cpp
+ *
+ */
+
+#include <fastrtps/rtps/builtin/discovery/participant/PDPClient.h>
+#include <fastrtps/rtps/builtin/discovery/participant/PDPServer.h>
+
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+
+#include <fastrtps/log/Log.h>
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+PDPClient::PDPClient(BuiltinProtocols* built)
+    : PDPSimple(built)
+{
+}
+
+PDPClient::~PDPClient()
+{
+}
+
+void PDPClient::assignRemoteEndpoints(ParticipantProxyData* pdata)
+{
+    if(PDPServer::isDiscoveryServer(*pdata))
+    {
+        PDPSimple::assignRemoteEndpoints(pdata);
+    }
+    else
+    {
+        logInfo(RTPS_PDP, "RTPSParticipant " << pdata->m_guid.guidPrefix << " discovered through a discovery server");
+    }
+}
+
+void PDPClient::removeRemoteEndpoints(ParticipantProxyData* pdata)
+{
+    if(PDPServer::isDiscoveryServer(*pdata))
+    {
+        PDPSimple::removeRemoteEndpoints(pdata);
+    }
+}
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
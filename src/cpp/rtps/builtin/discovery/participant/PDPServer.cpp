@@ -0,0 +1,166 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PDPServer.cpp
+ *
+ */
+
+#include <fastrtps/rtps/builtin/discovery/participant/PDPServer.h>
+
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
+#include <fastrtps/rtps/builtin/data/WriterProxyData.h>
+#include <fastrtps/rtps/builtin/discovery/endpoint/EDPSimple.h>
+
+#include <fastrtps/rtps/writer/StatelessWriter.h>
+#include <fastrtps/rtps/history/WriterHistory.h>
+
+#include <fastrtps/log/Log.h>
+
+#include <mutex>
+
+namespace eprosima {
+namespace fastrtps{
+namespace rtps {
+
+//!Property announced by the discovery servers.
+static const char* const c_DiscoveryServerProperty = "fastrtps.discovery_server";
+
+PDPServer::PDPServer(BuiltinProtocols* built)
+    : PDPSimple(built)
+{
+}
+
+PDPServer::~PDPServer()
+{
+}
+
+bool PDPServer::isDiscoveryServer(const ParticipantProxyData& pdata)
+{
+    for(const auto& property : pdata.m_properties.properties)
+    {
+        if(property.first == c_DiscoveryServerProperty)
+        {
+            return property.second == "true";
+        }
+    }
+    return false;
+}
+
+void PDPServer::initializeParticipantProxyData(ParticipantProxyData* participant_data)
+{
+    PDPSimple::initializeParticipantProxyData(participant_data);
+    participant_data->m_properties.properties.push_back(
+            std::make_pair(std::string(c_DiscoveryServerProperty), std::string("true")));
+}
+
+void PDPServer::announceParticipantState(bool new_change, bool dispose)
+{
+    if(!dispose)
+    {
+        // Relayed disposals are kept until the whole history has been announced again.
+        std::lock_guard<std::recursive_timed_mutex> guard(*mp_SPDPWriterHistory->getMutex());
+        std::vector<SequenceNumber_t> announced_disposals;
+        for(auto it = mp_SPDPWriterHistory->changesBegin(); it != mp_SPDPWriterHistory->changesEnd(); ++it)
+        {
+            if((*it)->kind != ALIVE && (*it)->sequenceNumber < m_disposedRelaysMark)
+            {
+                announced_disposals.push_back((*it)->sequenceNumber);
+            }
+        }
+
+        for(const SequenceNumber_t& seq : announced_disposals)
+        {
+            mp_SPDPWriterHistory->remove_change(seq);
+        }
+
+        m_disposedRelaysMark = mp_SPDPWriterHistory->next_sequence_number();
+    }
+
+    PDPSimple::announceParticipantState(new_change, dispose);
+}
+
+void PDPServer::relayParticipantAnnouncement(const CacheChange_t& remote_change)
+{
+    CacheChange_t* change = mp_SPDPWriter->new_change([]() -> uint32_t {return DISCOVERY_PARTICIPANT_DATA_MAX_SIZE;},
+            ALIVE, remote_change.instanceHandle);
+    if(change == nullptr)
+    {
+        return;
+    }
+
+    if(!change->serializedPayload.copy(&remote_change.serializedPayload, true))
+    {
+        logWarning(RTPS_PDP, "Cannot relay the announcement of " << iHandle2GUID(remote_change.instanceHandle));
+        mp_SPDPWriterHistory->release_Cache(change);
+        return;
+    }
+
+    logInfo(RTPS_PDP, "Relaying announcement of RTPSParticipant " << iHandle2GUID(remote_change.instanceHandle));
+    removeParticipantAnnouncement(change->instanceHandle);
+    mp_SPDPWriterHistory->add_change(change);
+}
+
+void PDPServer::removeRemoteEndpoints(ParticipantProxyData* pdata)
+{
+    // Endpoints relayed by this server are disposed, so they are not announced to new clients.
+    // The SEDP readers of the participant are already unmatched, so the disposals are removed from the histories
+    // once the rest of participants acknowledge them.
+    EDPSimple* edp = dynamic_cast<EDPSimple*>(mp_EDP);
+    if(edp != nullptr)
+    {
+        for(WriterProxyData* wdata : pdata->m_writers)
+        {
+            edp->relayPublicationDisposal(wdata->guid());
+        }
+
+        for(ReaderProxyData* rdata : pdata->m_readers)
+        {
+            edp->relaySubscriptionDisposal(rdata->guid());
+        }
+    }
+
+    // The relayed announcement of the participant is replaced by its disposal.
+    {
+        std::lock_guard<std::recursive_timed_mutex> guard(*mp_SPDPWriterHistory->getMutex());
+        for(auto it = mp_SPDPWriterHistory->changesBegin(); it != mp_SPDPWriterHistory->changesEnd(); ++it)
+        {
+            if((*it)->instanceHandle == pdata->m_key)
+            {
+                CacheChange_t* change = mp_SPDPWriter->new_change(
+                        []() -> uint32_t {return DISCOVERY_PARTICIPANT_DATA_MAX_SIZE;},
+                        NOT_ALIVE_DISPOSED_UNREGISTERED, pdata->m_key);
+
+                if(change != nullptr)
+                {
+                    change->serializedPayload.copy(&(*it)->serializedPayload, true);
+                    mp_SPDPWriterHistory->remove_change(*it);
+                    mp_SPDPWriterHistory->add_change(change);
+                }
+                else
+                {
+                    mp_SPDPWriterHistory->remove_change(*it);
+                }
+                break;
+            }
+        }
+    }
+
+    PDPSimple::removeRemoteEndpoints(pdata);
+}
+
+}
+} /* namespace rtps */
+} /* namespace eprosima */
@@ -54,6 +54,7 @@
 #include <fastrtps/log/Log.h>
 
 #include <mutex>
+#include <algorithm>
 
 using namespace eprosima::fastrtps;
 
@@ -226,6 +227,8 @@ bool PDPSimple::initPDP(RTPSParticipantImpl* part)
     mp_builtin->updateMetatrafficLocators(this->mp_SPDPReader->getAttributes().unicastLocatorList);
     m_participantProxies.push_back(new ParticipantProxyData());
     initializeParticipantProxyData(m_participantProxies.front());
+    m_participantProxiesByPrefix[m_participantProxies.front()->m_guid.guidPrefix] =
+        { m_participantProxies.front(), 0, std::vector<octet>() };
 
     //INIT EDP
     if(m_discovery.use_STATIC_EndpointDiscoveryProtocol)
@@ -280,17 +283,8 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
     {
         if(new_change || m_hasChangedLocalPDP)
         {
-            this->mp_mutex->lock();
-            ParticipantProxyData* local_participant_data = getLocalParticipantProxyData();
-            local_participant_data->m_manualLivelinessCount++;
-            InstanceHandle_t key = local_participant_data->m_key;
-            ParticipantProxyData proxy_data_copy(*local_participant_data);
-            this->mp_mutex->unlock();
-
-            if(mp_SPDPWriterHistory->getHistorySize() > 0)
-                mp_SPDPWriterHistory->remove_min_change();
             // TODO(Ricardo) Change DISCOVERY_PARTICIPANT_DATA_MAX_SIZE with getLocalParticipantProxyData()->size().
-            change = mp_SPDPWriter->new_change([]() -> uint32_t {return DISCOVERY_PARTICIPANT_DATA_MAX_SIZE;}, ALIVE, key);
+            change = mp_SPDPWriter->new_change([]() -> uint32_t {return DISCOVERY_PARTICIPANT_DATA_MAX_SIZE;}, ALIVE);
 
             if(change != nullptr)
             {
@@ -304,15 +298,44 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
                 aux_msg.msg_endian =  LITTLEEND;
 #endif
 
-                if(proxy_data_copy.writeToCDRMessage(&aux_msg, true))
+                bool serialized = false;
+                bool same_announcement = false;
                 {
-                    change->serializedPayload.length = (uint16_t)aux_msg.length;
+                    std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+                    ParticipantProxyData* local_participant_data = getLocalParticipantProxyData();
+                    local_participant_data->m_manualLivelinessCount++;
+                    change->instanceHandle = local_participant_data->m_key;
+                    serialized = local_participant_data->writeToCDRMessage(&aux_msg, true);
 
-                    mp_SPDPWriterHistory->add_change(change);
+                    if(serialized)
+                    {
+                        change->serializedPayload.length = (uint16_t)aux_msg.length;
+                        same_announcement = m_localAnnouncement.size() == aux_msg.length &&
+                            std::equal(m_localAnnouncement.begin(), m_localAnnouncement.end(), aux_msg.buffer);
+
+                        if(!same_announcement)
+                        {
+                            m_localAnnouncement.assign(aux_msg.buffer, aux_msg.buffer + aux_msg.length);
+                            local_participant_data_updated();
+                        }
+                    }
                 }
-                else
+
+                if(!serialized)
                 {
                     logError(RTPS_PDP, "Cannot serialize ParticipantProxyData.");
+                    mp_SPDPWriterHistory->release_Cache(change);
+                }
+                else if(same_announcement)
+                {
+                    // The announcement in the history already holds this data.
+                    mp_SPDPWriterHistory->release_Cache(change);
+                    mp_SPDPWriter->unsent_changes_reset();
+                }
+                else
+                {
+                    removeParticipantAnnouncement(change->instanceHandle);
+                    mp_SPDPWriterHistory->add_change(change);
                 }
             }
 
@@ -325,13 +348,7 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
     }
     else
     {
-        this->mp_mutex->lock();
-        ParticipantProxyData proxy_data_copy(*getLocalParticipantProxyData());
-        this->mp_mutex->unlock();
-
-        if(mp_SPDPWriterHistory->getHistorySize() > 0)
-            mp_SPDPWriterHistory->remove_min_change();
-        change = mp_SPDPWriter->new_change([]() -> uint32_t {return DISCOVERY_PARTICIPANT_DATA_MAX_SIZE;}, NOT_ALIVE_DISPOSED_UNREGISTERED, getLocalParticipantProxyData()->m_key);
+        change = mp_SPDPWriter->new_change([]() -> uint32_t {return DISCOVERY_PARTICIPANT_DATA_MAX_SIZE;}, NOT_ALIVE_DISPOSED_UNREGISTERED);
 
         if(change != nullptr)
         {
@@ -345,21 +362,45 @@ void PDPSimple::announceParticipantState(bool new_change, bool dispose)
             aux_msg.msg_endian =  LITTLEEND;
 #endif
 
-            if (proxy_data_copy.writeToCDRMessage(&aux_msg, true))
+            bool serialized = false;
+            {
+                std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
+                ParticipantProxyData* local_participant_data = getLocalParticipantProxyData();
+                change->instanceHandle = local_participant_data->m_key;
+                serialized = local_participant_data->writeToCDRMessage(&aux_msg, true);
+                m_localAnnouncement.clear();
+            }
+
+            if (serialized)
             {
                 change->serializedPayload.length = (uint16_t)aux_msg.length;
 
+                removeParticipantAnnouncement(change->instanceHandle);
                 mp_SPDPWriterHistory->add_change(change);
             }
             else
             {
                 logError(RTPS_PDP, "Cannot serialize ParticipantProxyData.");
+                mp_SPDPWriterHistory->release_Cache(change);
             }
         }
     }
 
 }
 
+bool PDPSimple::removeParticipantAnnouncement(const InstanceHandle_t& key)
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(*mp_SPDPWriterHistory->getMutex());
+    for(auto it = mp_SPDPWriterHistory->changesBegin(); it != mp_SPDPWriterHistory->changesEnd(); ++it)
+    {
+        if((*it)->instanceHandle == key)
+        {
+            return mp_SPDPWriterHistory->remove_change(*it);
+        }
+    }
+    return false;
+}
+
 bool PDPSimple::lookupReaderProxyData(const GUID_t& reader, ReaderProxyData& rdata, ParticipantProxyData& pdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
@@ -473,14 +514,11 @@ bool PDPSimple::lookupParticipantProxyData(const GUID_t& pguid, ParticipantProxy
 {
     logInfo(RTPS_PDP,pguid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for(std::vector<ParticipantProxyData*>::iterator pit = m_participantProxies.begin();
-            pit!=m_participantProxies.end();++pit)
+    auto pit = m_participantProxiesByPrefix.find(pguid.guidPrefix);
+    if(pit != m_participantProxiesByPrefix.end() && pit->second.proxy->m_guid == pguid)
     {
-        if((*pit)->m_guid == pguid)
-        {
-            pdata.copy(**pit);
-            return true;
-        }
+        pdata.copy(*pit->second.proxy);
+        return true;
     }
     return false;
 }
@@ -810,6 +848,7 @@ bool PDPSimple::removeRemoteParticipant(GUID_t& partGUID)
         {
             pdata = *pit;
             m_participantProxies.erase(pit);
+            m_participantProxiesByPrefix.erase(partGUID.guidPrefix);
             break;
         }
     }
@@ -880,20 +919,17 @@ bool PDPSimple::removeRemoteParticipant(GUID_t& partGUID)
 void PDPSimple::assertRemoteParticipantLiveliness(const GuidPrefix_t& guidP)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for(std::vector<ParticipantProxyData*>::iterator it = this->m_participantProxies.begin();
-            it!=this->m_participantProxies.end();++it)
-    {
-        if((*it)->m_guid.guidPrefix == guidP)
+    auto it = m_participantProxiesByPrefix.find(guidP);
+    if(it != m_participantProxiesByPrefix.end())
+    {
+        ParticipantProxyData* pdata = it->second.proxy;
+        logInfo(RTPS_LIVELINESS,"RTPSParticipant "<< pdata->m_guid << " is Alive");
+        // TODO Ricardo: Study if isAlive attribute is necessary.
+        pdata->isAlive = true;
+        if(pdata->mp_leaseDurationTimer != nullptr)
         {
-            logInfo(RTPS_LIVELINESS,"RTPSParticipant "<< (*it)->m_guid << " is Alive");
-            // TODO Ricardo: Study if isAlive attribute is necessary.
-            (*it)->isAlive = true;
-            if((*it)->mp_leaseDurationTimer != nullptr)
-            {
-                (*it)->mp_leaseDurationTimer->cancel_timer();
-                (*it)->mp_leaseDurationTimer->restart_timer();
-            }
-            break;
+            pdata->mp_leaseDurationTimer->cancel_timer();
+            pdata->mp_leaseDurationTimer->restart_timer();
         }
     }
 }
@@ -966,19 +1002,19 @@ bool PDPSimple::newRemoteEndpointStaticallyDiscovered(const GUID_t& pguid, int16
     return false;
 }
 
-CDRMessage_t PDPSimple::get_participant_proxy_data_serialized(Endianness_t endian)
+void PDPSimple::get_participant_proxy_data_serialized(Endianness_t endian, CDRMessage_t& msg)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    CDRMessage_t cdr_msg;
-    cdr_msg.msg_endian = endian;
 
-    if (!getLocalParticipantProxyData()->writeToCDRMessage(&cdr_msg, false))
+    if (!m_serializedLocalData.copy_to(*getLocalParticipantProxyData(), endian, msg))
     {
-        cdr_msg.pos = 0;
-        cdr_msg.length = 0;
+        logError(RTPS_PDP, "Cannot serialize ParticipantProxyData.");
     }
+}
 
-    return cdr_msg;
+void PDPSimple::local_participant_data_updated()
+{
+    m_serializedLocalData.invalidate();
 }
 
 } /* namespace rtps */
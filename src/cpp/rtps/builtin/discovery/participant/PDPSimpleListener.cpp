@@ -34,6 +34,7 @@
 #include <fastrtps/utils/TimeConversion.h>
 
 
+#include <algorithm>
 #include <mutex>
 
 #include <fastrtps/log/Log.h>
@@ -42,6 +43,21 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+/*!
+ * @brief Computes the FNV-1a hash of a participant announcement.
+ * Periodic announcements of a participant whose information has not changed are identical.
+ */
+static uint64_t announcement_fingerprint(const SerializedPayload_t& payload)
+{
+    uint64_t fingerprint = 14695981039346656037ULL;
+    for(uint32_t i = 0; i < payload.length; ++i)
+    {
+        fingerprint ^= payload.data[i];
+        fingerprint *= 1099511628211ULL;
+    }
+    return fingerprint;
+}
+
 
 
 void PDPSimpleListener::onNewCacheChangeAdded(RTPSReader* reader, const CacheChange_t* const change_in)
@@ -59,6 +75,48 @@ void PDPSimpleListener::onNewCacheChangeAdded(RTPSReader* reader, const CacheCha
     }
     if(change->kind == ALIVE)
     {
+        GUID_t guid;
+        iHandle2GUID(guid, change->instanceHandle);
+        if(guid == mp_SPDP->getRTPSParticipant()->getGuid())
+        {
+            logInfo(RTPS_PDP,"Message from own RTPSParticipant, removing");
+            this->mp_SPDP->mp_SPDPReaderHistory->remove_change(change);
+            return;
+        }
+
+        // An unchanged announcement of a known participant only renews its lease.
+        const SerializedPayload_t& payload = change->serializedPayload;
+        uint64_t fingerprint = announcement_fingerprint(payload);
+        bool is_unchanged = false;
+
+        reader->getMutex().unlock();
+        {
+            std::lock_guard<std::recursive_mutex> lock(*mp_SPDP->getMutex());
+            auto it = mp_SPDP->m_participantProxiesByPrefix.find(guid.guidPrefix);
+            if(it != mp_SPDP->m_participantProxiesByPrefix.end() &&
+                    it->second.announcement_fingerprint == fingerprint &&
+                    it->second.announcement.size() == payload.length &&
+                    std::equal(it->second.announcement.begin(), it->second.announcement.end(), payload.data))
+            {
+                ParticipantProxyData* pdata = it->second.proxy;
+                pdata->isAlive = true;
+                if(pdata->mp_leaseDurationTimer != nullptr)
+                {
+                    pdata->mp_leaseDurationTimer->cancel_timer();
+                    pdata->mp_leaseDurationTimer->restart_timer();
+                }
+                is_unchanged = true;
+            }
+        }
+        reader->getMutex().lock();
+
+        if(is_unchanged)
+        {
+            logInfo(RTPS_PDP,"Unchanged announcement of RTPSParticipant " << guid);
+            this->mp_SPDP->mp_SPDPReaderHistory->remove_change(change);
+            return;
+        }
+
         //LOAD INFORMATION IN TEMPORAL RTPSParticipant PROXY DATA
         ParticipantProxyData participant_data;
         CDRMessage_t msg(change->serializedPayload);
@@ -80,14 +138,12 @@ void PDPSimpleListener::onNewCacheChangeAdded(RTPSReader* reader, const CacheCha
             //LOOK IF IS AN UPDATED INFORMATION
             ParticipantProxyData* pdata = nullptr;
             std::unique_lock<std::recursive_mutex> lock(*mp_SPDP->getMutex());
-            for (auto it = mp_SPDP->m_participantProxies.begin();
-                    it != mp_SPDP->m_participantProxies.end();++it)
+            auto pit = mp_SPDP->m_participantProxiesByPrefix.find(participant_data.m_guid.guidPrefix);
+            if(pit != mp_SPDP->m_participantProxiesByPrefix.end())
             {
-                if(participant_data.m_key == (*it)->m_key)
-                {
-                    pdata = (*it);
-                    break;
-                }
+                pdata = pit->second.proxy;
+                pit->second.announcement_fingerprint = fingerprint;
+                pit->second.announcement.assign(payload.data, payload.data + payload.length);
             }
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
@@ -103,8 +159,11 @@ void PDPSimpleListener::onNewCacheChangeAdded(RTPSReader* reader, const CacheCha
                         TimeConv::Time_t2MilliSecondsDouble(pdata->m_leaseDuration));
                 pdata->mp_leaseDurationTimer->restart_timer();
                 this->mp_SPDP->m_participantProxies.push_back(pdata);
+                this->mp_SPDP->m_participantProxiesByPrefix[pdata->m_guid.guidPrefix] =
+                    { pdata, fingerprint, std::vector<octet>(payload.data, payload.data + payload.length) };
                 lock.unlock();
 
+                mp_SPDP->relayParticipantAnnouncement(*change);
                 mp_SPDP->announceParticipantState(false);
                 mp_SPDP->assignRemoteEndpoints(&participant_data);
             }
@@ -114,6 +173,8 @@ void PDPSimpleListener::onNewCacheChangeAdded(RTPSReader* reader, const CacheCha
                 pdata->isAlive = true;
                 lock.unlock();
 
+                mp_SPDP->relayParticipantAnnouncement(*change);
+
                 if(mp_SPDP->m_discovery.use_STATIC_EndpointDiscoveryProtocol)
                     mp_SPDP->mp_EDP->assignRemoteEndpoints(participant_data);
             }
@@ -0,0 +1,180 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "FairShareController.h"
+#include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <asio.hpp>
+#include <asio/steady_timer.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+static uint32_t cleared_size(const CacheChange_t* change, const FragmentNumber_t fragNum)
+{
+    if (fragNum == 0)
+        return change->serializedPayload.length;
+
+    return fragNum < change->getFragmentCount() ? change->getFragmentSize() :
+        change->serializedPayload.length - ((fragNum - 1) * change->getFragmentSize());
+}
+
+FairShareController::FairShareController(const ThroughputControllerDescriptor& descriptor,
+        const RTPSParticipantImpl* associatedParticipant):
+    mBytesPerPeriod(descriptor.bytesPerPeriod),
+    mAccumulatedPayloadSize(0),
+    mPeriodMillisecs(descriptor.periodMillisecs),
+    mAssociatedParticipant(associatedParticipant)
+{
+}
+
+void FairShareController::operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend)
+{
+    filter_nts_(changesToSend);
+}
+
+void FairShareController::operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend)
+{
+    filter_nts_(changesToSend);
+}
+
+void FairShareController::add_writer(const GUID_t& writer, const FlowSchedulingDescriptor& scheduling)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mFairShareControllerMutex);
+    writer_state_nts_(writer).scheduling = scheduling;
+}
+
+void FairShareController::remove_writer(const GUID_t& writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mFairShareControllerMutex);
+    mWriters.erase(std::remove_if(mWriters.begin(), mWriters.end(),
+                [&writer](const WriterState& state){ return state.guid == writer; }), mWriters.end());
+}
+
+template<class T>
+void FairShareController::filter_nts_(RTPSWriterCollector<T>& changesToSend)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mFairShareControllerMutex);
+
+    if (changesToSend.items().empty())
+        return;
+
+    // All the changes of a collector belong to the same writer.
+    WriterState& state = writer_state_nts_(changesToSend.items().front().cacheChange->writerGUID);
+    auto now = std::chrono::steady_clock::now();
+
+    auto it = changesToSend.items().begin();
+    while(it != changesToSend.items().end())
+    {
+        uint32_t size = cleared_size(it->cacheChange, it->fragmentNumber);
+        if (!may_send_nts_(state, size, now))
+            break;
+
+        mAccumulatedPayloadSize += size;
+        state.usedBytes += size;
+        ScheduleRefresh(state.guid, size);
+        ++it;
+    }
+
+    if (it != changesToSend.items().end())
+    {
+        // Kept during two periods, so it lasts until the writer is retried after the next refresh.
+        state.backloggedUntil = now + std::chrono::milliseconds(2 * mPeriodMillisecs);
+        changesToSend.items().erase(it, changesToSend.items().end());
+    }
+    else
+    {
+        state.backloggedUntil = std::chrono::steady_clock::time_point();
+    }
+}
+
+FairShareController::WriterState& FairShareController::writer_state_nts_(const GUID_t& writer)
+{
+    for (WriterState& state : mWriters)
+    {
+        if (state.guid == writer)
+            return state;
+    }
+
+    // Writers not explicitly added (i.e. builtin ones) use the default scheduling.
+    mWriters.push_back(WriterState{writer, FlowSchedulingDescriptor(), 0, std::chrono::steady_clock::time_point()});
+    return mWriters.back();
+}
+
+bool FairShareController::may_send_nts_(const WriterState& state, uint32_t size,
+        const std::chrono::steady_clock::time_point& now) const
+{
+    if ((mAccumulatedPayloadSize + size) > mBytesPerPeriod)
+        return false;
+
+    uint64_t total_weight = 0;
+    for (const WriterState& other : mWriters)
+    {
+        if (&other == &state || other.backloggedUntil <= now)
+            continue;
+
+        // Strict priority: a backlogged writer with higher priority is served first.
+        if (other.scheduling.priority > state.scheduling.priority)
+            return false;
+
+        if (other.scheduling.priority == state.scheduling.priority)
+            total_weight += std::max<uint32_t>(other.scheduling.weight, 1u);
+    }
+
+    // Without contenders the whole budget may be used. A writer may always send one change per period, so
+    // changes bigger than its share are not blocked forever.
+    if (total_weight == 0 || state.usedBytes == 0)
+        return true;
+
+    uint64_t weight = std::max<uint32_t>(state.scheduling.weight, 1u);
+    uint64_t share = (static_cast<uint64_t>(mBytesPerPeriod) * weight) / (total_weight + weight);
+    return (state.usedBytes + size) <= share;
+}
+
+void FairShareController::ScheduleRefresh(const GUID_t& writer, uint32_t sizeToRestore)
+{
+    std::shared_ptr<asio::steady_timer> throwawayTimer(std::make_shared<asio::steady_timer>(*FlowController::ControllerService));
+    auto refresh = [throwawayTimer, this, writer, sizeToRestore]
+        (const asio::error_code& error)
+        {
+            if ((error != asio::error::operation_aborted) &&
+                    FlowController::IsListening(this))
+            {
+                std::unique_lock<std::recursive_mutex> scopedLock(mFairShareControllerMutex);
+                throwawayTimer->cancel();
+                mAccumulatedPayloadSize = sizeToRestore > mAccumulatedPayloadSize ? 0 : mAccumulatedPayloadSize - sizeToRestore;
+
+                for (WriterState& state : mWriters)
+                {
+                    if (state.guid == writer)
+                    {
+                        state.usedBytes = sizeToRestore > state.usedBytes ? 0 : state.usedBytes - sizeToRestore;
+                        break;
+                    }
+                }
+
+                if (mAssociatedParticipant)
+                    AsyncWriterThread::wakeUp(mAssociatedParticipant);
+            }
+        };
+
+    throwawayTimer->expires_from_now(std::chrono::milliseconds(mPeriodMillisecs));
+    throwawayTimer->async_wait(refresh);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
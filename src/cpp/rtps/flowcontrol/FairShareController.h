@@ -0,0 +1,93 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FAIR_SHARE_CONTROLLER_H
+#define FAIR_SHARE_CONTROLLER_H
+
+#include "FlowController.h"
+#include <fastrtps/rtps/flowcontrol/ThroughputControllerDescriptor.h>
+#include <fastrtps/rtps/flowcontrol/FlowSchedulingDescriptor.h>
+#include <fastrtps/rtps/common/Guid.h>
+
+#include <chrono>
+#include <vector>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+
+class RTPSParticipantImpl;
+
+/**
+ * Participant filter that shares a throughput budget between the writers of the participant.
+ * Like the ThroughputController, it only clears changes up to a certain accumulated payload size per period,
+ * and the size of each change is restored one period after it was cleared.
+ *
+ * A writer whose changes could not be cleared is considered backlogged during the next two periods. While a
+ * writer is backlogged, writers with lower priority are not served, and writers with its same priority
+ * can only use the share of the budget given by their weights. Writers with no backlogged contenders may
+ * use the whole budget.
+ */
+class FairShareController : public FlowController
+{
+public:
+   FairShareController(const ThroughputControllerDescriptor&, const RTPSParticipantImpl* associatedParticipant);
+
+   virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend);
+   virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend);
+
+   void add_writer(const GUID_t& writer, const FlowSchedulingDescriptor& scheduling) override;
+   void remove_writer(const GUID_t& writer) override;
+
+private:
+
+   struct WriterState
+   {
+      GUID_t guid;
+      FlowSchedulingDescriptor scheduling;
+      //! Bytes cleared for this writer that have not been restored yet.
+      uint32_t usedBytes;
+      //! The writer is considered backlogged until this time.
+      std::chrono::steady_clock::time_point backloggedUntil;
+   };
+
+   template<class T>
+   void filter_nts_(RTPSWriterCollector<T>& changesToSend);
+
+   WriterState& writer_state_nts_(const GUID_t& writer);
+
+   bool may_send_nts_(const WriterState& state, uint32_t size,
+        const std::chrono::steady_clock::time_point& now) const;
+
+   uint32_t mBytesPerPeriod;
+   uint32_t mAccumulatedPayloadSize;
+   uint32_t mPeriodMillisecs;
+   std::recursive_mutex mFairShareControllerMutex;
+
+   const RTPSParticipantImpl* mAssociatedParticipant;
+
+   std::vector<WriterState> mWriters;
+
+   /*
+    * Schedules the filter to be refreshed in period ms. When it does, its capacity
+    * and the usage of the writer will be partially restored, by "sizeToRestore" bytes.
+    */
+   void ScheduleRefresh(const GUID_t& writer, uint32_t sizeToRestore);
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif
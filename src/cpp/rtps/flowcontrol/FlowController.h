@@ -16,6 +16,7 @@
 #define FLOW_CONTROLLER_H
 
 #include <fastrtps/rtps/common/CacheChange.h>
+#include <fastrtps/rtps/flowcontrol/FlowSchedulingDescriptor.h>
 #include "../writer/RTPSWriterCollector.h"
 
 #include <vector>
@@ -48,6 +49,12 @@ class FlowController
         virtual void operator()(RTPSWriterCollector<ReaderLocator*>& changesToSend) = 0;
         virtual void operator()(RTPSWriterCollector<ReaderProxy*>& changesToSend) = 0;
 
+        //! Called when a writer whose changes may go through this controller is created.
+        virtual void add_writer(const GUID_t&, const FlowSchedulingDescriptor&) {}
+
+        //! Called when a writer whose changes may go through this controller is destroyed.
+        virtual void remove_writer(const GUID_t&) {}
+
         virtual ~FlowController();
         FlowController();
 
@@ -0,0 +1,157 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * @file CacheChangeFreeList.hpp
+ *
+ */
+
+#ifndef FASTRTPS_RTPS_HISTORY_CACHECHANGEFREELIST_HPP_
+#define FASTRTPS_RTPS_HISTORY_CACHECHANGEFREELIST_HPP_
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+struct CacheChange_t;
+
+/**
+ * Bounded lock-free free list of CacheChanges with the same payload size.
+ * It is a multi-producer multi-consumer ring where each cell carries a sequence number telling whether it can be
+ * written or read in the current lap, so no lock is taken and a cell is never reused before it is consumed.
+ */
+class CacheChangeFreeList
+{
+    public:
+
+        CacheChangeFreeList(uint32_t payload_size, uint32_t capacity)
+            : payload_size_(payload_size)
+            , mask_(0)
+            , push_pos_(0)
+            , pop_pos_(0)
+        {
+            size_t cells = 2;
+            while(cells < capacity)
+            {
+                cells <<= 1;
+            }
+
+            mask_ = cells - 1;
+            cells_.reset(new Cell[cells]);
+            for(size_t i = 0; i < cells; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+                cells_[i].change = nullptr;
+            }
+        }
+
+        uint32_t payload_size() const
+        {
+            return payload_size_;
+        }
+
+        //!Returns false when the free list is full, including while the pop of the next cell is still in progress.
+        bool push(CacheChange_t* change)
+        {
+            size_t pos = push_pos_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+
+            for(;;)
+            {
+                cell = &cells_[pos & mask_];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+                if(diff == 0)
+                {
+                    if(push_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = push_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->change = change;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        //!Returns nullptr when the free list is empty.
+        CacheChange_t* pop()
+        {
+            size_t pos = pop_pos_.load(std::memory_order_relaxed);
+            Cell* cell = nullptr;
+
+            for(;;)
+            {
+                cell = &cells_[pos & mask_];
+                size_t sequence = cell->sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)sequence - (intptr_t)(pos + 1);
+                if(diff == 0)
+                {
+                    if(pop_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if(diff < 0)
+                {
+                    return nullptr;
+                }
+                else
+                {
+                    pos = pop_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            CacheChange_t* change = cell->change;
+            cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+            return change;
+        }
+
+    private:
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            CacheChange_t* change;
+        };
+
+        uint32_t payload_size_;
+        size_t mask_;
+        std::unique_ptr<Cell[]> cells_;
+        std::atomic<size_t> push_pos_;
+        std::atomic<size_t> pop_pos_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+#endif // FASTRTPS_RTPS_HISTORY_CACHECHANGEFREELIST_HPP_
@@ -21,7 +21,10 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 #include <fastrtps/log/Log.h>
 
+#include "CacheChangeFreeList.hpp"
+
 #include <mutex>
+#include <algorithm>
 
 #include <cassert>
 
@@ -30,6 +33,10 @@ namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+//!Payload sizes of the classes used on DYNAMIC_REUSABLE_MEMORY_MODE.
+static const uint32_t c_PayloadSizeClasses[] = {256, 4096, 65536, 1048576};
+//!Capacity of each free list on DYNAMIC_REUSABLE_MEMORY_MODE when the pool has no maximum size.
+static const uint32_t c_DefaultFreeListCapacity = 64;
 
 CacheChangePool::~CacheChangePool()
 {
@@ -42,7 +49,8 @@ CacheChangePool::~CacheChangePool()
 }
 
 CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32_t max_pool_size, MemoryManagementPolicy_t memoryPolicy) : 
-    memoryMode(memoryPolicy)
+    memoryMode(memoryPolicy),
+    m_reusable_pool_size(0)
 {
     //Common for all modes: Set the payload size (maximum allowed), size and size limit
     ++pool_size;
@@ -76,6 +84,24 @@ CacheChangePool::CacheChangePool(int32_t pool_size, uint32_t payload_size, int32
         case DYNAMIC_RESERVE_MEMORY_MODE:
             logInfo(RTPS_UTILS,"Dynamic Mode is active, CacheChanges are allocated on request");
             break;
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+        {
+            logInfo(RTPS_UTILS,"Dynamic Reusable Mode is active, CacheChanges are allocated on request and reused");
+            uint32_t capacity = m_max_pool_size > 0 ? m_max_pool_size :
+                std::max((uint32_t)pool_size, c_DefaultFreeListCapacity);
+            for(uint32_t size_class : c_PayloadSizeClasses)
+            {
+                if(payload_size == 0 || size_class < payload_size)
+                {
+                    m_sizeClasses.emplace_back(new CacheChangeFreeList(size_class, capacity));
+                }
+            }
+            if(payload_size > 0)
+            {
+                m_sizeClasses.emplace_back(new CacheChangeFreeList(payload_size, capacity));
+            }
+            break;
+        }
     }
 }
 
@@ -141,6 +167,9 @@ bool CacheChangePool::reserve_Cache(CacheChange_t** chan, uint32_t dataSize)
             *chan = allocateSingle(dataSize); //Allocates a single, empty CacheChange. Allocated on Copy
             if(*chan == nullptr) return false;
             break;
+
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            return reserveReusable(chan, dataSize);
     }
 
     return true;
@@ -165,6 +194,7 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
             m_freeCaches.push_back(ch);
             break;
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
             ch->kind = ALIVE;
             ch->sequenceNumber.high = 0;
             ch->sequenceNumber.low = 0;
@@ -176,7 +206,14 @@ void CacheChangePool::release_Cache(CacheChange_t* ch)
             ch->isRead = 0;
             ch->sourceTimestamp.seconds = 0;
             ch->sourceTimestamp.fraction = 0;
-            m_freeCaches.push_back(ch);
+            if(memoryMode == DYNAMIC_REUSABLE_MEMORY_MODE)
+            {
+                releaseReusable(ch);
+            }
+            else
+            {
+                m_freeCaches.push_back(ch);
+            }
             break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
             // Find pointer in CacheChange vector, remove element, then delete it
@@ -266,6 +303,111 @@ CacheChange_t* CacheChangePool::allocateSingle(uint32_t dataSize)
     return ch;
 }
 
+bool CacheChangePool::reserveReusable(CacheChange_t** chan, uint32_t dataSize)
+{
+    // Smallest size class where the data fits. Bigger data gets a CacheChange of its own size, never reused.
+    CacheChangeFreeList* size_class = nullptr;
+    for(auto& free_list : m_sizeClasses)
+    {
+        if(free_list->payload_size() >= dataSize)
+        {
+            size_class = free_list.get();
+            break;
+        }
+    }
+
+    if(size_class != nullptr)
+    {
+        *chan = size_class->pop();
+        if(*chan != nullptr)
+        {
+            return true;
+        }
+    }
+
+    // Account the new CacheChange, making room by deleting a released one of other size class when the pool is full.
+    uint32_t pool_size = m_reusable_pool_size.load(std::memory_order_relaxed);
+    for(;;)
+    {
+        if(m_max_pool_size == 0 || pool_size < m_max_pool_size)
+        {
+            if(m_reusable_pool_size.compare_exchange_weak(pool_size, pool_size + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if(!deleteUnusedReusable())
+        {
+            logWarning(RTPS_HISTORY, "Maximum number of allowed reserved caches reached");
+            *chan = nullptr;
+            return false;
+        }
+        else
+        {
+            pool_size = m_reusable_pool_size.load(std::memory_order_relaxed);
+        }
+    }
+
+    CacheChange_t* ch = new CacheChange_t(size_class != nullptr ? size_class->payload_size() : dataSize);
+    {
+        std::lock_guard<std::mutex> guard(m_allCachesMutex);
+        m_allCaches.push_back(ch);
+    }
+
+    *chan = ch;
+    return true;
+}
+
+void CacheChangePool::releaseReusable(CacheChange_t* ch)
+{
+    for(auto& free_list : m_sizeClasses)
+    {
+        if(free_list->payload_size() == ch->serializedPayload.max_size)
+        {
+            if(free_list->push(ch))
+            {
+                return;
+            }
+            break;
+        }
+    }
+
+    // The payload was resized, its size has no class or the free list is full.
+    deleteReusable(ch);
+}
+
+bool CacheChangePool::deleteUnusedReusable()
+{
+    for(auto& free_list : m_sizeClasses)
+    {
+        CacheChange_t* ch = free_list->pop();
+        if(ch != nullptr)
+        {
+            deleteReusable(ch);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void CacheChangePool::deleteReusable(CacheChange_t* ch)
+{
+    {
+        std::lock_guard<std::mutex> guard(m_allCachesMutex);
+        auto target = std::find(m_allCaches.begin(), m_allCaches.end(), ch);
+        if(target == m_allCaches.end())
+        {
+            logInfo(RTPS_UTILS,"Tried to release a CacheChange that is not logged in the Pool");
+            return;
+        }
+        m_allCaches.erase(target);
+    }
+
+    delete(ch);
+    m_reusable_pool_size.fetch_sub(1, std::memory_order_relaxed);
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
@@ -58,6 +58,11 @@ bool ReaderHistory::received_change(CacheChange_t* change, size_t)
     return add_change(change);
 }
 
+bool ReaderHistory::is_change_expired(const CacheChange_t*) const
+{
+    return false;
+}
+
 bool ReaderHistory::add_change(CacheChange_t* a_change)
 {
 
@@ -19,6 +19,7 @@
 #include <fastrtps/rtps/history/WriterHistory.h>
 
 #include <fastrtps/log/Log.h>
+#include <fastrtps/utils/eClock.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include "fastrtps/rtps/common/WriteParams.h"
 
@@ -88,6 +89,14 @@ bool WriterHistory::add_change_(CacheChange_t* a_change, WriteParams &wparams,
     ++m_lastCacheChangeSeqNum;
     a_change->sequenceNumber = m_lastCacheChangeSeqNum;
 
+    // Source timestamp is taken when the change enters the history, so every (re)transmission of
+    // the change carries the same timestamp.
+    if(a_change->sourceTimestamp == c_TimeZero)
+    {
+        eClock clock;
+        clock.setTimeNow(&a_change->sourceTimestamp);
+    }
+
     a_change->write_params = wparams;
     // Updated sample identity
     wparams.sample_identity().writer_guid(a_change->writerGUID);
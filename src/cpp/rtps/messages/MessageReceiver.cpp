@@ -31,6 +31,7 @@
 #include <fastrtps/rtps/reader/ReaderListener.h>
 
 #include "../participant/RTPSParticipantImpl.h"
+#include "../../utils/Tracepoints.hpp"
 
 #include <mutex>
 
@@ -145,6 +146,9 @@ void MessageReceiver::processCDRMsg(const Locator_t& loc, CDRMessage_t*msg)
 {
     (void)loc;
 
+    participant_->statistics_counters().datagrams_received.fetch_add(1, std::memory_order_relaxed);
+    participant_->statistics_counters().bytes_received.fetch_add(msg->length, std::memory_order_relaxed);
+
     if(msg->length < RTPSMESSAGE_HEADER_SIZE)
     {
         logWarning(RTPS_MSG_IN,IDSTRING"Received message too short, ignoring");
@@ -564,6 +568,8 @@ bool MessageReceiver::proc_Submsg_Data(CDRMessage_t* msg,SubmessageHeader_t* smh
     }
 
 
+    FASTRTPS_TRACE_DATA_RECEIVED(ch.writerGUID, ch.sequenceNumber, ch.serializedPayload.length);
+
     //FIXME: DO SOMETHING WITH PARAMETERLIST CREATED.
     logInfo(RTPS_MSG_IN,IDSTRING"from Writer " << ch.writerGUID << "; possible RTPSReaders: "<<AssociatedReaders.size());
     //Look for the correct reader to add the change
@@ -922,11 +928,16 @@ bool MessageReceiver::proc_Submsg_InfoDST(CDRMessage_t* msg,SubmessageHeader_t*
         msg->msg_endian = BIGEND;
     GuidPrefix_t guidP;
     CDRMessage::readData(msg,guidP.value,12);
+    // An unknown prefix addresses the following submessages to any participant, as at the beginning of the message.
     if(guidP != c_GuidPrefix_Unknown)
     {
         this->destGuidPrefix = guidP;
-        logInfo(RTPS_MSG_IN,IDSTRING"DST RTPSParticipant is now: "<< this->destGuidPrefix);
     }
+    else
+    {
+        this->destGuidPrefix = participant_->getGuid().guidPrefix;
+    }
+    logInfo(RTPS_MSG_IN,IDSTRING"DST RTPSParticipant is now: "<< this->destGuidPrefix);
     return true;
 }
 
@@ -90,7 +90,7 @@ bool RTPSMessageCreator::addSubmessageHeader(
     return true;
 }
 
-bool RTPSMessageCreator::addSubmessageInfoTS(CDRMessage_t* msg,Time_t& time,bool invalidateFlag)
+bool RTPSMessageCreator::addSubmessageInfoTS(CDRMessage_t* msg,const Time_t& time,bool invalidateFlag)
 {
     octet flags = 0x0;
     uint16_t size = 8;
@@ -20,8 +20,11 @@
 #include <fastrtps/rtps/messages/RTPSMessageGroup.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
 #include <fastrtps/rtps/writer/RTPSWriter.h>
+#include <fastrtps/rtps/reader/RTPSReader.h>
 #include "../participant/RTPSParticipantImpl.h"
+#include "../participant/SubmessageBatcher.h"
 #include "../flowcontrol/FlowController.h"
+#include "../../utils/Tracepoints.hpp"
 
 #include <fastrtps/log/Log.h>
 
@@ -146,6 +149,9 @@ RTPSMessageGroup::RTPSMessageGroup(
         std::chrono::steady_clock::time_point max_blocking_time_point)
     : participant_(participant)
     , endpoint_(endpoint)
+    , writer_counters_(type == WRITER ? &static_cast<RTPSWriter*>(endpoint)->statistics_counters_ : nullptr)
+    , reader_counters_(type == READER ? &static_cast<RTPSReader*>(endpoint)->statistics_counters_ : nullptr)
+    , send_key_hash_(type == WRITER && static_cast<RTPSWriter*>(endpoint)->send_key_hash())
     , full_msg_(&msg_group.rtpsmsg_fullmsg_)
     , submessage_msg_(&msg_group.rtpsmsg_submessage_)
     , currentBytesSent_(0)
@@ -153,6 +159,7 @@ RTPSMessageGroup::RTPSMessageGroup(
     , fixed_destination_locators_(nullptr)
     , fixed_destination_guids_(nullptr)
     , fixed_destination_prefix_()
+    , has_data_(false)
 #if HAVE_SECURITY
     , encrypt_msg_(&msg_group.rtpsmsg_encrypt_)
 #endif
@@ -160,7 +167,6 @@ RTPSMessageGroup::RTPSMessageGroup(
 {
     assert(participant);
     assert(endpoint);
-    (void)type;
 
     // Init RTPS message.
     reset_to_header();
@@ -236,7 +242,28 @@ void RTPSMessageGroup::reset_to_header()
     CDRMessage::initCDRMsg(full_msg_);
     full_msg_->pos = RTPSMESSAGE_HEADER_SIZE;
     full_msg_->length = RTPSMESSAGE_HEADER_SIZE;
+    has_data_ = false;
+
+#if HAVE_TRACEPOINTS
+    trace_first_seq_ = 0;
+    trace_last_seq_ = 0;
+#endif
+}
+
+#if HAVE_TRACEPOINTS
+void RTPSMessageGroup::trace_data_added(const SequenceNumber_t& seq)
+{
+    uint64_t value = seq.to64long();
+    if(trace_first_seq_ == 0 || value < trace_first_seq_)
+    {
+        trace_first_seq_ = value;
+    }
+    if(value > trace_last_seq_)
+    {
+        trace_last_seq_ = value;
+    }
 }
+#endif
 
 bool RTPSMessageGroup::check_preconditions(const LocatorList_t& locator_list,
         const std::vector<GUID_t>& remote_endpoints) const
@@ -286,12 +313,34 @@ void RTPSMessageGroup::send()
 #endif
         const LocatorList_t & destinations =
             fixed_destination_ ? *fixed_destination_locators_ : current_locators_;
+        FASTRTPS_TRACE_MESSAGE_SEND(endpoint_->getGuid(), trace_first_seq_, trace_last_seq_, msgToSend->length,
+                destinations.size());
+
+        // Control submessages are merged with the ones of other endpoints, unless the whole message is protected.
+        SubmessageBatcher* batcher = (!has_data_ && msgToSend == full_msg_) ?
+            participant_->submessage_batcher() : nullptr;
+        int32_t transport_priority = endpoint_->getAttributes().transport_priority;
+
+        auto send_start = std::chrono::steady_clock::now();
+        bool sent_directly = false;
         for(const auto& lit : destinations)
         {
+            if(batcher != nullptr && batcher->add(msgToSend, transport_priority, lit))
+            {
+                continue;
+            }
+
             if(!participant_->sendSync(msgToSend, endpoint_, lit, max_blocking_time_point_))
             {
                 throw timeout();
             }
+            sent_directly = true;
+        }
+
+        // Messages only appended to batches are sent later, when the participant flushes them.
+        if (writer_counters_ != nullptr && sent_directly)
+        {
+            writer_counters_->send_latency.record(std::chrono::steady_clock::now() - send_start);
         }
 
         currentBytesSent_ += msgToSend->length;
@@ -390,7 +439,7 @@ bool RTPSMessageGroup::add_info_dst_in_buffer(CDRMessage_t* buffer, const std::v
     return true;
 }
 
-bool RTPSMessageGroup::add_info_ts_in_buffer(const std::vector<GUID_t>& remote_readers)
+bool RTPSMessageGroup::add_info_ts_in_buffer(const Time_t& timestamp, const std::vector<GUID_t>& remote_readers)
 {
     (void)remote_readers;
     logInfo(RTPS_WRITER, "Sending INFO_TS message");
@@ -399,9 +448,13 @@ bool RTPSMessageGroup::add_info_ts_in_buffer(const std::vector<GUID_t>& remote_r
     uint32_t from_buffer_position = submessage_msg_->pos;
 #endif
 
-    // Insert INFO_TS submessage.
-    // TODO (Ricardo) Source timestamp maybe has marked when user call write function.
-    if(!RTPSMessageCreator::addSubmessageInfoTS_Now(submessage_msg_, false)) //Change here to add a INFO_TS for DATA.
+    // Insert INFO_TS submessage with the source timestamp of the change.
+    // Changes without source timestamp are stamped with the current time.
+    bool added = timestamp == c_TimeZero ?
+        RTPSMessageCreator::addSubmessageInfoTS_Now(submessage_msg_, false) :
+        RTPSMessageCreator::addSubmessageInfoTS(submessage_msg_, timestamp, false);
+
+    if(!added)
     {
         logError(RTPS_WRITER, "Cannot add INFO_TS submsg to the CDRMessage. Buffer too small");
         return false;
@@ -444,7 +497,10 @@ bool RTPSMessageGroup::add_data(const CacheChange_t& change, const std::vector<G
     // Check preconditions. If fail flush and reset.
     check_and_maybe_flush(locators, remote_readers);
 
-    add_info_ts_in_buffer(remote_readers);
+    add_info_ts_in_buffer(change.sourceTimestamp, remote_readers);
+
+    // The key hash is sent as inline QoS.
+    expectsInlineQos |= send_key_hash_ && change.instanceHandle.isDefined();
 
     InlineQosWriter* inlineQos = nullptr;
     if(expectsInlineQos)
@@ -493,7 +549,24 @@ bool RTPSMessageGroup::add_data(const CacheChange_t& change, const std::vector<G
     }
 #endif
 
-    return insert_submessage(remote_readers);
+    if(!insert_submessage(remote_readers))
+    {
+        return false;
+    }
+
+    has_data_ = true;
+
+#if HAVE_TRACEPOINTS
+    trace_data_added(change.sequenceNumber);
+#endif
+
+    if(writer_counters_ != nullptr)
+    {
+        writer_counters_->samples_sent.fetch_add(1, std::memory_order_relaxed);
+        writer_counters_->bytes_sent.fetch_add(change.serializedPayload.length, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
 bool RTPSMessageGroup::add_data_frag(const CacheChange_t& change, const uint32_t fragment_number,
@@ -504,7 +577,10 @@ bool RTPSMessageGroup::add_data_frag(const CacheChange_t& change, const uint32_t
     // Check preconditions. If fail flush and reset.
     check_and_maybe_flush(locators, remote_readers);
 
-    add_info_ts_in_buffer(remote_readers);
+    add_info_ts_in_buffer(change.sourceTimestamp, remote_readers);
+
+    // The key hash is sent as inline QoS.
+    expectsInlineQos |= send_key_hash_ && change.instanceHandle.isDefined();
 
     InlineQosWriter* inlineQos = NULL;
     if(expectsInlineQos)
@@ -589,7 +665,24 @@ bool RTPSMessageGroup::add_data_frag(const CacheChange_t& change, const uint32_t
     }
 #endif
 
-    return insert_submessage(remote_readers);
+    if(!insert_submessage(remote_readers))
+    {
+        return false;
+    }
+
+    has_data_ = true;
+
+#if HAVE_TRACEPOINTS
+    trace_data_added(change.sequenceNumber);
+#endif
+
+    if(writer_counters_ != nullptr)
+    {
+        writer_counters_->fragments_sent.fetch_add(1, std::memory_order_relaxed);
+        writer_counters_->bytes_sent.fetch_add(fragment_size, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
 bool RTPSMessageGroup::add_heartbeat(const std::vector<GUID_t>& remote_readers, const SequenceNumber_t& firstSN,
@@ -637,7 +730,17 @@ bool RTPSMessageGroup::add_heartbeat(const std::vector<GUID_t>& remote_readers,
     }
 #endif
 
-    return insert_submessage(remote_readers);
+    if(!insert_submessage(remote_readers))
+    {
+        return false;
+    }
+
+    if(writer_counters_ != nullptr)
+    {
+        writer_counters_->heartbeats_sent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
 // TODO (Ricardo) Check with standard 8.3.7.4.5
@@ -697,6 +800,11 @@ bool RTPSMessageGroup::add_gap(std::set<SequenceNumber_t>& changesSeqNum,
         if(!insert_submessage(remote_readers))
             break;
 
+        if(writer_counters_ != nullptr)
+        {
+            writer_counters_->gaps_sent.fetch_add(1, std::memory_order_relaxed);
+        }
+
         ++gap_n;
         ++seqit;
     }
@@ -749,7 +857,17 @@ bool RTPSMessageGroup::add_acknack(const std::vector<GUID_t>& remote_writers, Se
     }
 #endif
 
-    return insert_submessage(remote_writers);
+    if(!insert_submessage(remote_writers))
+    {
+        return false;
+    }
+
+    if(reader_counters_ != nullptr)
+    {
+        reader_counters_->acknacks_sent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
 bool RTPSMessageGroup::add_nackfrag(const std::vector<GUID_t>& remote_writers, SequenceNumber_t& writerSN,
@@ -797,7 +915,17 @@ bool RTPSMessageGroup::add_nackfrag(const std::vector<GUID_t>& remote_writers, S
     }
 #endif
 
-    return insert_submessage(remote_writers);
+    if(!insert_submessage(remote_writers))
+    {
+        return false;
+    }
+
+    if(reader_counters_ != nullptr)
+    {
+        reader_counters_->nackfrags_sent.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
 } /* namespace rtps */
@@ -20,6 +20,8 @@
 #include "RTPSParticipantImpl.h"
 
 #include "../flowcontrol/ThroughputController.h"
+#include "../flowcontrol/FairShareController.h"
+#include "SubmessageBatcher.h"
 #include "../persistence/PersistenceService.h"
 
 #include <fastrtps/rtps/resources/ResourceEvent.h>
@@ -46,6 +48,7 @@
 #include <fastrtps/rtps/builtin/discovery/participant/PDPSimple.h>
 #include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
 #include <fastrtps/rtps/builtin/liveliness/WLP.h>
+#include <fastrtps/utils/TimeConversion.h>
 
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/eClock.h>
@@ -90,6 +93,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
 #if HAVE_SECURITY
     , m_security_manager(this)
 #endif
+    , submessage_batcher_(nullptr)
     , mp_participantListener(plisten)
     , mp_userParticipant(par)
     , mp_mutex(new std::recursive_mutex())
@@ -110,16 +114,31 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     }
 
     mp_userParticipant->mp_impl = this;
-    mp_event_thr = new ResourceEvent();
-    mp_event_thr->init_thread(this);
+    if (m_att.sharedEventThreads > 0)
+    {
+        mp_event_thr = ResourceEvent::acquire_shared(m_att.sharedEventThreads);
+    }
+    else
+    {
+        mp_event_thr = new ResourceEvent();
+        mp_event_thr->init_thread(this);
+    }
 
-    // Throughput controller, if the descriptor has valid values
+    // Throughput controller, if the descriptor has valid values.
+    // Its budget is shared between the writers according to their scheduling.
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
     {
-        std::unique_ptr<FlowController> controller(new ThroughputController(PParam.throughputController, this));
+        std::unique_ptr<FlowController> controller(new FairShareController(PParam.throughputController, this));
         m_controllers.push_back(std::move(controller));
     }
 
+    // Control submessages of all the endpoints are merged per destination during the batching window.
+    if (m_att.submessageBatchingWindow != c_TimeZero)
+    {
+        submessage_batcher_ = new SubmessageBatcher(this,
+                TimeConv::Time_t2MilliSecondsDouble(m_att.submessageBatchingWindow));
+    }
+
     /// Creation of metatraffic locator and receiver resources
     uint32_t metatraffic_multicast_port = m_att.port.getMulticastPort(m_att.builtin.domainId);
     uint32_t metatraffic_unicast_port = m_att.port.getUnicastPort(m_att.builtin.domainId, m_att.participantID);
@@ -130,9 +149,13 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     /* INSERT DEFAULT MANDATORY MULTICAST LOCATORS HERE */
     if(m_att.builtin.metatrafficMulticastLocatorList.empty() && m_att.builtin.metatrafficUnicastLocatorList.empty())
     {
-        m_network_Factory.getDefaultMetatrafficMulticastLocators(m_att.builtin.metatrafficMulticastLocatorList,
-            metatraffic_multicast_port);
-        m_network_Factory.NormalizeLocators(m_att.builtin.metatrafficMulticastLocatorList);
+        // Discovery clients and servers only exchange metatraffic through unicast.
+        if(m_att.builtin.discoveryProtocol == DiscoveryProtocol_t::SIMPLE)
+        {
+            m_network_Factory.getDefaultMetatrafficMulticastLocators(m_att.builtin.metatrafficMulticastLocatorList,
+                metatraffic_multicast_port);
+            m_network_Factory.NormalizeLocators(m_att.builtin.metatrafficMulticastLocatorList);
+        }
 
         m_network_Factory.getDefaultMetatrafficUnicastLocators(m_att.builtin.metatrafficUnicastLocatorList,
             metatraffic_unicast_port);
@@ -159,6 +182,11 @@ RTPSParticipantImpl::RTPSParticipantImpl(const RTPSParticipantAttributes& PParam
     createReceiverResources(m_att.builtin.metatrafficUnicastLocatorList, true);
 
     // Initial peers
+    if(m_att.builtin.discoveryProtocol == DiscoveryProtocol_t::CLIENT && m_att.builtin.initialPeersList.empty())
+    {
+        m_att.builtin.initialPeersList = m_att.builtin.discoveryServersList;
+    }
+
     if(m_att.builtin.initialPeersList.empty())
     {
         m_att.builtin.initialPeersList = m_att.builtin.metatrafficMulticastLocatorList;
@@ -263,6 +291,9 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
 
     delete(this->mp_builtinProtocols);
 
+    // Sends the submessages still batched.
+    delete(this->submessage_batcher_);
+
 #if HAVE_SECURITY
     m_security_manager.destroy();
 #endif
@@ -278,7 +309,14 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
     delete(this->mp_userParticipant);
     send_resource_list_.clear();
 
-    delete(this->mp_event_thr);
+    if (m_att.sharedEventThreads > 0)
+    {
+        ResourceEvent::release_shared(this->mp_event_thr);
+    }
+    else
+    {
+        delete(this->mp_event_thr);
+    }
     delete(this->mp_mutex);
 }
 
@@ -432,6 +470,11 @@ bool RTPSParticipantImpl::createWriter(RTPSWriter** WriterOut, WriterAttributes&
     }
     *WriterOut = SWriter;
 
+    for (std::unique_ptr<FlowController>& controller : m_controllers)
+    {
+        controller->add_writer(SWriter->getGuid(), param.flowScheduling);
+    }
+
     // If the terminal throughput controller has proper user defined values, instantiate it
     if (param.throughputController.bytesPerPeriod != UINT32_MAX && param.throughputController.periodMillisecs != 0)
     {
@@ -888,6 +931,11 @@ bool RTPSParticipantImpl::deleteUserEndpoint(Endpoint* p_endpoint)
         //REMOVE FOR BUILTINPROTOCOLS
         if(p_endpoint->getAttributes().endpointKind == WRITER)
         {
+            for (std::unique_ptr<FlowController>& controller : m_controllers)
+            {
+                controller->remove_writer(p_endpoint->getGuid());
+            }
+
             if (found_in_users)
             {
                 mp_builtinProtocols->removeLocalWriter((RTPSWriter*)p_endpoint);
@@ -940,7 +988,17 @@ std::vector<std::string> RTPSParticipantImpl::getParticipantNames() const
 
 bool RTPSParticipantImpl::sendSync(
         CDRMessage_t* msg,
-        Endpoint* /*pend*/,
+        Endpoint* pend,
+        const Locator_t& destination_loc,
+        std::chrono::steady_clock::time_point& max_blocking_time_point)
+{
+    int32_t transport_priority = pend != nullptr ? pend->getAttributes().transport_priority : 0;
+    return sendSync(msg, transport_priority, destination_loc, max_blocking_time_point);
+}
+
+bool RTPSParticipantImpl::sendSync(
+        CDRMessage_t* msg,
+        int32_t transport_priority,
         const Locator_t& destination_loc,
         std::chrono::steady_clock::time_point& max_blocking_time_point)
 {
@@ -950,10 +1008,24 @@ bool RTPSParticipantImpl::sendSync(
     if(lock.try_lock_until(max_blocking_time_point))
     {
         ret_code = true;
+        bool sent = false;
 
+        auto send_start = std::chrono::steady_clock::now();
         for (auto& send_resource : send_resource_list_)
         {
-            send_resource->send(msg->buffer, msg->length, destination_loc);
+            sent |= send_resource->send(msg->buffer, msg->length, destination_loc, transport_priority);
+        }
+
+        // Only one of the send resources is expected to support the destination locator.
+        if (sent)
+        {
+            statistics_counters_.send_latency.record(std::chrono::steady_clock::now() - send_start);
+            statistics_counters_.datagrams_sent.fetch_add(1, std::memory_order_relaxed);
+            statistics_counters_.bytes_sent.fetch_add(msg->length, std::memory_order_relaxed);
+        }
+        else
+        {
+            statistics_counters_.send_errors.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
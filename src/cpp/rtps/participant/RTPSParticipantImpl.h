@@ -36,6 +36,7 @@
 
 #include <fastrtps/rtps/attributes/RTPSParticipantAttributes.h>
 #include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/rtps/common/EntityStatistics.h>
 #include <fastrtps/rtps/builtin/discovery/endpoint/EDPSimple.h>
 #include <fastrtps/rtps/builtin/data/ReaderProxyData.h>
 #include <fastrtps/rtps/builtin/data/WriterProxyData.h>
@@ -77,6 +78,7 @@ class ReaderHistory;
 class ReaderListener;
 class StatefulReader;
 class PDPSimple;
+class SubmessageBatcher;
 class FlowController;
 class IPersistenceService;
 
@@ -178,6 +180,22 @@ public:
             const Locator_t& destination_loc,
             std::chrono::steady_clock::time_point& max_blocking_time_point);
 
+    /**
+     * Sends a message to a locator with the given transport priority.
+     * @return False when the send resources could not be taken before max_blocking_time_point.
+     */
+    bool sendSync(
+            CDRMessage_t* msg,
+            int32_t transport_priority,
+            const Locator_t& destination_loc,
+            std::chrono::steady_clock::time_point& max_blocking_time_point);
+
+    /**
+     * Get the stage merging the submessages of the endpoints of this participant.
+     * @return Pointer to the batcher, or nullptr when submessage batching is disabled.
+     */
+    SubmessageBatcher* submessage_batcher() { return submessage_batcher_; }
+
     //!Get the participant Mutex
     std::recursive_mutex* getParticipantMutex() const { return mp_mutex; };
 
@@ -197,6 +215,20 @@ public:
 
     std::vector<std::unique_ptr<FlowController>>& getFlowControllers() { return m_controllers; }
 
+    /**
+     * Get a snapshot of the counters of this participant.
+     * @return Copy of the counters.
+     */
+    ParticipantStatistics get_statistics() const
+    {
+        ParticipantStatistics statistics;
+        statistics_counters_.snapshot(statistics);
+        return statistics;
+    }
+
+    //! Counters of the traffic of this participant. Thread-safe.
+    ParticipantCounters& statistics_counters() { return statistics_counters_; }
+
     /*!
         * @remarks Non thread-safe.
         */
@@ -285,6 +317,12 @@ private:
     std::timed_mutex m_send_resources_mutex_;
     SendResourceList send_resource_list_;
 
+    //!Counters of the traffic of all the transports of this participant
+    ParticipantCounters statistics_counters_;
+
+    //!Merges the submessages sent by the endpoints to the same locator. Null when disabled.
+    SubmessageBatcher* submessage_batcher_;
+
     //!Participant Listener
     RTPSParticipantListener* mp_participantListener;
     //!Pointer to the user participant
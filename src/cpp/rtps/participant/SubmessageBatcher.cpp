@@ -0,0 +1,198 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SubmessageBatcher.cpp
+ *
+ */
+
+#include "SubmessageBatcher.h"
+#include "RTPSParticipantImpl.h"
+
+#include <fastrtps/rtps/messages/CDRMessage.h>
+#include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastrtps/rtps/messages/RTPS_messages.h>
+#include <fastrtps/rtps/resources/ResourceEvent.h>
+
+#include <fastrtps/log/Log.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+//! Length of an INFO_DST submessage.
+static const uint32_t info_dst_size = RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12;
+
+SubmessageBatcher::FlushEvent::FlushEvent(
+        SubmessageBatcher* batcher,
+        RTPSParticipantImpl* participant,
+        double interval_in_ms)
+    : TimedEvent(
+            participant->getEventResource().getIOService(),
+            participant->getEventResource().getThread(),
+            interval_in_ms)
+    , batcher_(batcher)
+{
+}
+
+SubmessageBatcher::FlushEvent::~FlushEvent()
+{
+    destroy();
+}
+
+void SubmessageBatcher::FlushEvent::event(
+        EventCode code,
+        const char* msg)
+{
+    // Unused in release mode.
+    (void)msg;
+
+    if (code == EVENT_SUCCESS)
+    {
+        logInfo(RTPS_PARTICIPANT, "Submessage batching window expired, sending batched submessages");
+        batcher_->flush();
+    }
+}
+
+SubmessageBatcher::SubmessageBatcher(
+        RTPSParticipantImpl* participant,
+        double window_in_ms)
+    : participant_(participant)
+    , max_message_size_(participant->getMaxMessageSize())
+    , pending_(false)
+    , flush_event_(new FlushEvent(this, participant, window_in_ms))
+{
+}
+
+SubmessageBatcher::~SubmessageBatcher()
+{
+    delete flush_event_;
+    flush();
+}
+
+bool SubmessageBatcher::add(
+        const CDRMessage_t* msg,
+        int32_t transport_priority,
+        const Locator_t& destination)
+{
+    if (msg->length <= RTPSMESSAGE_HEADER_SIZE)
+    {
+        return true;
+    }
+
+    uint32_t submessages_length = msg->length - RTPSMESSAGE_HEADER_SIZE;
+    bool starts_with_info_dst = msg->buffer[RTPSMESSAGE_HEADER_SIZE] == INFO_DST;
+
+    // Worst case, the submessages are appended to a batch of other endpoints and need an INFO_DST.
+    if (RTPSMESSAGE_HEADER_SIZE + info_dst_size + submessages_length > max_message_size_)
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    Batch& batch = batch_nts(destination, transport_priority);
+
+    uint32_t needed = submessages_length;
+    if (batch.msg.length > RTPSMESSAGE_HEADER_SIZE && !starts_with_info_dst)
+    {
+        needed += info_dst_size;
+    }
+
+    if (batch.msg.length + needed > batch.msg.max_size)
+    {
+        send_nts(batch);
+    }
+    else if (batch.msg.length > RTPSMESSAGE_HEADER_SIZE && !starts_with_info_dst)
+    {
+        // Receivers address the following submessages to any participant again.
+        RTPSMessageCreator::addSubmessageInfoDST(&batch.msg, c_GuidPrefix_Unknown);
+    }
+
+    CDRMessage::addData(&batch.msg, &msg->buffer[RTPSMESSAGE_HEADER_SIZE], submessages_length);
+
+    if (!pending_)
+    {
+        pending_ = true;
+        flush_event_->restart_timer();
+    }
+
+    return true;
+}
+
+void SubmessageBatcher::flush()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+
+    auto it = batches_.begin();
+    while (it != batches_.end())
+    {
+        if ((*it)->msg.length > RTPSMESSAGE_HEADER_SIZE)
+        {
+            send_nts(**it);
+            ++it;
+        }
+        else
+        {
+            // Nothing was sent to this destination during the last window.
+            it = batches_.erase(it);
+        }
+    }
+
+    pending_ = false;
+}
+
+SubmessageBatcher::Batch& SubmessageBatcher::batch_nts(
+        const Locator_t& destination,
+        int32_t transport_priority)
+{
+    for (auto& batch : batches_)
+    {
+        if (batch->locator == destination && batch->transport_priority == transport_priority)
+        {
+            return *batch;
+        }
+    }
+
+    batches_.emplace_back(new Batch(destination, transport_priority, max_message_size_));
+    Batch& batch = *batches_.back();
+    CDRMessage::initCDRMsg(&batch.msg);
+    RTPSMessageCreator::addHeader(&batch.msg, participant_->getGuid().guidPrefix);
+    return batch;
+}
+
+void SubmessageBatcher::reset_nts(
+        Batch& batch)
+{
+    batch.msg.pos = RTPSMESSAGE_HEADER_SIZE;
+    batch.msg.length = RTPSMESSAGE_HEADER_SIZE;
+}
+
+void SubmessageBatcher::send_nts(
+        Batch& batch)
+{
+    std::chrono::steady_clock::time_point max_blocking_time_point =
+        std::chrono::steady_clock::now() + std::chrono::hours(24);
+
+    if (!participant_->sendSync(&batch.msg, batch.transport_priority, batch.locator, max_blocking_time_point))
+    {
+        logWarning(RTPS_PARTICIPANT, "Cannot send batched submessages to " << batch.locator);
+    }
+
+    reset_nts(batch);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,147 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SubmessageBatcher.h
+ *
+ */
+
+#ifndef SUBMESSAGE_BATCHER_H_
+#define SUBMESSAGE_BATCHER_H_
+
+#include <fastrtps/rtps/common/CDRMessage_t.h>
+#include <fastrtps/rtps/common/Locator.h>
+#include <fastrtps/rtps/resources/TimedEvent.h>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+
+/**
+ * Participant stage that merges the messages sent by different local endpoints to the same locator.
+ * The submessages queued during a window are sent as one RTPS message per destination locator and transport
+ * priority when the window expires, or earlier if they would not fit on one message.
+ *
+ * Each queued message is prefixed with an INFO_DST to the unknown prefix, unless it starts with its own
+ * INFO_DST. Receivers then address its submessages to any participant, as at the beginning of a message,
+ * instead of to the destination left by the previous one.
+ * @ingroup MANAGEMENT_MODULE
+ */
+class SubmessageBatcher
+{
+public:
+
+    /**
+     * @param participant Participant sending the batched messages.
+     * @param window_in_ms Time the first queued submessage may wait before being sent, in milliseconds.
+     */
+    SubmessageBatcher(
+            RTPSParticipantImpl* participant,
+            double window_in_ms);
+
+    /**
+     * The queued submessages are sent before destruction.
+     */
+    ~SubmessageBatcher();
+
+    /**
+     * Queues the submessages of a message.
+     * @param msg RTPS message, starting with its header. Its submessages are copied.
+     * @param transport_priority Transport priority of the endpoint sending the message.
+     * @param destination Locator where the message has to be sent.
+     * @return False when the message does not fit on a batch and has to be sent on its own.
+     */
+    bool add(
+            const CDRMessage_t* msg,
+            int32_t transport_priority,
+            const Locator_t& destination);
+
+    //! Sends all the queued submessages.
+    void flush();
+
+private:
+
+    class FlushEvent : public TimedEvent
+    {
+    public:
+
+        FlushEvent(
+                SubmessageBatcher* batcher,
+                RTPSParticipantImpl* participant,
+                double interval_in_ms);
+
+        virtual ~FlushEvent();
+
+        void event(
+                EventCode code,
+                const char* msg = nullptr) override;
+
+    private:
+
+        SubmessageBatcher* batcher_;
+    };
+
+    struct Batch
+    {
+        Batch(
+                const Locator_t& destination,
+                int32_t priority,
+                uint32_t size)
+            : locator(destination)
+            , transport_priority(priority)
+            , msg(size)
+        {
+        }
+
+        Locator_t locator;
+        int32_t transport_priority;
+        CDRMessage_t msg;
+    };
+
+    Batch& batch_nts(
+            const Locator_t& destination,
+            int32_t transport_priority);
+
+    void reset_nts(
+            Batch& batch);
+
+    void send_nts(
+            Batch& batch);
+
+    RTPSParticipantImpl* participant_;
+
+    uint32_t max_message_size_;
+
+    std::mutex mutex_;
+
+    //! One batch per destination locator and transport priority. Batches left empty are released on flush.
+    std::vector<std::unique_ptr<Batch>> batches_;
+
+    //! Some batch has submessages and the flush event is scheduled.
+    bool pending_;
+
+    FlushEvent* flush_event_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // SUBMESSAGE_BATCHER_H_
@@ -20,6 +20,7 @@
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/history/ReaderHistory.h>
 #include <fastrtps/log/Log.h>
+#include <fastrtps/utils/eClock.h>
 #include "FragmentedChangePitStop.h"
 
 #include <fastrtps/rtps/reader/ReaderListener.h>
@@ -162,6 +163,30 @@ void RTPSReader::set_last_notified(const GUID_t& peristence_guid, const Sequence
     history_record_[peristence_guid] = seq;
 }
 
+ReaderStatistics RTPSReader::get_statistics()
+{
+    ReaderStatistics statistics;
+    statistics_counters_.snapshot(statistics);
+
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+    statistics.history_size = mp_history->getHistorySize();
+    return statistics;
+}
+
+void RTPSReader::sample_received(const CacheChange_t* change)
+{
+    statistics_counters_.samples_received.fetch_add(1, std::memory_order_relaxed);
+
+    if (change->sourceTimestamp != c_TimeZero)
+    {
+        Time_t now;
+        eClock clock;
+        clock.setTimeNow(&now);
+        Time_t source_timestamp = change->sourceTimestamp;
+        statistics_counters_.reception_latency.record(std::chrono::nanoseconds(now.to_ns() - source_timestamp.to_ns()));
+    }
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
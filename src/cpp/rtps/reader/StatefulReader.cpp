@@ -218,6 +218,7 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
         if(!pWP->change_was_received(change->sequenceNumber))
         {
             logInfo(RTPS_MSG_IN,IDSTRING"Trying to add change " << change->sequenceNumber <<" TO reader: "<< getGuid().entityId);
+            statistics_counters_.bytes_received.fetch_add(change->serializedPayload.length, std::memory_order_relaxed);
 
             CacheChange_t* change_to_add;
 
@@ -231,6 +232,7 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
                                 change_to_add->serializedPayload, m_guid, change->writerGUID))
                     {
                         releaseCache(change_to_add);
+                        statistics_counters_.drop(DROP_SECURITY);
                         logWarning(RTPS_MSG_IN, "Cannont decode serialized payload");
                         return false;
                     }
@@ -243,6 +245,7 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
                         logWarning(RTPS_MSG_IN,IDSTRING"Problem copying CacheChange, received data is: " << change->serializedPayload.length
                                 << " bytes and max size in reader " << getGuid().entityId << " is " << change_to_add->serializedPayload.max_size);
                         releaseCache(change_to_add);
+                        statistics_counters_.drop(DROP_NO_RESOURCES);
                         return false;
                     }
 #if HAVE_SECURITY
@@ -252,6 +255,7 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
             else
             {
                 logError(RTPS_MSG_IN,IDSTRING"Problem reserving CacheChange in reader: " << getGuid().entityId);
+                statistics_counters_.drop(DROP_NO_RESOURCES);
                 return false;
             }
 
@@ -266,14 +270,27 @@ bool StatefulReader::processDataMsg(CacheChange_t *change)
             {
                 logInfo(RTPS_MSG_IN,IDSTRING"MessageReceiver not add change "<<change_to_add->sequenceNumber);
                 releaseCache(change_to_add);
+                statistics_counters_.drop(DROP_REJECTED_BY_HISTORY);
 
                 if(pWP == nullptr && getGuid().entityId == c_EntityId_SPDPReader)
                 {
                     mp_RTPSParticipant->assertRemoteRTPSParticipantLiveliness(change->writerGUID.guidPrefix);
                 }
             }
+            else
+            {
+                sample_received(change);
+            }
+        }
+        else
+        {
+            statistics_counters_.drop(DROP_DUPLICATE);
         }
     }
+    else
+    {
+        statistics_counters_.drop(DROP_UNKNOWN_WRITER);
+    }
 
     return true;
 }
@@ -292,6 +309,9 @@ bool StatefulReader::processDataFragMsg(CacheChange_t *incomingChange, uint32_t
         if(!pWP->change_was_received(incomingChange->sequenceNumber))
         {
             logInfo(RTPS_MSG_IN, IDSTRING"Trying to add fragment " << incomingChange->sequenceNumber.to64long() << " TO reader: " << getGuid().entityId);
+            statistics_counters_.fragments_received.fetch_add(1, std::memory_order_relaxed);
+            statistics_counters_.bytes_received.fetch_add(incomingChange->serializedPayload.length,
+                    std::memory_order_relaxed);
 
             CacheChange_t* change_to_add = incomingChange;
 
@@ -305,6 +325,7 @@ bool StatefulReader::processDataFragMsg(CacheChange_t *incomingChange, uint32_t
                                 change_to_add->serializedPayload, m_guid, incomingChange->writerGUID))
                     {
                         releaseCache(change_to_add);
+                        statistics_counters_.drop(DROP_SECURITY);
                         logWarning(RTPS_MSG_IN, "Cannont decode serialized payload");
                         return false;
                     }
@@ -341,9 +362,22 @@ bool StatefulReader::processDataFragMsg(CacheChange_t *incomingChange, uint32_t
                     }
 
                     releaseCache(change_completed);
+                    statistics_counters_.drop(DROP_REJECTED_BY_HISTORY);
+                }
+                else
+                {
+                    sample_received(incomingChange);
                 }
             }
         }
+        else
+        {
+            statistics_counters_.drop(DROP_DUPLICATE);
+        }
+    }
+    else
+    {
+        statistics_counters_.drop(DROP_UNKNOWN_WRITER);
     }
 
     return true;
@@ -358,6 +392,7 @@ bool StatefulReader::processHeartbeatMsg(GUID_t &writerGUID, uint32_t hbCount, S
 
     if(acceptMsgFrom(writerGUID, &pWP))
     {
+        statistics_counters_.heartbeats_received.fetch_add(1, std::memory_order_relaxed);
         std::unique_lock<std::recursive_mutex> wpLock(*pWP->getMutex());
 
         if(pWP->m_lastHeartbeatCount < hbCount)
@@ -406,6 +441,7 @@ bool StatefulReader::processGapMsg(GUID_t &writerGUID, SequenceNumber_t &gapStar
 
     if(acceptMsgFrom(writerGUID, &pWP))
     {
+        statistics_counters_.gaps_received.fetch_add(1, std::memory_order_relaxed);
         std::lock_guard<std::recursive_mutex> guardWriterProxy(*pWP->getMutex());
         SequenceNumber_t auxSN;
         SequenceNumber_t finalSN = gapList.base() - 1;
@@ -472,6 +508,18 @@ bool StatefulReader::change_received(CacheChange_t* a_change, WriterProxy* prox)
 
     std::unique_lock<std::recursive_mutex> writerProxyLock(*prox->getMutex());
 
+    // Expired changes are not added to the history, but they are marked as irrelevant so they are not
+    // requested again to the writer.
+    if(mp_history->is_change_expired(a_change))
+    {
+        logInfo(RTPS_READER, "Change " << a_change->sequenceNumber << " from " << a_change->writerGUID <<
+                " discarded because its lifespan expired");
+        prox->irrelevant_change_set(a_change->sequenceNumber);
+        writerProxyLock.unlock();
+        NotifyChanges(prox);
+        return false;
+    }
+
     size_t unknown_missing_changes_up_to = prox->unknown_missing_changes_up_to(a_change->sequenceNumber);
 
     if(this->mp_history->received_change(a_change, unknown_missing_changes_up_to))
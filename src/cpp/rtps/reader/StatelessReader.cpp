@@ -163,6 +163,7 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
     if(acceptMsgFrom(change->writerGUID))
     {
         logInfo(RTPS_MSG_IN,IDSTRING"Trying to add change " << change->sequenceNumber <<" TO reader: "<< getGuid().entityId);
+        statistics_counters_.bytes_received.fetch_add(change->serializedPayload.length, std::memory_order_relaxed);
 
         CacheChange_t* change_to_add;
 
@@ -176,6 +177,7 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
                         change_to_add->serializedPayload, m_guid, change->writerGUID))
                 {
                     releaseCache(change_to_add);
+                    statistics_counters_.drop(DROP_SECURITY);
                     logWarning(RTPS_MSG_IN, "Cannont decode serialized payload");
                     return false;
                 }
@@ -188,6 +190,7 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
                     logWarning(RTPS_MSG_IN,IDSTRING"Problem copying CacheChange, received data is: " << change->serializedPayload.length
                             << " bytes and max size in reader " << getGuid().entityId << " is " << change_to_add->serializedPayload.max_size);
                     releaseCache(change_to_add);
+                    statistics_counters_.drop(DROP_NO_RESOURCES);
                     return false;
                 }
 #if HAVE_SECURITY
@@ -197,6 +200,7 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
         else
         {
             logError(RTPS_MSG_IN,IDSTRING"Problem reserving CacheChange in reader: " << getGuid().entityId);
+            statistics_counters_.drop(DROP_NO_RESOURCES);
             return false;
         }
 
@@ -205,12 +209,21 @@ bool StatelessReader::processDataMsg(CacheChange_t *change)
             logInfo(RTPS_MSG_IN,IDSTRING"MessageReceiver not add change "
                     <<change_to_add->sequenceNumber);
             releaseCache(change_to_add);
+            statistics_counters_.drop(DROP_REJECTED_BY_HISTORY);
 
             if(getGuid().entityId == c_EntityId_SPDPReader)
             {
                 mp_RTPSParticipant->assertRemoteRTPSParticipantLiveliness(change->writerGUID.guidPrefix);
             }
         }
+        else
+        {
+            sample_received(change);
+        }
+    }
+    else
+    {
+        statistics_counters_.drop(DROP_UNKNOWN_WRITER);
     }
 
     return true;
@@ -228,6 +241,9 @@ bool StatelessReader::processDataFragMsg(CacheChange_t *incomingChange, uint32_t
         if(!thereIsUpperRecordOf(incomingChange->writerGUID, incomingChange->sequenceNumber))
         {
             logInfo(RTPS_MSG_IN, IDSTRING"Trying to add fragment " << incomingChange->sequenceNumber.to64long() << " TO reader: " << getGuid().entityId);
+            statistics_counters_.fragments_received.fetch_add(1, std::memory_order_relaxed);
+            statistics_counters_.bytes_received.fetch_add(incomingChange->serializedPayload.length,
+                    std::memory_order_relaxed);
 
             CacheChange_t* change_to_add = incomingChange;
 
@@ -241,6 +257,7 @@ bool StatelessReader::processDataFragMsg(CacheChange_t *incomingChange, uint32_t
                                 change_to_add->serializedPayload, m_guid, incomingChange->writerGUID))
                     {
                         releaseCache(change_to_add);
+                        statistics_counters_.drop(DROP_SECURITY);
                         logWarning(RTPS_MSG_IN, "Cannont decode serialized payload");
                         return false;
                     }
@@ -275,9 +292,22 @@ bool StatelessReader::processDataFragMsg(CacheChange_t *incomingChange, uint32_t
 
                     // Release CacheChange_t.
                     releaseCache(change_completed);
+                    statistics_counters_.drop(DROP_REJECTED_BY_HISTORY);
+                }
+                else
+                {
+                    sample_received(incomingChange);
                 }
             }
         }
+        else
+        {
+            statistics_counters_.drop(DROP_DUPLICATE);
+        }
+    }
+    else
+    {
+        statistics_counters_.drop(DROP_UNKNOWN_WRITER);
     }
 
     return true;
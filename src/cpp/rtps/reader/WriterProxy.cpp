@@ -31,63 +31,14 @@
 
 using namespace eprosima::fastrtps::rtps;
 
-/*!
- * @brief Auxiliary function to change status in a range.
- */
-void WriterProxy::for_each_set_status_from(decltype(WriterProxy::m_changesFromW)::iterator first,
-        decltype(WriterProxy::m_changesFromW)::iterator last,
-        ChangeFromWriterStatus_t status,
-        ChangeFromWriterStatus_t new_status)
-{
-    auto it = first;
-    while(it != last)
-    {
-        if(it->getStatus() == status)
-        {
-            ChangeFromWriter_t newch(*it);
-            newch.setStatus(new_status);
-
-            auto hint = m_changesFromW.erase(it);
-
-            it = m_changesFromW.insert(hint, newch);
-        }
-
-        ++it;
-    }
-}
+// Layout of each entry of the m_changesFromW container.
+static const uint8_t CHANGE_STATUS_MASK = 0x03;
+static const uint8_t CHANGE_NOT_RELEVANT = 0x04;
 
-void WriterProxy::for_each_set_status_from_and_maybe_remove(decltype(WriterProxy::m_changesFromW)::iterator first,
-        decltype(WriterProxy::m_changesFromW)::iterator last,
-        ChangeFromWriterStatus_t status,
-        ChangeFromWriterStatus_t orstatus,
-        ChangeFromWriterStatus_t new_status)
+static inline bool is_pending(uint8_t state)
 {
-    auto it = first;
-    while(it != last)
-    {
-        if(it->getStatus() == status || it->getStatus() == orstatus)
-        {
-            if(it != m_changesFromW.begin())
-            {
-                ChangeFromWriter_t newch(*it);
-                newch.setStatus(new_status);
-
-                auto hint = m_changesFromW.erase(it);
-
-                it = m_changesFromW.insert(hint, newch);
-                ++it;
-                continue;
-            }
-        }
-
-        // UNKNOWN or MISSING at the beginning or
-        // LOST or RECEIVED at the beginning.
-        if(it == m_changesFromW.begin())
-        {
-            changesFromWLowMark_ = it->getSequenceNumber();
-            it = m_changesFromW.erase(it);
-        }
-    }
+    uint8_t status = state & CHANGE_STATUS_MASK;
+    return status == ChangeFromWriterStatus_t::UNKNOWN || status == ChangeFromWriterStatus_t::MISSING;
 }
 
 static const int WRITERPROXY_LIVELINESS_PERIOD_MULTIPLIER = 1;
@@ -114,10 +65,9 @@ WriterProxy::WriterProxy(const RemoteWriterAttributes& watt,
     mp_initialAcknack(nullptr),
     m_heartbeatFinalFlag(false),
     m_isAlive(true),
-    mp_mutex(new std::recursive_mutex())
-
+    mp_mutex(new std::recursive_mutex()),
+    pendingChangesFromW_(0)
 {
-    m_changesFromW.clear();
     //Create Events
     mp_writerProxyLiveliness = new WriterProxyLiveliness(this,TimeConv::Time_t2MilliSecondsDouble(m_att.livelinessLeaseDuration)*WRITERPROXY_LIVELINESS_PERIOD_MULTIPLIER);
     mp_heartbeatResponse = new HeartbeatResponseDelay(this,TimeConv::Time_t2MilliSecondsDouble(mp_SFR->getTimes().heartbeatResponseDelay));
@@ -141,30 +91,16 @@ void WriterProxy::missing_changes_update(const SequenceNumber_t& seqNum)
     // Check was not removed from container.
     if(seqNum > changesFromWLowMark_)
     {
-        if(m_changesFromW.size() == 0 || m_changesFromW.rbegin()->getSequenceNumber() < seqNum)
+        if(maybe_add_changes_from_writer_up_to(seqNum))
         {
-            // Set already values in container.
-            for_each_set_status_from(m_changesFromW.begin(), m_changesFromW.end(),
-                    ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
-
-            // Changes only already inserted values.
-            bool will_be_the_last = maybe_add_changes_from_writer_up_to(seqNum, ChangeFromWriterStatus_t::MISSING);
-            (void)will_be_the_last;
-            assert(will_be_the_last);
-
-            // Add requetes sequence number.
-            ChangeFromWriter_t newch(seqNum);
-            newch.setStatus(ChangeFromWriterStatus_t::MISSING);
-            m_changesFromW.insert(m_changesFromW.end(), newch);
-        }
-        else
-        {
-            // Find it. Must be there.
-            auto last_it = m_changesFromW.find(ChangeFromWriter_t(seqNum));
-            assert(last_it != m_changesFromW.end());
-            for_each_set_status_from(m_changesFromW.begin(), ++last_it,
-                    ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING);
+            // Add requested sequence number.
+            m_changesFromW.push_back(ChangeFromWriterStatus_t::UNKNOWN);
+            ++pendingChangesFromW_;
         }
+
+        // UNKNOWN changes up to seqNum are marked MISSING without visiting them.
+        if(missingHighMark_ < seqNum)
+            missingHighMark_ = seqNum;
     }
 
     //print_changes_fromWriter_test2();
@@ -175,23 +111,18 @@ bool WriterProxy::maybe_add_changes_from_writer_up_to(const SequenceNumber_t& se
 {
     bool returnedValue = false;
     // Check if CacheChange_t is in the container or not.
-    SequenceNumber_t lastSeqNum = changesFromWLowMark_;
-
-    if(m_changesFromW.size() > 0)
-        lastSeqNum = m_changesFromW.rbegin()->getSequenceNumber();
+    SequenceNumber_t lastSeqNum = last_change_from_writer();
 
     if(sequence_number > lastSeqNum)
     {
         returnedValue = true;
 
         // If it is not in the container, create info up to its sequence number.
-        ++lastSeqNum;
-        for(; lastSeqNum < sequence_number; ++lastSeqNum)
-        {
-            ChangeFromWriter_t newch(lastSeqNum);
-            newch.setStatus(default_status);
-            m_changesFromW.insert(m_changesFromW.end(), newch);
-        }
+        size_t count = static_cast<size_t>((sequence_number - lastSeqNum).to64long() - 1);
+        m_changesFromW.insert(m_changesFromW.end(), count, static_cast<uint8_t>(default_status));
+
+        if(is_pending(static_cast<uint8_t>(default_status)))
+            pendingChangesFromW_ += count;
     }
 
     return returnedValue;
@@ -205,24 +136,27 @@ void WriterProxy::lost_changes_update(const SequenceNumber_t& seqNum)
     // Check was not removed from container.
     if(seqNum > changesFromWLowMark_)
     {
-        if(m_changesFromW.size() == 0 || m_changesFromW.rbegin()->getSequenceNumber() < seqNum)
+        if(last_change_from_writer() < seqNum)
         {
             // Remove all because lost or received.
             m_changesFromW.clear();
-            // Any in container, then not insert new lost.
-            changesFromWLowMark_ = seqNum - 1;
+            pendingChangesFromW_ = 0;
         }
         else
         {
-            // Find it. Must be there.
-            auto last_it = m_changesFromW.find(ChangeFromWriter_t(seqNum));
-            assert(last_it != m_changesFromW.end());
-            for_each_set_status_from_and_maybe_remove(m_changesFromW.begin(), last_it,
-                    ChangeFromWriterStatus_t::UNKNOWN, ChangeFromWriterStatus_t::MISSING,
-                    ChangeFromWriterStatus_t::LOST);
-            // Next could need to be removed.
-            cleanup();
+            // Changes before seqNum are now lost or received, so all of them are removed.
+            auto last_it = m_changesFromW.begin() + change_index(seqNum);
+            for(auto it = m_changesFromW.begin(); it != last_it; ++it)
+            {
+                if(is_pending(*it))
+                    --pendingChangesFromW_;
+            }
+            m_changesFromW.erase(m_changesFromW.begin(), last_it);
         }
+
+        changesFromWLowMark_ = seqNum - 1;
+        // Next could need to be removed.
+        cleanup();
     }
 
     //print_changes_fromWriter_test2();
@@ -250,6 +184,10 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
         return false;
     }
 
+    uint8_t new_state = ChangeFromWriterStatus_t::RECEIVED;
+    if(!is_relevance)
+        new_state |= CHANGE_NOT_RELEVANT;
+
     // Maybe create information because it is not in the m_changesFromW container.
     bool will_be_the_last = maybe_add_changes_from_writer_up_to(seqNum);
 
@@ -258,12 +196,7 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
     {
         // There are others.
         if(m_changesFromW.size() > 0)
-        {
-            ChangeFromWriter_t chfw(seqNum);
-            chfw.setStatus(RECEIVED);
-            chfw.setRelevance(is_relevance);
-            m_changesFromW.insert(m_changesFromW.end(), chfw);
-        }
+            m_changesFromW.push_back(new_state);
         // Else not insert
         else
             changesFromWLowMark_ = seqNum;
@@ -271,34 +204,20 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
     // Else it has to be found and change state.
     else
     {
-        auto chit = m_changesFromW.find(ChangeFromWriter_t(seqNum));
+        size_t index = change_index(seqNum);
+        uint8_t& state = m_changesFromW[index];
 
-        // Has to be in the container.
-        assert(chit != m_changesFromW.end());
+        if((state & CHANGE_STATUS_MASK) == ChangeFromWriterStatus_t::RECEIVED)
+            return false;
 
-        if(chit != m_changesFromW.begin())
-        {
-            if(chit->getStatus() != RECEIVED)
-            {
-                ChangeFromWriter_t newch(*chit);
-                newch.setStatus(RECEIVED);
-                newch.setRelevance(is_relevance);
+        if(is_pending(state))
+            --pendingChangesFromW_;
 
-                auto hint = m_changesFromW.erase(chit);
+        state = new_state;
 
-                m_changesFromW.insert(hint, newch);
-            }
-            else
-                return false;
-        }
-        else
-        {
-            assert(chit->getStatus() != RECEIVED);
-            changesFromWLowMark_ = seqNum;
-            m_changesFromW.erase(chit);
+        // The first one is always removed.
+        if(index == 0)
             cleanup();
-        }
-
     }
 
     //print_changes_fromWriter_test2();
@@ -310,18 +229,14 @@ bool WriterProxy::received_change_set(const SequenceNumber_t& seqNum, bool is_re
 const std::vector<ChangeFromWriter_t> WriterProxy::missing_changes()
 {
     std::vector<ChangeFromWriter_t> returnedValue;
-    std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
-
-    for(auto ch : m_changesFromW)
-    {
-        if(ch.getStatus() == MISSING)
-        {
-            // If MISSING, then is relevant.
-            assert(ch.isRelevant());
-            returnedValue.push_back(ch);
-        }
-    }
 
+    for_each_missing_change([&](const SequenceNumber_t& seq_num)
+            {
+                ChangeFromWriter_t ch(seq_num);
+                ch.setStatus(ChangeFromWriterStatus_t::MISSING);
+                returnedValue.push_back(ch);
+                return true;
+            });
 
     //print_changes_fromWriter_test2();
 
@@ -335,12 +250,10 @@ bool WriterProxy::change_was_received(const SequenceNumber_t& seq_num)
     if(seq_num <= changesFromWLowMark_)
         return true;
 
-    auto chit = m_changesFromW.find(ChangeFromWriter_t(seq_num));
-
-    if(chit != m_changesFromW.end() && chit->getStatus() == RECEIVED)
-        return true;
+    if(seq_num > last_change_from_writer())
+        return false;
 
-    return false;
+    return (m_changesFromW[change_index(seq_num)] & CHANGE_STATUS_MASK) == ChangeFromWriterStatus_t::RECEIVED;
 }
 
 const SequenceNumber_t WriterProxy::available_changes_max() const
@@ -349,14 +262,36 @@ const SequenceNumber_t WriterProxy::available_changes_max() const
     return changesFromWLowMark_;
 }
 
+ChangeFromWriterStatus_t WriterProxy::change_status(const SequenceNumber_t& seq_num, uint8_t state) const
+{
+    ChangeFromWriterStatus_t status = static_cast<ChangeFromWriterStatus_t>(state & CHANGE_STATUS_MASK);
+
+    if(status == ChangeFromWriterStatus_t::UNKNOWN && seq_num <= missingHighMark_)
+        status = ChangeFromWriterStatus_t::MISSING;
+
+    return status;
+}
+
+ChangeFromWriter_t WriterProxy::change_from_writer(const SequenceNumber_t& seq_num) const
+{
+    assert(seq_num > changesFromWLowMark_ && seq_num <= last_change_from_writer());
+
+    uint8_t state = m_changesFromW[change_index(seq_num)];
+    ChangeFromWriter_t ch(seq_num);
+    ch.setStatus(change_status(seq_num, state));
+    ch.setRelevance((state & CHANGE_NOT_RELEVANT) == 0);
+    return ch;
+}
+
 void WriterProxy::print_changes_fromWriter_test2()
 {
     std::stringstream sstream;
     sstream << this->m_att.guid.entityId<<": ";
 
-    for(auto it = m_changesFromW.begin(); it != m_changesFromW.end(); ++it)
+    for(SequenceNumber_t seq = changesFromWLowMark_ + 1; seq <= last_change_from_writer(); ++seq)
     {
-        sstream << it->getSequenceNumber() <<"("<<it->isRelevant()<<","<<it->getStatus()<<")-";
+        ChangeFromWriter_t ch = change_from_writer(seq);
+        sstream << seq <<"("<<ch.isRelevant()<<","<<ch.getStatus()<<")-";
     }
 
     std::string auxstr = sstream.str();
@@ -384,70 +319,69 @@ void WriterProxy::setNotValid(const SequenceNumber_t& seqNum)
     if(seqNum <= changesFromWLowMark_)
         return;
 
-    auto chit = m_changesFromW.find(ChangeFromWriter_t(seqNum));
-
     // Element must be in the container. In other case, bug.
-    assert(chit != m_changesFromW.end());
+    assert(seqNum <= last_change_from_writer());
+
+    size_t index = change_index(seqNum);
     // If the element will be set not valid, element must be received.
     // In other case, bug.
-    assert(chit->getStatus() == RECEIVED);
+    assert((m_changesFromW[index] & CHANGE_STATUS_MASK) == ChangeFromWriterStatus_t::RECEIVED);
 
     // Cannot be in the beginning because process of cleanup
-    assert(chit != m_changesFromW.begin());
-
-    ChangeFromWriter_t newch(*chit);
-    newch.notValid();
-
-    auto hint = m_changesFromW.erase(chit);
+    assert(index != 0);
 
-    m_changesFromW.insert(hint, newch);
+    m_changesFromW[index] |= CHANGE_NOT_RELEVANT;
 }
 
 void WriterProxy::cleanup()
 {
-    auto chit = m_changesFromW.begin();
-
-    while(chit != m_changesFromW.end() &&
-            (chit->getStatus() == RECEIVED || chit->getStatus() == LOST))
+    while(!m_changesFromW.empty() && !is_pending(m_changesFromW.front()))
     {
-        changesFromWLowMark_ = chit->getSequenceNumber();
-        chit = m_changesFromW.erase(chit);
+        ++changesFromWLowMark_;
+        m_changesFromW.pop_front();
     }
 }
 
 bool WriterProxy::areThereMissing()
 {
-    bool returnedValue = false;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    for(auto ch : m_changesFromW)
-    {
-        if(ch.getStatus() == ChangeFromWriterStatus_t::MISSING)
-        {
-            returnedValue = true;
-            break;
-        }
-    }
+    if(pendingChangesFromW_ == 0)
+        return false;
+
+    // After cleanup the first change is always pending, so this is the usual case.
+    if(changesFromWLowMark_ + 1 <= missingHighMark_)
+        return true;
+
+    bool returnedValue = false;
+    for_each_missing_change([&](const SequenceNumber_t&)
+            {
+                returnedValue = true;
+                return false;
+            });
 
     return returnedValue;
 }
 
 size_t WriterProxy::unknown_missing_changes_up_to(const SequenceNumber_t& seqNum)
 {
-    size_t returnedValue = 0;
     std::lock_guard<std::recursive_mutex> guard(*mp_mutex);
 
-    if(seqNum > changesFromWLowMark_)
+    if(seqNum <= changesFromWLowMark_ || pendingChangesFromW_ == 0)
+        return 0;
+
+    if(seqNum > last_change_from_writer())
+        return pendingChangesFromW_;
+
+    // Changes are usually received in order, so counting from the end visits less of them.
+    size_t pending_from_seq = 0;
+    for(auto it = m_changesFromW.begin() + change_index(seqNum); it != m_changesFromW.end(); ++it)
     {
-        for(auto ch = m_changesFromW.begin(); ch != m_changesFromW.end() && ch->getSequenceNumber() < seqNum; ++ch)
-        {
-            if(ch->getStatus() == ChangeFromWriterStatus_t::UNKNOWN ||
-                    ch->getStatus() == ChangeFromWriterStatus_t::MISSING)
-                ++returnedValue;
-        }
+        if(is_pending(*it))
+            ++pending_from_seq;
     }
 
-    return returnedValue;
+    return pendingChangesFromW_ - pending_from_seq;
 }
 
 size_t WriterProxy::numberOfChangeFromWriter() const
@@ -73,38 +73,47 @@ void HeartbeatResponseDelay::event(
         // Protect reader
         std::lock_guard<std::recursive_timed_mutex> guard(mp_WP->mp_SFR->getMutex());
 
-        const std::vector<ChangeFromWriter_t> missing_changes = mp_WP->missing_changes();
         // Stores missing changes but there is some fragments received.
         std::vector<CacheChange_t*> uncompleted_changes;
+        bool missing_changes = false;
+        SequenceNumberSet_t sns(mp_WP->available_changes_max() + 1);
 
-        try
-        {
-            RTPSMessageGroup group(mp_WP->mp_SFR->getRTPSParticipant(), mp_WP->mp_SFR, RTPSMessageGroup::READER,
-                    m_cdrmessages, m_destination_locators, m_remote_endpoints);
+        // The ACKNACK bitmap is filled straight from the state kept by the WriterProxy.
+        // The changes past the bitmap limit are requested by the next ACKNACKs, so they are not visited.
+        const SequenceNumber_t bitmap_end = sns.base() + 256;
+        mp_WP->for_each_missing_change([&](const SequenceNumber_t& seq_num)
+                {
+                    if(seq_num >= bitmap_end)
+                    {
+                        logInfo(RTPS_READER,"Sequence number " << seq_num
+                                << " exceeded bitmap limit of AckNack. SeqNumSet Base: " << sns.base());
+                        return false;
+                    }
 
-            if(!missing_changes.empty() || !mp_WP->m_heartbeatFinalFlag)
-            {
-                SequenceNumberSet_t sns(mp_WP->available_changes_max() + 1);
+                    missing_changes = true;
 
-                for(auto ch : missing_changes)
-                {
                     // Check if the CacheChange_t is uncompleted.
-                    CacheChange_t* uncomplete_change = mp_WP->mp_SFR->findCacheInFragmentedCachePitStop(ch.getSequenceNumber(), mp_WP->m_att.guid);
+                    CacheChange_t* uncomplete_change = mp_WP->mp_SFR->findCacheInFragmentedCachePitStop(seq_num, mp_WP->m_att.guid);
 
                     if(uncomplete_change == nullptr)
                     {
-                        if(!sns.add(ch.getSequenceNumber()))
-                        {
-                            logInfo(RTPS_READER,"Sequence number " << ch.getSequenceNumber()
-                                    << " exceeded bitmap limit of AckNack. SeqNumSet Base: " << sns.base());
-                        }
+                        sns.add(seq_num);
                     }
                     else
                     {
                         uncompleted_changes.push_back(uncomplete_change);
                     }
-                }
 
+                    return true;
+                });
+
+        try
+        {
+            RTPSMessageGroup group(mp_WP->mp_SFR->getRTPSParticipant(), mp_WP->mp_SFR, RTPSMessageGroup::READER,
+                    m_cdrmessages, m_destination_locators, m_remote_endpoints);
+
+            if(missing_changes || !mp_WP->m_heartbeatFinalFlag)
+            {
                 // TODO Protect
                 mp_WP->mp_SFR->m_acknackCount++;
                 logInfo(RTPS_READER,"Sending ACKNACK: "<< sns;);
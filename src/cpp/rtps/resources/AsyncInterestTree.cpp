@@ -57,3 +57,9 @@ std::set<const RTPSWriter*> AsyncInterestTree::GetInterestedWriters() const
    std::unique_lock<std::mutex> activeGuard(mMutexActive);
    return *mActiveInterest;
 }
+
+bool AsyncInterestTree::HasPendingInterest() const
+{
+   std::unique_lock<std::mutex> hiddenGuard(mMutexHidden);
+   return !mHiddenInterest->empty();
+}
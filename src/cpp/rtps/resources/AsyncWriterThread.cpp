@@ -37,7 +37,11 @@ bool AsyncWriterThread::addWriter(RTPSWriter& writer)
     bool returnedValue = false;
 
     data_structure_mutex_.lock();
-    async_writers.push_back(&writer);
+    // Writers are kept sorted by descending transport priority, so they are serviced in that order.
+    int32_t priority = writer.getAttributes().transport_priority;
+    auto position = std::find_if(async_writers.begin(), async_writers.end(),
+            [priority](const RTPSWriter* w){ return w->getAttributes().transport_priority < priority; });
+    async_writers.insert(position, &writer);
     returnedValue = true;
 
     std::unique_lock<std::mutex> cond_guard(condition_variable_mutex_);
@@ -120,9 +124,34 @@ void AsyncWriterThread::run()
           auto interestedWriters = interestTree.GetInterestedWriters();
 
           std::unique_lock<std::mutex> data_guard(data_structure_mutex_);
-          for(auto writer : async_writers)
-             if (interestedWriters.count(writer))
-               writer->send_any_unsent_changes();
+          auto it = async_writers.begin();
+          while(it != async_writers.end())
+          {
+             RTPSWriter* writer = *it;
+             ++it;
+
+             if (interestedWriters.erase(writer) == 0)
+                continue;
+
+             writer->send_any_unsent_changes();
+
+             // Strict priority: interest registered while sending is taken now. If it belongs to a writer with
+             // higher priority than the remaining ones, the list is serviced again from the beginning.
+             if (it != async_writers.end() && interestTree.HasPendingInterest())
+             {
+                interestTree.Swap();
+                int32_t next_priority = (*it)->getAttributes().transport_priority;
+                bool restart = false;
+                for (auto pending : interestTree.GetInterestedWriters())
+                {
+                   interestedWriters.insert(pending);
+                   restart |= pending->getAttributes().transport_priority > next_priority;
+                }
+
+                if (restart)
+                   it = async_writers.begin();
+             }
+          }
 
           cond_guard.lock();
        }
@@ -22,13 +22,29 @@
 #include <asio.hpp>
 #include <thread>
 #include <functional>
+#include <mutex>
+#include <vector>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <fastrtps/utils/Semaphore.h>
 #include <fastrtps/log/Log.h>
 
 namespace eprosima {
 namespace fastrtps{
 namespace rtps {
 
+namespace {
+
+//!Event resource shared by several participants.
+struct SharedResourceEvent
+{
+    ResourceEvent* event;
+    uint32_t users;
+};
+
+std::mutex g_shared_events_mutex;
+std::vector<SharedResourceEvent> g_shared_events;
+
+}
 
 ResourceEvent::ResourceEvent():
     mp_b_thread(nullptr),
@@ -63,6 +79,75 @@ void ResourceEvent::init_thread(RTPSParticipantImpl* pimpl)
     mp_RTPSParticipantImpl->ResourceSemaphoreWait();
 }
 
+void ResourceEvent::init_shared_thread()
+{
+    Semaphore started(0);
+    mp_b_thread = new std::thread(&ResourceEvent::run_io_service,this);
+    mp_io_service->post([&started]()
+            {
+                logInfo(RTPS_PARTICIPANT,"Shared thread: " << std::this_thread::get_id() << " created and waiting for tasks.");
+                started.post();
+            });
+    started.wait();
+}
+
+ResourceEvent* ResourceEvent::acquire_shared(uint32_t pool_size)
+{
+    std::lock_guard<std::mutex> guard(g_shared_events_mutex);
+
+    // Threads are created as participants need them. A pooled resource with no users is always stopped, so a new
+    // one is less used than any running resource.
+    if(g_shared_events.size() < pool_size)
+    {
+        ResourceEvent* event = new ResourceEvent();
+        event->init_shared_thread();
+        g_shared_events.push_back({event, 1});
+        return event;
+    }
+
+    auto selected = g_shared_events.begin();
+    for(auto it = selected; it != g_shared_events.end(); ++it)
+    {
+        if(it->users < selected->users)
+        {
+            selected = it;
+        }
+    }
+
+    ++selected->users;
+    return selected->event;
+}
+
+void ResourceEvent::release_shared(ResourceEvent* event)
+{
+    ResourceEvent* unused = nullptr;
+
+    {
+        std::lock_guard<std::mutex> guard(g_shared_events_mutex);
+        for(auto it = g_shared_events.begin(); it != g_shared_events.end(); ++it)
+        {
+            if(it->event == event)
+            {
+                if(--it->users == 0)
+                {
+                    unused = it->event;
+                    g_shared_events.erase(it);
+                }
+                break;
+            }
+        }
+    }
+
+    // Its thread is stopped and joined outside the lock, so other participants can keep getting their resources.
+    delete unused;
+}
+
+size_t ResourceEvent::shared_threads_count()
+{
+    std::lock_guard<std::mutex> guard(g_shared_events_mutex);
+    return g_shared_events.size();
+}
+
 void ResourceEvent::announce_thread()
 {
     logInfo(RTPS_PARTICIPANT,"Thread: " << std::this_thread::get_id() << " created and waiting for tasks.");
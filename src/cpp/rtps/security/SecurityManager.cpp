@@ -615,22 +615,26 @@ bool SecurityManager::on_process_handshake(const ParticipantProxyData& participa
 
     if(remote_participant_info->auth_status_ == AUTHENTICATION_REQUEST_NOT_SEND)
     {
+        CDRMessage_t local_participant_data(0);
+        participant_->pdpsimple()->get_participant_proxy_data_serialized(BIGEND, local_participant_data);
         ret = authentication_plugin_->begin_handshake_request(&remote_participant_info->handshake_handle_,
                 &handshake_message,
                 *local_identity_handle_,
                 *remote_participant_info->identity_handle_,
-                participant_->pdpsimple()->get_participant_proxy_data_serialized(BIGEND),
+                local_participant_data,
                 exception);
     }
     else if(remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REQUEST)
     {
         assert(!remote_participant_info->handshake_handle_);
+        CDRMessage_t local_participant_data(0);
+        participant_->pdpsimple()->get_participant_proxy_data_serialized(BIGEND, local_participant_data);
         ret = authentication_plugin_->begin_handshake_reply(&remote_participant_info->handshake_handle_,
                 &handshake_message,
                 std::move(message_in),
                 *remote_participant_info->identity_handle_,
                 *local_identity_handle_,
-                participant_->pdpsimple()->get_participant_proxy_data_serialized(BIGEND),
+                local_participant_data,
                 exception);
     }
     else if(remote_participant_info->auth_status_ == AUTHENTICATION_WAITING_REPLY ||
@@ -20,7 +20,10 @@
 #include <fastrtps/rtps/writer/RTPSWriter.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/rtps/messages/RTPSMessageCreator.h>
+#include <fastrtps/rtps/writer/timedevent/LatencyBudgetFlush.h>
+#include <fastrtps/rtps/writer/IReaderDataFilter.h>
 #include <fastrtps/log/Log.h>
+#include <fastrtps/utils/TimeConversion.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
 
@@ -51,13 +54,24 @@ RTPSWriter::RTPSWriter(
     , mp_listener(listen)
     , is_async_(att.mode == SYNCHRONOUS_WRITER ? false : true)
     , m_separateSendingEnabled(false)
+    , send_key_hash_(att.send_key_hash && att.endpoint.topicKind == WITH_KEY)
     , all_remote_readers_(att.matched_readers_allocation)
+    , latency_budget_flush_(nullptr)
+    , batched_bytes_(0)
+    , reader_data_filter_(nullptr)
 #if HAVE_SECURITY
     , encrypt_payload_(mp_history->getTypeMaxSerialized())
 #endif
 {
     mp_history->mp_writer = this;
     mp_history->mp_mutex = &mp_mutex;
+
+    // Synchronous writers with a latency budget batch their changes instead of sending them one by one.
+    if (!is_async_ && att.latency_budget != c_TimeZero)
+    {
+        latency_budget_flush_ = new LatencyBudgetFlush(this, TimeConv::Time_t2MilliSecondsDouble(att.latency_budget));
+    }
+
     logInfo(RTPS_WRITER, "RTPSWriter created");
 }
 
@@ -93,6 +107,85 @@ CacheChange_t* RTPSWriter::new_change(const std::function<uint32_t()>& dataCdrSe
     return ch;
 }
 
+void RTPSWriter::flush_batch()
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+    flush_batch_nts();
+}
+
+void RTPSWriter::flush_batch_nts()
+{
+    latency_budget_flush_->cancel_timer();
+    batched_bytes_ = 0;
+    size_t unsent_before = unsent_changes_count_nts();
+    uint64_t fragments_before = statistics_counters_.fragments_sent.load(std::memory_order_relaxed);
+    send_any_unsent_changes();
+
+    // Flow controllers may leave part of the batch unsent, and nothing else would send it. It is retried after
+    // another latency budget, unless nothing could be sent, which will not improve by retrying.
+    size_t unsent_after = unsent_changes_count_nts();
+    if (unsent_after > 0)
+    {
+        if (unsent_after < unsent_before ||
+                statistics_counters_.fragments_sent.load(std::memory_order_relaxed) != fragments_before)
+        {
+            latency_budget_flush_->restart_timer();
+        }
+        else
+        {
+            logWarning(RTPS_WRITER, "Cannot send the batch of " << m_guid << ", it is kept until the next flush");
+        }
+    }
+}
+
+bool RTPSWriter::send_data_or_fragments(
+        RTPSMessageGroup& group,
+        const CacheChange_t& change,
+        const std::vector<GUID_t>& remote_readers,
+        const LocatorList_t& locators,
+        bool expectsInlineQos,
+        const std::function<void(FragmentNumber_t)>& fragment_sent)
+{
+    uint32_t n_fragments = change.getFragmentCount();
+    if (n_fragments == 0)
+    {
+        return group.add_data(change, remote_readers, locators, expectsInlineQos);
+    }
+
+    for (FragmentNumber_t frag_num = 1; frag_num <= n_fragments; ++frag_num)
+    {
+        if (!group.add_data_frag(change, frag_num, remote_readers, locators, expectsInlineQos))
+        {
+            logError(RTPS_WRITER, "Error sending fragment (" << change.sequenceNumber << ", " << frag_num << ")");
+            return false;
+        }
+
+        if (fragment_sent)
+        {
+            fragment_sent(frag_num);
+        }
+    }
+
+    return true;
+}
+
+void RTPSWriter::add_to_batch_nts(const CacheChange_t* change)
+{
+    // INFO_TS and DATA submessage headers sent along with each change.
+    const uint32_t change_overhead = 12 + 24;
+    const uint32_t max_batch_size = m_cdrmessages.rtpsmsg_fullmsg_.max_size - RTPSMESSAGE_HEADER_SIZE;
+    uint32_t change_size = change->serializedPayload.length + change_overhead;
+
+    if (batched_bytes_ > 0 && batched_bytes_ + change_size > max_batch_size)
+    {
+        flush_batch_nts();
+    }
+
+    batched_bytes_ += change_size;
+    // Timer is not restarted if it is already waiting, so the budget counts from the first batched change.
+    latency_budget_flush_->restart_timer();
+}
+
 SequenceNumber_t RTPSWriter::get_seq_num_min()
 {
     CacheChange_t* change;
@@ -176,6 +269,21 @@ void RTPSWriter::update_cached_info_nts(std::vector<LocatorList_t>& allLocatorLi
     mAllShrinkedLocatorList.push_back(mp_RTPSParticipant->network_factory().ShrinkLocatorLists(allLocatorLists));
 }
 
+bool RTPSWriter::is_relevant(const CacheChange_t& change, const GUID_t& reader_guid) const
+{
+    return reader_data_filter_ == nullptr || reader_data_filter_->is_relevant(change, reader_guid);
+}
+
+WriterStatistics RTPSWriter::get_statistics()
+{
+    WriterStatistics statistics;
+    statistics_counters_.snapshot(statistics);
+
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+    statistics.history_size = mp_history->getHistorySize();
+    return statistics;
+}
+
 #if HAVE_SECURITY
 bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
 {
@@ -186,7 +294,8 @@ bool RTPSWriter::encrypt_cachechange(CacheChange_t* change)
             +20 /*SecureDataHeader*/ + 4 + ((2 * 16) /*EVP_MAX_IV_LENGTH max block size*/ - 1) /* SecureDataBodey*/
             + 16 + 4 /*SecureDataTag*/ &&
             (mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE ||
-                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE))
+                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_RESERVE_MEMORY_MODE ||
+                mp_history->m_att.memoryPolicy == MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE))
         {
             encrypt_payload_.data = (octet*)realloc(encrypt_payload_.data, change->serializedPayload.length +
                     // In future v2 changepool is in writer, and writer set this value to cachechagepool.
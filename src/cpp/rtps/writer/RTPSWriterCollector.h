@@ -24,12 +24,23 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 
 #include <vector>
+#include <algorithm>
 #include <cassert>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+/*!
+ * Collects the changes (or fragments) that have to be sent, ordered by sequence number and fragment number,
+ * together with the set of remote readers each of them has to be sent to.
+ *
+ * Items are kept in a flat vector and the sets of readers are interned, so all the items sent to the same
+ * readers share the same group index. Both the items and the groups keep their storage between uses, so a
+ * collector that is reused does not allocate memory once the same sets of readers have been seen.
+ * Groups are identified by the value of the readers, so they should be cleared with clear_groups() whenever
+ * a reader may be destroyed or reused.
+ */
 template<class T>
 class RTPSWriterCollector
 {
@@ -40,7 +51,8 @@ class RTPSWriterCollector
             Item(SequenceNumber_t seqNum, FragmentNumber_t fragNum,
                     CacheChange_t* c) : sequenceNumber(seqNum),
                                         fragmentNumber(fragNum),
-                                        cacheChange(c)
+                                        cacheChange(c),
+                                        readersGroup(0)
 
             {
                 assert(seqNum == c->sequenceNumber);
@@ -55,7 +67,8 @@ class RTPSWriterCollector
 
             CacheChange_t* cacheChange;
 
-            mutable std::vector<T> remoteReaders;
+            //! Index of the set of remote readers of this item. See remote_readers().
+            uint32_t readersGroup;
         };
 
         struct ItemCmp
@@ -72,7 +85,13 @@ class RTPSWriterCollector
             }
         };
 
-        typedef std::set<Item, ItemCmp> ItemSet;
+        typedef std::vector<Item> ItemList;
+
+        RTPSWriterCollector() : mNext_(0)
+        {
+            // Group 0 is always the empty set of readers.
+            mGroups_.emplace_back();
+        }
 
         void add_change(CacheChange_t* change, const T& remoteReader, const FragmentNumberSet_t optionalFragmentsNotSent)
         {
@@ -81,14 +100,12 @@ class RTPSWriterCollector
                 optionalFragmentsNotSent.for_each([this, change, remoteReader](FragmentNumber_t sn)
                 {
                     assert(sn <= change->getDataFragments()->size());
-                    auto it = mItems_.emplace(change->sequenceNumber, sn, change);
-                    it.first->remoteReaders.push_back(remoteReader);
+                    add_item(Item(change->sequenceNumber, sn, change), remoteReader);
                 });
             }
             else
             {
-                auto it = mItems_.emplace(change->sequenceNumber, 0, change);
-                it.first->remoteReaders.push_back(remoteReader);
+                add_item(Item(change->sequenceNumber, 0, change), remoteReader);
             }
         }
 
@@ -99,30 +116,123 @@ class RTPSWriterCollector
 
         size_t size()
         {
-            return mItems_.size();
+            return mItems_.size() - mNext_;
         }
 
         Item pop()
         {
-            auto it = mItems_.begin();
-            Item ret = *it;
-            mItems_.erase(it);
+            Item ret = mItems_[mNext_++];
+            if(mNext_ == mItems_.size())
+            {
+                clear();
+            }
             return ret;
         }
 
         void clear()
         {
-            return mItems_.clear();
+            mItems_.clear();
+            mNext_ = 0;
         }
 
-        ItemSet& items()
+        /*!
+         * Items pending to be sent. It should only be modified before starting to pop items.
+         */
+        ItemList& items()
         {
             return mItems_;
         }
 
+        /*!
+         * Get the remote readers an item has to be sent to.
+         * @param item Item returned by pop().
+         * @return Set of remote readers.
+         */
+        const std::vector<T>& remote_readers(const Item& item) const
+        {
+            return group_readers(item.readersGroup);
+        }
+
+        /*!
+         * Get the remote readers of a set of readers.
+         * @param group Index of the set of readers.
+         * @return Set of remote readers.
+         */
+        const std::vector<T>& group_readers(uint32_t group) const
+        {
+            return mGroups_[group];
+        }
+
+        //! Number of different sets of readers known by this collector.
+        size_t groups_size() const
+        {
+            return mGroups_.size();
+        }
+
+        /*!
+         * Forget the known sets of readers. Pending items are discarded.
+         */
+        void clear_groups()
+        {
+            clear();
+            mGroups_.resize(1);
+            mTransitions_.clear();
+        }
+
     private:
 
-        ItemSet mItems_;
+        struct GroupTransition
+        {
+            uint32_t from;
+            T reader;
+            uint32_t to;
+        };
+
+        void add_item(const Item& item, const T& remoteReader)
+        {
+            auto it = std::lower_bound(mItems_.begin() + mNext_, mItems_.end(), item, ItemCmp());
+            if(it == mItems_.end() || ItemCmp()(item, *it))
+            {
+                it = mItems_.insert(it, item);
+            }
+            it->readersGroup = group_with_reader(it->readersGroup, remoteReader);
+        }
+
+        uint32_t group_with_reader(uint32_t group, const T& remoteReader)
+        {
+            for(const GroupTransition& transition : mTransitions_)
+            {
+                if(transition.from == group && transition.reader == remoteReader)
+                {
+                    return transition.to;
+                }
+            }
+
+            std::vector<T> readers(mGroups_[group]);
+            if(std::find(readers.begin(), readers.end(), remoteReader) == readers.end())
+            {
+                readers.push_back(remoteReader);
+            }
+
+            auto git = std::find(mGroups_.begin(), mGroups_.end(), readers);
+            uint32_t new_group = static_cast<uint32_t>(git - mGroups_.begin());
+            if(git == mGroups_.end())
+            {
+                mGroups_.push_back(std::move(readers));
+            }
+
+            mTransitions_.push_back(GroupTransition{group, remoteReader, new_group});
+            return new_group;
+        }
+
+        ItemList mItems_;
+
+        //! Index of the next item to be returned by pop().
+        size_t mNext_;
+
+        std::vector<std::vector<T>> mGroups_;
+
+        std::vector<GroupTransition> mTransitions_;
 };
 
 } // namespace rtps
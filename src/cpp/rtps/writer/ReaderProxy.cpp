@@ -44,10 +44,12 @@ ReaderProxy::ReaderProxy(
     , writer_(writer)
     , guid_as_vector_(ResourceLimitedContainerConfig::fixed_size_configuration(1u))
     , changes_for_reader_(resource_limits_from_history(writer->mp_history->m_att, 0))
+    , requested_fragments_(ResourceLimitedContainerConfig::dynamic_allocation_configuration())
     , nack_supression_event_(nullptr)
     , timers_enabled_(false)
     , last_acknack_count_(0)
     , last_nackfrag_count_(0)
+    , unsent_changes_count_(0)
 {
     nack_supression_event_ = std::make_shared <NackSupressionDuration>(writer_,
         TimeConv::Time_t2MilliSecondsDouble(times.nackSupressionDuration));
@@ -81,6 +83,8 @@ void ReaderProxy::stop()
     disable_timers();
 
     changes_for_reader_.clear();
+    unsent_changes_count_ = 0;
+    requested_fragments_.clear();
     last_acknack_count_ = 0;
     last_nackfrag_count_ = 0;
     changes_low_mark_ = SequenceNumber_t();
@@ -101,12 +105,14 @@ void ReaderProxy::update_nack_supression_interval(const Duration_t& interval)
 }
 
 void ReaderProxy::add_change(
-        const ChangeForReader_t& change,
+        CacheChange_t* change,
+        ChangeForReaderStatus_t status,
+        bool is_relevant,
         bool restart_nack_supression)
 {
-    assert(change.getSequenceNumber() > changes_low_mark_);
+    assert(change->sequenceNumber > changes_low_mark_);
     assert(changes_for_reader_.empty() ? true :
-        change.getSequenceNumber() > changes_for_reader_.back().getSequenceNumber());
+        change->sequenceNumber > changes_for_reader_.back().seq_num);
 
     if (restart_nack_supression && timers_enabled_)
     {
@@ -114,19 +120,30 @@ void ReaderProxy::add_change(
     }
 
     // For best effort readers, changes are acked when being sent
-    if (changes_for_reader_.empty() && change.getStatus() == ACKNOWLEDGED)
+    if (changes_for_reader_.empty() && status == ACKNOWLEDGED)
     {
-        changes_low_mark_ = change.getSequenceNumber();
+        changes_low_mark_ = change->sequenceNumber;
         return;
     }
 
-    if (changes_for_reader_.push_back(change) == nullptr)
+    ChangeState state;
+    state.seq_num = change->sequenceNumber;
+    state.change = change;
+    state.next_fragment = 1;
+    state.status = static_cast<uint8_t>(status);
+    state.is_relevant = is_relevant;
+
+    if (changes_for_reader_.push_back(state) == nullptr)
     {
         // This should never happen
         assert(false);
-        logError(RTPS_WRITER, "Error adding change " << change.getSequenceNumber() << " to reader proxy " << \
+        logError(RTPS_WRITER, "Error adding change " << change->sequenceNumber << " to reader proxy " << \
             reader_attributes_.guid);
     }
+    else if (status == UNSENT)
+    {
+        ++unsent_changes_count_;
+    }
 }
 
 bool ReaderProxy::has_changes() const
@@ -150,7 +167,7 @@ bool ReaderProxy::change_is_acked(const SequenceNumber_t& seq_num) const
         return true;
     }
 
-    return !chit->isRelevant() || chit->getStatus() == ACKNOWLEDGED;
+    return !chit->is_relevant || chit->status == ACKNOWLEDGED;
 }
 
 void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
@@ -160,7 +177,7 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
     if (seq_num > changes_low_mark_)
     {
         ChangeIterator chit = find_change(seq_num);
-        changes_for_reader_.erase(changes_for_reader_.begin(), chit);
+        erase_changes(changes_for_reader_.begin(), chit);
     }
     else
     {
@@ -182,7 +199,7 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
             ChangeConstIterator it = find_change(current_sequence);
             while( it != changes_for_reader_.end() && 
                 current_sequence <= changes_low_mark_ &&
-                it->getSequenceNumber() == current_sequence)
+                it->seq_num == current_sequence)
             {
                 ++current_sequence;
                 ++it;
@@ -190,13 +207,17 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
 
             if (current_sequence <= changes_low_mark_)
             {
-                CacheChange_t* change = nullptr;
-                if (writer_->mp_history->get_change(current_sequence, writer_->getGuid(), &change))
+                CacheChange_t* change = find_change_in_history(current_sequence);
+                if (change != nullptr)
                 {
                     should_sort = true;
-                    ChangeForReader_t cr(change);
-                    cr.setStatus(UNACKNOWLEDGED);
-                    changes_for_reader_.push_back(cr);
+                    ChangeState state;
+                    state.seq_num = current_sequence;
+                    state.change = change;
+                    state.next_fragment = 1;
+                    state.status = UNACKNOWLEDGED;
+                    state.is_relevant = true;
+                    changes_for_reader_.push_back(state);
                 }
             }
         }
@@ -204,7 +225,11 @@ void ReaderProxy::acked_changes_set(const SequenceNumber_t& seq_num)
         // Keep changes sorted by sequence number
         if (should_sort)
         {
-            std::sort(changes_for_reader_.begin(), changes_for_reader_.end(), ChangeForReaderCmp());
+            std::sort(changes_for_reader_.begin(), changes_for_reader_.end(),
+                [](const ChangeState& a, const ChangeState& b)
+                {
+                    return a.seq_num < b.seq_num;
+                });
         }
     }
 
@@ -218,10 +243,12 @@ bool ReaderProxy::requested_changes_set(const SequenceNumberSet_t& seq_num_set)
     seq_num_set.for_each([&](SequenceNumber_t sit)
     {
         ChangeIterator chit = find_change(sit);
-        if (chit != changes_for_reader_.end() && UNACKNOWLEDGED == chit->getStatus())
+        if (chit != changes_for_reader_.end() && UNACKNOWLEDGED == chit->status)
         {
-            chit->setStatus(REQUESTED);
-            chit->markAllFragmentsAsUnsent();
+            chit->status = REQUESTED;
+            // All fragments will be sent again.
+            chit->next_fragment = 1;
+            clear_requested_fragments(sit);
             isSomeoneWasSetRequested = true;
         }
     });
@@ -275,14 +302,14 @@ bool ReaderProxy::set_change_to_status(
         {
             // Erase the first change when it is acknowledged
             assert(it == changes_for_reader_.begin());
-            changes_for_reader_.erase(it);
+            erase_changes(it, it + 1);
         }
         else
         {
             // Otherwise change status
-            if (it->getStatus() != status)
+            if (it->status != status)
             {
-                it->setStatus(status);
+                set_status(*it, status);
                 change_was_modified = true;
             }
         }
@@ -309,8 +336,49 @@ bool ReaderProxy::mark_fragment_as_sent_for_change(
     if (it != changes_for_reader_.end())
     {
         change_found = true;
-        it->markFragmentsAsSent(frag_num);
-        was_last_fragment = it->getUnsentFragments().empty();
+
+        // A fragment sent out of order stays unsent, and will be sent again after the previous ones.
+        if (frag_num == it->next_fragment)
+        {
+            ++it->next_fragment;
+        }
+
+        bool pending_requests = false;
+        auto request = std::find_if(requested_fragments_.begin(), requested_fragments_.end(),
+            [&seq_num](const FragmentRequest& req)
+            {
+                return req.seq_num == seq_num;
+            });
+        if (request != requested_fragments_.end())
+        {
+            FragmentNumberSet_t fragments;
+            bool empty = true;
+            request->fragments.for_each([&](FragmentNumber_t element)
+            {
+                if (element != frag_num && element < it->next_fragment)
+                {
+                    if (empty)
+                    {
+                        fragments.base(element);
+                        empty = false;
+                    }
+                    fragments.add(element);
+                }
+            });
+
+            if (empty)
+            {
+                requested_fragments_.erase(request);
+            }
+            else
+            {
+                request->fragments = fragments;
+                pending_requests = true;
+            }
+        }
+
+        was_last_fragment = it->change == nullptr ||
+            (!pending_requests && it->next_fragment > it->change->getFragmentCount());
     }
 
     return change_found;
@@ -336,36 +404,54 @@ bool ReaderProxy::convert_status_on_all_changes(
     //       UNDERWAY=>UNACKNOWLEDGED (nack supression)
 
     bool at_least_one_modified = false;
-    for(ChangeForReader_t& change : changes_for_reader_)
+    for(ChangeState& change : changes_for_reader_)
     {
-        if (change.getStatus() == previous)
+        if (change.status == previous)
         {
             at_least_one_modified = true;
-            change.setStatus(next);
+            set_status(change, next);
         }
     }
 
     return at_least_one_modified;
 }
 
+void ReaderProxy::set_status(
+        ChangeState& change,
+        ChangeForReaderStatus_t status)
+{
+    if (change.status == UNSENT)
+    {
+        --unsent_changes_count_;
+    }
+    if (status == UNSENT)
+    {
+        ++unsent_changes_count_;
+    }
+    change.status = static_cast<uint8_t>(status);
+}
+
 void ReaderProxy::change_has_been_removed(const SequenceNumber_t& seq_num)
 {
     // Check sequence number is in the container, because it was not clean up.
-    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->getSequenceNumber())
+    if (changes_for_reader_.empty() || seq_num < changes_for_reader_.begin()->seq_num)
     {
         return;
     }
 
     // Element may not be in the container when marked as irrelevant.
     auto chit = find_change(seq_num);
-    changes_for_reader_.erase(chit);
+    if (chit != changes_for_reader_.end())
+    {
+        erase_changes(chit, chit + 1);
+    }
 }
 
 bool ReaderProxy::has_unacknowledged() const
 {
-    for (const ChangeForReader_t& it : changes_for_reader_)
+    for (const ChangeState& it : changes_for_reader_)
     {
-        if (it.isRelevant() && it.getStatus() == UNACKNOWLEDGED)
+        if (it.is_relevant && it.status == UNACKNOWLEDGED)
         {
             return true;
         }
@@ -385,12 +471,12 @@ bool ReaderProxy::requested_fragment_set(
         return false;
     }
 
-    changeIter->markFragmentsAsUnsent(frag_set);
+    add_requested_fragments(*changeIter, frag_set);
 
     // If it was UNSENT, we shouldn't switch back to REQUESTED to prevent stalling.
-    if (changeIter->getStatus() != UNSENT)
+    if (changeIter->status != UNSENT)
     {
-        changeIter->setStatus(REQUESTED);
+        changeIter->status = REQUESTED;
     }
 
     return true;
@@ -418,33 +504,207 @@ bool ReaderProxy::process_nack_frag(
     return false;
 }
 
+bool ReaderProxy::rtps_is_relevant(CacheChange_t* change) const
+{
+    return writer_->is_relevant(*change, reader_attributes_.guid);
+}
+
 static bool change_less_than_sequence(
-    const ChangeForReader_t& change,
+    const CacheChange_t* change,
     const SequenceNumber_t& seq_num)
 {
-    return change.getSequenceNumber() < seq_num;
+    return change->sequenceNumber < seq_num;
 }
 
 ReaderProxy::ChangeIterator ReaderProxy::find_change(const SequenceNumber_t& seq_num)
 {
     ReaderProxy::ChangeIterator it;
     ReaderProxy::ChangeIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num,
+        [](const ChangeState& change, const SequenceNumber_t& seq)
+        {
+            return change.seq_num < seq;
+        });
     
     return it == end 
         ? it 
-        : it->getSequenceNumber() == seq_num ? it : end;
+        : it->seq_num == seq_num ? it : end;
 }
 
 ReaderProxy::ChangeConstIterator ReaderProxy::find_change(const SequenceNumber_t& seq_num) const
 {
     ReaderProxy::ChangeConstIterator it;
     ReaderProxy::ChangeConstIterator end = changes_for_reader_.end();
-    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num, change_less_than_sequence);
+    it = std::lower_bound(changes_for_reader_.begin(), end, seq_num,
+        [](const ChangeState& change, const SequenceNumber_t& seq)
+        {
+            return change.seq_num < seq;
+        });
 
     return it == end
         ? it
-        : it->getSequenceNumber() == seq_num ? it : end;
+        : it->seq_num == seq_num ? it : end;
+}
+
+CacheChange_t* ReaderProxy::find_change_in_history(const SequenceNumber_t& seq_num) const
+{
+    // Changes on the writer's history are sorted by sequence number.
+    WriterHistory* history = writer_->mp_history;
+    auto end = history->changesEnd();
+    auto it = std::lower_bound(history->changesBegin(), end, seq_num, change_less_than_sequence);
+
+    return (it != end && (*it)->sequenceNumber == seq_num) ? *it : nullptr;
+}
+
+const FragmentNumberSet_t* ReaderProxy::find_requested_fragments(const SequenceNumber_t& seq_num) const
+{
+    for (const FragmentRequest& request : requested_fragments_)
+    {
+        if (request.seq_num == seq_num)
+        {
+            return &request.fragments;
+        }
+    }
+
+    return nullptr;
+}
+
+void ReaderProxy::add_requested_fragments(
+        ChangeState& change,
+        const FragmentNumberSet_t& frag_set)
+{
+    const FragmentNumberSet_t* previous = find_requested_fragments(change.seq_num);
+
+    // Fragments from the next one on are pending anyway.
+    FragmentNumber_t lowest = change.next_fragment;
+    if (previous != nullptr)
+    {
+        lowest = std::min(lowest, previous->base());
+    }
+    frag_set.for_each([&lowest](FragmentNumber_t element)
+    {
+        lowest = std::min(lowest, element);
+    });
+
+    if (lowest >= change.next_fragment)
+    {
+        return;
+    }
+
+    // Fragments out of the range of the set are sent again from the lowest one on.
+    FragmentNumberSet_t requested(lowest);
+    FragmentNumber_t next_fragment = change.next_fragment;
+    auto add_fragment = [&](FragmentNumber_t element)
+    {
+        if (element < next_fragment && !requested.add(element))
+        {
+            next_fragment = element;
+        }
+    };
+    if (previous != nullptr)
+    {
+        previous->for_each(add_fragment);
+    }
+    frag_set.for_each(add_fragment);
+
+    FragmentNumberSet_t fragments(lowest);
+    requested.for_each([&](FragmentNumber_t element)
+    {
+        if (element < next_fragment)
+        {
+            fragments.add(element);
+        }
+    });
+    change.next_fragment = next_fragment;
+
+    clear_requested_fragments(change.seq_num);
+    if (!fragments.empty())
+    {
+        FragmentRequest request;
+        request.seq_num = change.seq_num;
+        request.fragments = fragments;
+        requested_fragments_.push_back(request);
+    }
+}
+
+void ReaderProxy::clear_requested_fragments(const SequenceNumber_t& seq_num)
+{
+    if (!requested_fragments_.empty())
+    {
+        requested_fragments_.remove_if([&seq_num](const FragmentRequest& request)
+            {
+                return request.seq_num == seq_num;
+            });
+    }
+}
+
+void ReaderProxy::erase_changes(
+        ChangeIterator first,
+        ChangeIterator last)
+{
+    if (!requested_fragments_.empty() && first != last)
+    {
+        SequenceNumber_t first_seq = first->seq_num;
+        SequenceNumber_t last_seq = (last - 1)->seq_num;
+        auto in_range = [&](const FragmentRequest& request)
+        {
+            return first_seq <= request.seq_num && request.seq_num <= last_seq;
+        };
+        while (requested_fragments_.remove_if(in_range))
+        {
+        }
+    }
+
+    for (ChangeIterator it = first; it != last; ++it)
+    {
+        if (it->status == UNSENT)
+        {
+            --unsent_changes_count_;
+        }
+    }
+
+    changes_for_reader_.erase(first, last);
+}
+
+FragmentNumberSet_t ReaderProxy::UnsentChange::getUnsentFragments() const
+{
+    FragmentNumberSet_t fragments;
+
+    if (state_.change == nullptr || state_.change->getFragmentSize() == 0)
+    {
+        return fragments;
+    }
+
+    uint32_t fragment_count = state_.change->getFragmentCount();
+    FragmentNumber_t lowest = state_.next_fragment;
+    if (requested_fragments_ != nullptr)
+    {
+        lowest = std::min(lowest, requested_fragments_->base());
+    }
+
+    if (lowest > fragment_count)
+    {
+        return fragments;
+    }
+
+    fragments.base(lowest);
+    if (requested_fragments_ != nullptr)
+    {
+        requested_fragments_->for_each([&fragments](FragmentNumber_t element)
+        {
+            fragments.add(element);
+        });
+    }
+
+    for (FragmentNumber_t frag_num = state_.next_fragment; frag_num <= fragment_count; ++frag_num)
+    {
+        if (!fragments.add(frag_num))
+        {
+            break;
+        }
+    }
+
+    return fragments;
 }
 
 }   // namespace rtps
@@ -31,11 +31,13 @@
 #include <fastrtps/rtps/writer/timedevent/PeriodicHeartbeat.h>
 #include <fastrtps/rtps/writer/timedevent/NackSupressionDuration.h>
 #include <fastrtps/rtps/writer/timedevent/NackResponseDelay.h>
+#include <fastrtps/rtps/writer/timedevent/LatencyBudgetFlush.h>
 
 #include <fastrtps/rtps/history/WriterHistory.h>
 
 #include <fastrtps/log/Log.h>
 #include <fastrtps/utils/TimeConversion.h>
+#include <fastrtps/utils/IPLocator.h>
 
 #include "RTPSWriterCollector.h"
 #include "StatefulWriterOrganizer.h"
@@ -64,6 +66,8 @@ StatefulWriter::StatefulWriter(
     , disableHeartbeatPiggyback_(att.disableHeartbeatPiggyback)
     , sendBufferSize_(pimpl->get_min_network_send_buffer_size())
     , currentUsageSendBufferSize_(static_cast<int32_t>(pimpl->get_min_network_send_buffer_size()))
+    , async_changes_(new RTPSWriterCollector<ReaderProxy*>())
+    , repair_multicast_threshold_(att.repair_multicast_threshold)
 {
     m_heartbeatCount = 0;
     m_HBReaderEntityId =
@@ -88,6 +92,12 @@ StatefulWriter::~StatefulWriter()
 
     logInfo(RTPS_WRITER,"StatefulWriter destructor");
 
+    if (latency_budget_flush_ != nullptr)
+    {
+        delete(latency_budget_flush_);
+        latency_budget_flush_ = nullptr;
+    }
+
     // Stop all active proxies and pass them to the pool
     while (!matched_readers_.empty())
     {
@@ -136,7 +146,7 @@ void StatefulWriter::unsent_change_added_to_history(
 
     if(!matched_readers_.empty())
     {
-        if(!isAsync())
+        if(!isAsync() && !(m_pushMode && is_batching()))
         {
             //TODO(Ricardo) Temporal.
             bool expectsInlineQos = false;
@@ -146,37 +156,42 @@ void StatefulWriter::unsent_change_added_to_history(
             // CacheChange_t in some reader proxies.
             for (ReaderProxy* it : matched_readers_)
             {
-                ChangeForReader_t changeForReader(change);
+                ChangeForReaderStatus_t status = UNACKNOWLEDGED;
 
                 if(m_pushMode)
                 {
                     if(it->is_reliable())
                     {
-                        changeForReader.setStatus(UNDERWAY);
+                        status = UNDERWAY;
                     }
                     else
                     {
-                        changeForReader.setStatus(ACKNOWLEDGED);
+                        status = ACKNOWLEDGED;
                     }
                 }
-                else
-                {
-                    changeForReader.setStatus(UNACKNOWLEDGED);
-                }
 
-                changeForReader.setRelevance(it->rtps_is_relevant(change));
-                it->add_change(changeForReader, true);
+                it->add_change(change, status, it->rtps_is_relevant(change), true);
                 expectsInlineQos |= it->expects_inline_qos();
             }
 
             try
             {
                 //At this point we are sure all information was stores. We now can send data.
-                if (!m_separateSendingEnabled)
+                //With a reader data filter the change is sent separately, as some readers only receive a GAP.
+                if (!m_separateSendingEnabled && reader_data_filter_ == nullptr)
                 {
                     RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
                             max_blocking_time);
-                    if (!group.add_data(*change, all_remote_readers_, mAllShrinkedLocatorList, expectsInlineQos))
+                    auto fragment_sent = [&](FragmentNumber_t frag_num)
+                    {
+                        bool was_last_fragment = false;
+                        for (ReaderProxy* it : matched_readers_)
+                        {
+                            it->mark_fragment_as_sent_for_change(change->sequenceNumber, frag_num, was_last_fragment);
+                        }
+                    };
+                    if (!send_data_or_fragments(group, *change, all_remote_readers_, mAllShrinkedLocatorList,
+                                expectsInlineQos, fragment_sent))
                     {
                         logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                     }
@@ -193,7 +208,18 @@ void StatefulWriter::unsent_change_added_to_history(
                         const LocatorList_t& locators = it->remote_locators_shrinked();
                         RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
                                 locators, guids, max_blocking_time);
-                        if (!group.add_data(*change, guids, locators, it->expects_inline_qos()))
+                        auto fragment_sent = [&](FragmentNumber_t frag_num)
+                        {
+                            bool was_last_fragment = false;
+                            it->mark_fragment_as_sent_for_change(change->sequenceNumber, frag_num, was_last_fragment);
+                        };
+                        if (!it->rtps_is_relevant(change))
+                        {
+                            std::set<SequenceNumber_t> irrelevant{change->sequenceNumber};
+                            group.add_gap(irrelevant, guids, locators);
+                        }
+                        else if (!send_data_or_fragments(group, *change, guids, locators, it->expects_inline_qos(),
+                                    fragment_sent))
                         {
                             logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                         }
@@ -215,24 +241,18 @@ void StatefulWriter::unsent_change_added_to_history(
         }
         else
         {
-            for(ReaderProxy* it : matched_readers_)
+            if (!isAsync())
             {
-                ChangeForReader_t changeForReader(change);
-
-                if(m_pushMode)
-                {
-                    changeForReader.setStatus(UNSENT);
-                }
-                else
-                {
-                    changeForReader.setStatus(UNACKNOWLEDGED);
-                }
+                add_to_batch_nts(change);
+            }
 
-                changeForReader.setRelevance(it->rtps_is_relevant(change));
-                it->add_change(changeForReader, false);
+            for(ReaderProxy* it : matched_readers_)
+            {
+                ChangeForReaderStatus_t status = m_pushMode ? UNSENT : UNACKNOWLEDGED;
+                it->add_change(change, status, it->rtps_is_relevant(change), false);
             }
 
-            if (m_pushMode)
+            if (m_pushMode && isAsync())
             {
                 AsyncWriterThread::wakeUp(this);
             }
@@ -262,12 +282,25 @@ bool StatefulWriter::change_removed_by_history(CacheChange_t* a_change)
         it->change_has_been_removed(sequence_number);
     }
 
+    pending_repairs_.erase(sequence_number);
+
     may_remove_change_ = 2;
     may_remove_change_cond_.notify_one();
 
     return true;
 }
 
+size_t StatefulWriter::unsent_changes_count_nts() const
+{
+    size_t count = 0;
+    for (const ReaderProxy* remote_reader : matched_readers_)
+    {
+        count += remote_reader->unsent_changes_count();
+    }
+
+    return count;
+}
+
 void StatefulWriter::send_any_unsent_changes()
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
@@ -294,13 +327,18 @@ void StatefulWriter::send_any_unsent_changes()
 
                     // Loop all changes
                     bool is_reliable = remoteReader->is_reliable();
-                    auto unsent_change_process = [&](const SequenceNumber_t& seqNum, const ChangeForReader_t* unsentChange)
+                    auto unsent_change_process = [&](const SequenceNumber_t& seqNum,
+                            const ReaderProxy::UnsentChange* unsentChange)
                     {
                         if (unsentChange != nullptr && unsentChange->isRelevant() && unsentChange->isValid())
                         {
-                            // As we checked we are not async, we know we cannot have fragments
-                            if (group.add_data(*(unsentChange->getChange()), guids, locators,
-                                        remoteReader->expects_inline_qos()))
+                            auto fragment_sent = [&](FragmentNumber_t frag_num)
+                            {
+                                bool was_last_fragment = false;
+                                remoteReader->mark_fragment_as_sent_for_change(seqNum, frag_num, was_last_fragment);
+                            };
+                            if (send_data_or_fragments(group, *(unsentChange->getChange()), guids, locators,
+                                        remoteReader->expects_inline_qos(), fragment_sent))
                             {
                                 remoteReader->set_change_to_status(seqNum, UNDERWAY, true);
 
@@ -344,169 +382,199 @@ void StatefulWriter::send_any_unsent_changes()
     }
     else
     {
-        RTPSWriterCollector<ReaderProxy*> relevantChanges;
-        StatefulWriterOrganizer notRelevantChanges;
-
-        for (ReaderProxy* remoteReader : matched_readers_)
+        // The collector takes a limited number of fragments of each change per pass. The asynchronous thread
+        // sends the rest later, while a synchronous writer sends them from the calling thread.
+        bool fragments_pending = false;
+        do
         {
-            auto unsent_change_process = [&](const SequenceNumber_t& seq_num, const ChangeForReader_t* unsentChange)
+            fragments_pending = false;
+
+            RTPSWriterCollector<ReaderProxy*>& relevantChanges = *async_changes_;
+            relevantChanges.clear();
+            StatefulWriterOrganizer notRelevantChanges;
+
+            for (ReaderProxy* remoteReader : matched_readers_)
             {
-                if (unsentChange != nullptr && unsentChange->isRelevant() && unsentChange->isValid())
+                auto unsent_change_process = [&](const SequenceNumber_t& seq_num,
+                        const ReaderProxy::UnsentChange* unsentChange)
                 {
-                    if (m_pushMode)
+                    if (unsentChange != nullptr && unsentChange->isRelevant() && unsentChange->isValid())
                     {
-                        relevantChanges.add_change(unsentChange->getChange(), remoteReader, unsentChange->getUnsentFragments());
+                        if (m_pushMode)
+                        {
+                            relevantChanges.add_change(unsentChange->getChange(), remoteReader, unsentChange->getUnsentFragments());
+                        }
+                        else // Change status to UNACKNOWLEDGED
+                        {
+                            remoteReader->set_change_to_status(seq_num, UNACKNOWLEDGED, false);
+                        }
                     }
-                    else // Change status to UNACKNOWLEDGED
+                    else
                     {
-                        remoteReader->set_change_to_status(seq_num, UNACKNOWLEDGED, false);
+                        remoteReader->set_change_to_status(seq_num, UNDERWAY, true);
+                        notRelevantChanges.add_sequence_number(seq_num, remoteReader);
                     }
-                }
-                else
-                {
-                    remoteReader->set_change_to_status(seq_num, UNDERWAY, true);
-                    notRelevantChanges.add_sequence_number(seq_num, remoteReader);
-                }
-            };
+                };
 
-            remoteReader->for_each_unsent_change(max_sequence, unsent_change_process);
-        }
-
-        if (m_pushMode)
-        {
-            // Clear all relevant changes through the local controllers first
-            for (std::unique_ptr<FlowController>& controller : m_controllers)
-                (*controller)(relevantChanges);
-
-            // Clear all relevant changes through the parent controllers
-            for (std::unique_ptr<FlowController>& controller : mp_RTPSParticipant->getFlowControllers())
-                (*controller)(relevantChanges);
+                remoteReader->for_each_unsent_change(max_sequence, unsent_change_process);
+            }
 
-            try
+            if (m_pushMode)
             {
-                RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages);
-                uint32_t lastBytesProcessed = 0;
+                // Clear all relevant changes through the local controllers first
+                for (std::unique_ptr<FlowController>& controller : m_controllers)
+                    (*controller)(relevantChanges);
+
+                // Clear all relevant changes through the parent controllers
+                for (std::unique_ptr<FlowController>& controller : mp_RTPSParticipant->getFlowControllers())
+                    (*controller)(relevantChanges);
 
-                while (!relevantChanges.empty())
+                try
                 {
-                    RTPSWriterCollector<ReaderProxy*>::Item changeToSend = relevantChanges.pop();
-                    std::vector<GUID_t> remote_readers;
-                    std::vector<LocatorList_t> locatorLists;
-                    bool expectsInlineQos = false;
+                    RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages);
+                    uint32_t lastBytesProcessed = 0;
 
-                    for (const ReaderProxy* remoteReader : changeToSend.remoteReaders)
+                    while (!relevantChanges.empty())
                     {
-                        remote_readers.push_back(remoteReader->guid());
-                        locatorLists.push_back(remoteReader->remote_locators());
-                        expectsInlineQos |= remoteReader->expects_inline_qos();
-                    }
+                        RTPSWriterCollector<ReaderProxy*>::Item changeToSend = relevantChanges.pop();
+                        const std::vector<ReaderProxy*>& changeReaders = relevantChanges.remote_readers(changeToSend);
+                        const AsyncDestination& destination = async_destination_nts_(changeToSend.readersGroup);
 
-                    // TODO(Ricardo) Flowcontroller has to be used in RTPSMessageGroup. Study.
-                    // And controllers are notified about the changes being sent
-                    FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
+                        // TODO(Ricardo) Flowcontroller has to be used in RTPSMessageGroup. Study.
+                        // And controllers are notified about the changes being sent
+                        FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
 
-                    if (changeToSend.fragmentNumber != 0)
-                    {
-                        if (group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber, remote_readers,
-                                    mp_RTPSParticipant->network_factory().ShrinkLocatorLists(locatorLists),
-                                    expectsInlineQos))
+                        if (changeToSend.fragmentNumber != 0)
                         {
-                            bool must_wake_up_async_thread = false;
-                            for (ReaderProxy* remoteReader : changeToSend.remoteReaders)
+                            const LocatorList_t& locators = repair_locators_nts_(changeToSend.sequenceNumber,
+                                    changeToSend.cacheChange->getFragmentSize(), changeReaders.size(), destination);
+
+                            if (group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber,
+                                        destination.guids, locators, destination.expects_inline_qos))
                             {
-                                bool allFragmentsSent = false;
-                                if (remoteReader->mark_fragment_as_sent_for_change(
-                                            changeToSend.sequenceNumber,
-                                            changeToSend.fragmentNumber,
-                                            allFragmentsSent))
+                                bool must_wake_up_async_thread = false;
+                                for (ReaderProxy* remoteReader : changeReaders)
                                 {
-                                    must_wake_up_async_thread |= !allFragmentsSent;
-                                    if (remoteReader->is_reliable())
+                                    bool allFragmentsSent = false;
+                                    if (remoteReader->mark_fragment_as_sent_for_change(
+                                                changeToSend.sequenceNumber,
+                                                changeToSend.fragmentNumber,
+                                                allFragmentsSent))
                                     {
-                                        activateHeartbeatPeriod = true;
-                                        if (allFragmentsSent)
+                                        must_wake_up_async_thread |= !allFragmentsSent;
+                                        if (remoteReader->is_reliable())
                                         {
-                                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                                            activateHeartbeatPeriod = true;
+                                            if (allFragmentsSent)
+                                            {
+                                                remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                                            }
                                         }
+                                        else
+                                        {
+                                            if (allFragmentsSent)
+                                            {
+                                                remoteReader->set_change_to_status(changeToSend.sequenceNumber, ACKNOWLEDGED, false);
+                                            }
+                                        }
+                                    }
+                                }
+
+                                if (must_wake_up_async_thread)
+                                {
+                                    if (isAsync())
+                                    {
+                                        AsyncWriterThread::wakeUp(this);
                                     }
                                     else
                                     {
-                                        if (allFragmentsSent)
-                                        {
-                                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, ACKNOWLEDGED, false);
-                                        }
+                                        fragments_pending = true;
                                     }
                                 }
+                                else
+                                {
+                                    // The repair ends with the last fragment pending for its readers, which is not
+                                    // the last fragment of the change when only some were requested by NACK_FRAG.
+                                    pending_repairs_.erase(changeToSend.sequenceNumber);
+                                }
                             }
-
-                            if (must_wake_up_async_thread)
+                            else
                             {
-                                AsyncWriterThread::wakeUp(this);
+                                logError(RTPS_WRITER, "Error sending fragment (" << changeToSend.sequenceNumber <<
+                                        ", " << changeToSend.fragmentNumber << ")");
                             }
                         }
                         else
                         {
-                            logError(RTPS_WRITER, "Error sending fragment (" << changeToSend.sequenceNumber <<
-                                    ", " << changeToSend.fragmentNumber << ")");
-                        }
-                    }
-                    else
-                    {
-                    if (group.add_data(*changeToSend.cacheChange, remote_readers,
-                                    mp_RTPSParticipant->network_factory().ShrinkLocatorLists(locatorLists),
-                                    expectsInlineQos))
-                    {
-                        for (ReaderProxy* remoteReader : changeToSend.remoteReaders)
-                        {
-                            remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
+                            const LocatorList_t& locators = repair_locators_nts_(changeToSend.sequenceNumber,
+                                    changeToSend.cacheChange->serializedPayload.length, changeReaders.size(),
+                                    destination);
+                            pending_repairs_.erase(changeToSend.sequenceNumber);
+
+                            if (group.add_data(*changeToSend.cacheChange, destination.guids, locators,
+                                            destination.expects_inline_qos))
+                            {
+                                for (ReaderProxy* remoteReader : changeReaders)
+                                {
+                                    remoteReader->set_change_to_status(changeToSend.sequenceNumber, UNDERWAY, true);
 
-                            if (remoteReader->is_reliable())
+                                    if (remoteReader->is_reliable())
+                                    {
+                                        activateHeartbeatPeriod = true;
+                                    }
+                                }
+                            }
+                            else
                             {
-                                activateHeartbeatPeriod = true;
+                                logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
                             }
                         }
+
+                        // Heartbeat piggyback.
+                        send_heartbeat_piggyback_nts_(group, lastBytesProcessed);
                     }
-                    else
+
+                    for (auto& pair : notRelevantChanges.elements())
                     {
-                        logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
-                    }
-                    }
+                        if (pair.first.size() == 1)
+                        {
+                            // The proxy already keeps its destination.
+                            const ReaderProxy* remoteReader = pair.first.front();
+                            group.add_gap(pair.second, remoteReader->guid_as_vector(),
+                                    remoteReader->remote_locators_shrinked());
+                            continue;
+                        }
 
-                    // Heartbeat piggyback.
-                    send_heartbeat_piggyback_nts_(group, lastBytesProcessed);
+                        gap_readers_.clear();
+                        gap_locator_lists_.clear();
+                        for (const ReaderProxy* remoteReader : pair.first)
+                        {
+                            gap_readers_.push_back(remoteReader->guid());
+                            gap_locator_lists_.push_back(remoteReader->remote_locators());
+                        }
+                        group.add_gap(pair.second, gap_readers_,
+                                mp_RTPSParticipant->network_factory().ShrinkLocatorLists(gap_locator_lists_));
+                    }
                 }
-
-                for (std::pair<std::vector<ReaderProxy*>, std::set<SequenceNumber_t>> pair : notRelevantChanges.elements())
+                catch(const RTPSMessageGroup::timeout&)
                 {
-                    std::vector<GUID_t> remote_readers;
-                    std::vector<LocatorList_t> locatorLists;
-
-                    for (const ReaderProxy* remoteReader : pair.first)
-                    {
-                        remote_readers.push_back(remoteReader->guid());
-                        locatorLists.push_back(remoteReader->remote_locators());
-                    }
-                    group.add_gap(pair.second, remote_readers,
-                            mp_RTPSParticipant->network_factory().ShrinkLocatorLists(locatorLists));
+                    logError(RTPS_WRITER, "Max blocking time reached");
+                    fragments_pending = false;
                 }
             }
-            catch(const RTPSMessageGroup::timeout&)
-            {
-                logError(RTPS_WRITER, "Max blocking time reached");
-            }
-        }
-        else
-        {
-            try
-            {
-                RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages);
-                send_heartbeat_nts_(all_remote_readers_, mAllShrinkedLocatorList, group, true);
-            }
-            catch(const RTPSMessageGroup::timeout&)
+            else
             {
-                logError(RTPS_WRITER, "Max blocking time reached");
+                try
+                {
+                    RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages);
+                    send_heartbeat_nts_(all_remote_readers_, mAllShrinkedLocatorList, group, true);
+                }
+                catch(const RTPSMessageGroup::timeout&)
+                {
+                    logError(RTPS_WRITER, "Max blocking time reached");
+                }
             }
-        }
+        } while (fragments_pending);
     }
 
     if (activateHeartbeatPeriod)
@@ -575,6 +643,7 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
     allLocatorLists.push_back(locators);
 
     update_cached_info_nts(allLocatorLists);
+    invalidate_async_destinations_nts_();
 
     getRTPSParticipant()->createSenderResources(mAllShrinkedLocatorList, false);
 
@@ -596,25 +665,20 @@ bool StatefulWriter::matched_reader_add(RemoteReaderAttributes& rdata)
         for(std::vector<CacheChange_t*>::iterator cit = mp_history->changesBegin();
                 cit != mp_history->changesEnd(); ++cit)
         {
-            ChangeForReader_t changeForReader(*cit);
+            bool is_relevant = false;
 
             if(rp->durability_kind() >= TRANSIENT_LOCAL && this->getAttributes().durabilityKind >= TRANSIENT_LOCAL)
             {
-                changeForReader.setRelevance(rp->rtps_is_relevant(*cit));
-                if(!rp->rtps_is_relevant(*cit))
-                {
-                    not_relevant_changes.insert(changeForReader.getSequenceNumber());
-                }
+                is_relevant = rp->rtps_is_relevant(*cit);
             }
-            else
+
+            if(!is_relevant)
             {
-                changeForReader.setRelevance(false);
-                not_relevant_changes.insert(changeForReader.getSequenceNumber());
+                not_relevant_changes.insert((*cit)->sequenceNumber);
             }
 
-            // The ChangeForReader_t status has to be UNACKNOWLEDGED
-            changeForReader.setStatus(UNACKNOWLEDGED); /// TODO JOOOODERR TESSSST BESTEFFORT CASE
-            rp->add_change(changeForReader, false);
+            // The change status has to be UNACKNOWLEDGED
+            rp->add_change(*cit, UNACKNOWLEDGED, is_relevant, false); /// TODO JOOOODERR TESSSST BESTEFFORT CASE
             ++current_seq;
         }
 
@@ -683,6 +747,7 @@ bool StatefulWriter::matched_reader_remove(const RemoteReaderAttributes& rdata)
 
     all_remote_readers_.remove(rdata.guid);
     update_cached_info_nts(allLocatorLists);
+    invalidate_async_destinations_nts_();
 
     if(matched_readers_.size()==0)
         this->mp_periodicHB->cancel_timer();
@@ -703,6 +768,96 @@ bool StatefulWriter::matched_reader_remove(const RemoteReaderAttributes& rdata)
     return false;
 }
 
+const StatefulWriter::AsyncDestination& StatefulWriter::async_destination_nts_(uint32_t readers_group)
+{
+    if (async_destinations_.size() < async_changes_->groups_size())
+    {
+        async_destinations_.resize(async_changes_->groups_size());
+    }
+
+    AsyncDestination& destination = async_destinations_[readers_group];
+    if (!destination.valid)
+    {
+        std::vector<LocatorList_t> locatorLists;
+        std::vector<LocatorList_t> unicastLocatorLists;
+
+        destination.guids.clear();
+        destination.expects_inline_qos = false;
+        for (const ReaderProxy* remoteReader : async_changes_->group_readers(readers_group))
+        {
+            destination.guids.push_back(remoteReader->guid());
+            locatorLists.push_back(remoteReader->remote_locators());
+            unicastLocatorLists.push_back(remoteReader->remote_locators_shrinked());
+            destination.expects_inline_qos |= remoteReader->expects_inline_qos();
+        }
+
+        destination.locators = mp_RTPSParticipant->network_factory().ShrinkLocatorLists(locatorLists);
+        destination.unicast_locators = mp_RTPSParticipant->network_factory().ShrinkLocatorLists(unicastLocatorLists);
+        destination.valid = true;
+    }
+
+    return destination;
+}
+
+const LocatorList_t& StatefulWriter::repair_locators_nts_(
+        const SequenceNumber_t& sequence_number,
+        uint32_t payload_size,
+        size_t readers_count,
+        const AsyncDestination& destination)
+{
+    auto repair = pending_repairs_.find(sequence_number);
+    if (repair == pending_repairs_.end())
+    {
+        return destination.locators;
+    }
+
+    // Requested by too few readers to be worth reaching everyone listening on a multicast locator.
+    const LocatorList_t& locators = (repair_multicast_threshold_ == 0 || repair->second < repair_multicast_threshold_) ?
+        destination.unicast_locators : destination.locators;
+
+    size_t copies = locators.size();
+    ++repair_statistics_.repairs_sent;
+    for (const Locator_t& locator : locators)
+    {
+        if (IPLocator::isMulticast(locator))
+        {
+            ++repair_statistics_.multicast_repairs;
+            break;
+        }
+    }
+
+    // Without aggregation, each reader would have received its own copy.
+    if (readers_count > copies)
+    {
+        repair_statistics_.saved_repairs += readers_count - copies;
+        repair_statistics_.saved_bytes += static_cast<uint64_t>(readers_count - copies) * payload_size;
+    }
+
+    return locators;
+}
+
+RepairStatistics StatefulWriter::get_repair_statistics()
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
+    return repair_statistics_;
+}
+
+WriterStatistics StatefulWriter::get_statistics()
+{
+    WriterStatistics statistics = RTPSWriter::get_statistics();
+    statistics.repairs = get_repair_statistics();
+    return statistics;
+}
+
+void StatefulWriter::invalidate_async_destinations_nts_()
+{
+    async_changes_->clear_groups();
+    for (AsyncDestination& destination : async_destinations_)
+    {
+        destination.valid = false;
+    }
+}
+
 bool StatefulWriter::matched_reader_is_matched(const RemoteReaderAttributes& rdata)
 {
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
@@ -1068,9 +1223,21 @@ void StatefulWriter::perform_nack_response()
     std::unique_lock<std::recursive_timed_mutex> lock(mp_mutex);
     bool must_wake_up_async_thread = false;
 
+    // All the changes requested during the nack response delay are repaired together, so the ones requested
+    // by several readers are sent once to all of them.
     for (ReaderProxy* remote_reader : matched_readers_)
     {
-        if (remote_reader->perform_acknack_response())
+        auto requested_change = [this](const SequenceNumber_t& seq_num)
+        {
+            // Only the aggregated sending of a push mode writer repairs several readers at once.
+            if (m_pushMode && !m_separateSendingEnabled)
+            {
+                ++pending_repairs_[seq_num];
+            }
+            ++repair_statistics_.requested_changes;
+        };
+
+        if (remote_reader->perform_acknack_response(requested_change))
         {
             must_wake_up_async_thread = true;
         }
@@ -1113,6 +1280,7 @@ bool StatefulWriter::process_acknack(
         {
             if (remote_reader->guid() == reader_guid)
             {
+                statistics_counters_.acknacks_received.fetch_add(1, std::memory_order_relaxed);
                 if (remote_reader->check_and_set_acknack_count(ack_count))
                 {
                     if (sn_set.base() > SequenceNumber_t(0, 0))
@@ -1162,6 +1330,7 @@ bool StatefulWriter::process_nack_frag(
         {
             if (remote_reader->guid() == reader_guid)
             {
+                statistics_counters_.nackfrags_received.fetch_add(1, std::memory_order_relaxed);
                 if (remote_reader->process_nack_frag(reader_guid, ack_count, seq_num, fragments_state))
                 {
                     nack_response_event_->restart_timer();
@@ -21,6 +21,7 @@
 #include <fastrtps/rtps/writer/WriterListener.h>
 #include <fastrtps/rtps/history/WriterHistory.h>
 #include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <fastrtps/rtps/writer/timedevent/LatencyBudgetFlush.h>
 #include "../participant/RTPSParticipantImpl.h"
 #include "../flowcontrol/FlowController.h"
 #include "../history/HistoryAttributesExtension.hpp"
@@ -54,6 +55,12 @@ StatelessWriter::~StatelessWriter()
 {
     AsyncWriterThread::removeWriter(*this);
     logInfo(RTPS_WRITER,"StatelessWriter destructor";);
+
+    if (latency_budget_flush_ != nullptr)
+    {
+        delete(latency_budget_flush_);
+        latency_budget_flush_ = nullptr;
+    }
 }
 
 void StatelessWriter::get_builtin_guid(ResourceLimitedVector<GUID_t>& guid_vector)
@@ -103,7 +110,7 @@ void StatelessWriter::unsent_change_added_to_history(
         encrypt_cachechange(change);
 #endif
 
-        if (!isAsync())
+        if (!isAsync() && !is_batching())
         {
             try
             {
@@ -118,7 +125,8 @@ void StatelessWriter::unsent_change_added_to_history(
                         RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
                                 it.endpoint.unicastLocatorList, guids, max_blocking_time);
 
-                        if (!group.add_data(*change, guids, it.endpoint.unicastLocatorList, it.expectsInlineQos))
+                        if (!send_data_or_fragments(group, *change, guids, it.endpoint.unicastLocatorList,
+                                    it.expectsInlineQos))
                         {
                             logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                         }
@@ -129,7 +137,8 @@ void StatelessWriter::unsent_change_added_to_history(
                     RTPSMessageGroup group(mp_RTPSParticipant, this, RTPSMessageGroup::WRITER, m_cdrmessages,
                             mAllShrinkedLocatorList, all_remote_readers_, max_blocking_time);
 
-                    if (!group.add_data(*change, all_remote_readers_, mAllShrinkedLocatorList, is_inline_qos_expected_))
+                    if (!send_data_or_fragments(group, *change, all_remote_readers_, mAllShrinkedLocatorList,
+                                is_inline_qos_expected_))
                     {
                         logError(RTPS_WRITER, "Error sending change " << change->sequenceNumber);
                     }
@@ -145,6 +154,12 @@ void StatelessWriter::unsent_change_added_to_history(
                 logError(RTPS_WRITER, "Max blocking time reached");
             }
         }
+        else if (is_batching())
+        {
+            setLivelinessAsserted(true);
+            add_to_batch_nts(change);
+            unsent_changes_.push_back(ChangeForReader_t(change));
+        }
         else
         {
             unsent_changes_.push_back(ChangeForReader_t(change));
@@ -175,10 +190,15 @@ bool StatelessWriter::change_removed_by_history(CacheChange_t* change)
     return true;
 }
 
+size_t StatelessWriter::unsent_changes_count_nts() const
+{
+    return unsent_changes_.size();
+}
+
 bool StatelessWriter::is_acked_by_all(const CacheChange_t* change)
 {
-    // Only asynchronous writers may have unacked (i.e. unsent changes)
-    if (isAsync())
+    // Only asynchronous or batching writers may have unacked (i.e. unsent changes)
+    if (isAsync() || is_batching())
     {
         std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
 
@@ -228,71 +248,83 @@ void StatelessWriter::send_any_unsent_changes()
     //TODO(Mcc) Separate sending for asynchronous writers
     std::lock_guard<std::recursive_timed_mutex> guard(mp_mutex);
 
-    ReaderLocator tmp;
-    RTPSWriterCollector<ReaderLocator*> changesToSend;
-
-    for (const ChangeForReader_t& unsentChange : unsent_changes_)
-    {
-        changesToSend.add_change(unsentChange.getChange(), &tmp, unsentChange.getUnsentFragments());
-    }
-
-    // Clear through local controllers
-    for (auto& controller : flow_controllers_)
+    // The collector takes a limited number of fragments of each change per pass. A synchronous writer sends
+    // the rest from the calling thread, unless the flow controllers hold them back.
+    bool fragments_pending = false;
+    do
     {
-        (*controller)(changesToSend);
-    }
+        fragments_pending = false;
 
-    // Clear through parent controllers
-    for (auto& controller : mp_RTPSParticipant->getFlowControllers())
-    {
-        (*controller)(changesToSend);
-    }
+        ReaderLocator tmp;
+        RTPSWriterCollector<ReaderLocator*> changesToSend;
 
-    try
-    {
-        RTPSMessageGroup group(mp_RTPSParticipant, this,  RTPSMessageGroup::WRITER, m_cdrmessages,
-            mAllShrinkedLocatorList, all_remote_readers_);
+        for (const ChangeForReader_t& unsentChange : unsent_changes_)
+        {
+            changesToSend.add_change(unsentChange.getChange(), &tmp, unsentChange.getUnsentFragments());
+        }
 
-        bool bHasListener = mp_listener != nullptr;
-        while(!changesToSend.empty())
+        // Clear through local controllers
+        size_t collected = changesToSend.size();
+        for (auto& controller : flow_controllers_)
         {
-            RTPSWriterCollector<ReaderLocator*>::Item changeToSend = changesToSend.pop();
+            (*controller)(changesToSend);
+        }
 
-            // Remove the messages selected for sending from the original list,
-            // and update those that were fragmented with the new sent index
-            update_unsent_changes(changeToSend.sequenceNumber, changeToSend.fragmentNumber);
+        // Clear through parent controllers
+        for (auto& controller : mp_RTPSParticipant->getFlowControllers())
+        {
+            (*controller)(changesToSend);
+        }
+        bool throttled = changesToSend.size() < collected;
 
-            // Notify the controllers
-            FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
+        try
+        {
+            RTPSMessageGroup group(mp_RTPSParticipant, this,  RTPSMessageGroup::WRITER, m_cdrmessages,
+                mAllShrinkedLocatorList, all_remote_readers_);
 
-            if(changeToSend.fragmentNumber != 0)
+            bool bHasListener = mp_listener != nullptr;
+            while(!changesToSend.empty())
             {
-                if(!group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber, all_remote_readers_,
-                            mAllShrinkedLocatorList, is_inline_qos_expected_))
+                RTPSWriterCollector<ReaderLocator*>::Item changeToSend = changesToSend.pop();
+
+                // Remove the messages selected for sending from the original list,
+                // and update those that were fragmented with the new sent index
+                update_unsent_changes(changeToSend.sequenceNumber, changeToSend.fragmentNumber);
+
+                // Notify the controllers
+                FlowController::NotifyControllersChangeSent(changeToSend.cacheChange);
+
+                if(changeToSend.fragmentNumber != 0)
                 {
-                    logError(RTPS_WRITER, "Error sending fragment (" << changeToSend.sequenceNumber <<
-                            ", " << changeToSend.fragmentNumber << ")");
+                    if(!group.add_data_frag(*changeToSend.cacheChange, changeToSend.fragmentNumber,
+                                all_remote_readers_, mAllShrinkedLocatorList, is_inline_qos_expected_))
+                    {
+                        logError(RTPS_WRITER, "Error sending fragment (" << changeToSend.sequenceNumber <<
+                                ", " << changeToSend.fragmentNumber << ")");
+                    }
                 }
-            }
-            else
-            {
-                if(!group.add_data(*changeToSend.cacheChange, all_remote_readers_,
-                            mAllShrinkedLocatorList, is_inline_qos_expected_))
+                else
                 {
-                    logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
+                    if(!group.add_data(*changeToSend.cacheChange, all_remote_readers_,
+                                mAllShrinkedLocatorList, is_inline_qos_expected_))
+                    {
+                        logError(RTPS_WRITER, "Error sending change " << changeToSend.sequenceNumber);
+                    }
                 }
-            }
 
-            if (bHasListener && is_acked_by_all(changeToSend.cacheChange))
-            {
-                mp_listener->onWriterChangeReceivedByAll(this, changeToSend.cacheChange);
+                if (bHasListener && is_acked_by_all(changeToSend.cacheChange))
+                {
+                    mp_listener->onWriterChangeReceivedByAll(this, changeToSend.cacheChange);
+                }
             }
+
+            fragments_pending = !isAsync() && collected > 0 && !throttled && !unsent_changes_.empty();
         }
-    }
-    catch(const RTPSMessageGroup::timeout&)
-    {
-        logError(RTPS_WRITER, "Max blocking time reached");
-    }
+        catch(const RTPSMessageGroup::timeout&)
+        {
+            logError(RTPS_WRITER, "Max blocking time reached");
+        }
+    } while (fragments_pending);
 
     logInfo(RTPS_WRITER, "Finish sending unsent changes";);
 }
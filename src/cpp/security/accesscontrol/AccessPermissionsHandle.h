@@ -24,15 +24,43 @@
 #include <fastrtps/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastrtps/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
 
+#include <fastrtps/utils/StringMatching.h>
+
 #include <openssl/x509.h>
 #include <string>
 #include <map>
+#include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 namespace security {
 
+/**
+ * Topic expressions of the rules of a grant, compiled for fast lookup.
+ * Positions in the indexes are the positions of the rules in the grant.
+ */
+struct GrantTopicIndex
+{
+    GrantTopicIndex() : built(false), domain_filtered(false), domain_id(0) {}
+
+    bool built;
+    bool domain_filtered;
+    uint32_t domain_id;
+    StringMatchingIndex publishes;
+    StringMatchingIndex subscribes;
+    StringMatchingIndex relays;
+};
+
+//! Memoized result of an access control check.
+struct AccessDecision
+{
+    bool allowed;
+    bool relay_only;
+    std::string error;
+};
+
 class AccessPermissions
 {
     public:
@@ -58,7 +86,16 @@ class AccessPermissions
         ParticipantSecurityAttributes governance_rule_;
         std::map<std::string, EndpointSecurityAttributes> governance_reader_topic_rules_;
         std::map<std::string, EndpointSecurityAttributes> governance_writer_topic_rules_;
+        //! Topic expressions of the governance topic rules, indexed by their order in the maps above.
+        StringMatchingIndex governance_topic_index_;
+        std::vector<std::string> governance_topic_expressions_;
         Grant grant;
+
+        //! Protects the lazily built grant index and the memoized decisions.
+        mutable std::mutex access_mutex_;
+        mutable GrantTopicIndex grant_topic_index_;
+        mutable std::map<std::pair<uint32_t, std::string>, AccessDecision> remote_writer_decisions_;
+        mutable std::map<std::pair<uint32_t, std::string>, AccessDecision> remote_reader_decisions_;
 };
 
 typedef HandleImpl<AccessPermissions> AccessPermissionsHandle;
@@ -83,41 +83,82 @@ static bool is_domain_in_set(const uint32_t domain_id, const Domains& domains)
     return returned_value;
 }
 
-static const EndpointSecurityAttributes* is_topic_in_sec_attributes(const char* topic_name,
-        const std::map<std::string, EndpointSecurityAttributes>& attributes)
+static void index_governance_topic_rules(AccessPermissions& permissions)
+{
+    permissions.governance_topic_index_.clear();
+    permissions.governance_topic_expressions_.clear();
+
+    // Reader and writer maps share the topic expressions.
+    for(auto& topic : permissions.governance_writer_topic_rules_)
+    {
+        permissions.governance_topic_index_.add(topic.first, permissions.governance_topic_expressions_.size());
+        permissions.governance_topic_expressions_.push_back(topic.first);
+    }
+}
+
+static const EndpointSecurityAttributes* is_topic_in_sec_attributes(const AccessPermissions& permissions,
+        const char* topic_name, const std::map<std::string, EndpointSecurityAttributes>& attributes)
 {
     const EndpointSecurityAttributes* returned_value = nullptr;
+    size_t position = permissions.governance_topic_index_.find_first(topic_name);
 
-    for(auto& topic : attributes)
+    if(position != StringMatchingIndex::npos)
     {
-        if(StringMatching::matchString(topic.first.c_str(), topic_name))
+        auto topic = attributes.find(permissions.governance_topic_expressions_[position]);
+
+        if(topic != attributes.end())
         {
-            returned_value = &topic.second;
-            break;
+            returned_value = &topic->second;
         }
     }
 
     return returned_value;
 }
 
-static bool is_topic_in_criterias(const char * topic_name, const std::vector<Criteria>& criterias)
+static void index_criterias(StringMatchingIndex& index, const std::vector<Criteria>& criterias, size_t position)
 {
-    bool returned_value = false;
+    for(auto& criteria : criterias)
+    {
+        for(auto& topic : criteria.topics)
+        {
+            index.add(topic, position);
+        }
+    }
+}
 
-    for(auto criteria_it = criterias.begin(); !returned_value &&
-            criteria_it != criterias.end(); ++criteria_it)
+/*
+ * Returns the topic index of the grant rules. It is built the first time it is needed, with the rules applying
+ * to the given domain when filter_domain is set. Must be called with access_mutex_ taken.
+ */
+static const GrantTopicIndex& get_grant_topic_index(const AccessPermissions& permissions, bool filter_domain,
+        const uint32_t domain_id)
+{
+    GrantTopicIndex& index = permissions.grant_topic_index_;
+
+    if(!index.built || index.domain_filtered != filter_domain || index.domain_id != domain_id)
     {
-        for(auto topic : (*criteria_it).topics)
+        index.publishes.clear();
+        index.subscribes.clear();
+        index.relays.clear();
+
+        for(size_t position = 0; position < permissions.grant.rules.size(); ++position)
         {
-            if(StringMatching::matchString(topic.c_str(), topic_name))
+            const Rule& rule = permissions.grant.rules[position];
+
+            if(!filter_domain || is_domain_in_set(domain_id, rule.domains))
             {
-                returned_value = true;
-                break;
+                index_criterias(index.publishes, rule.publishes, position);
+                index_criterias(index.subscribes, rule.subscribes, position);
+                index_criterias(index.relays, rule.relays, position);
             }
         }
+
+        index.built = true;
+        index.domain_filtered = filter_domain;
+        index.domain_id = domain_id;
     }
 
-    return returned_value;
+    return index;
 }
 
 static bool is_partition_in_criterias(const std::string& partition, const std::vector<Criteria>& criterias)
@@ -127,7 +168,7 @@ static bool is_partition_in_criterias(const std::string& partition, const std::v
     for(auto criteria_it = criterias.begin(); !returned_value &&
             criteria_it != criterias.end(); ++criteria_it)
     {
-        for(auto part : (*criteria_it).partitions)
+        for(auto& part : (*criteria_it).partitions)
         {
             if(StringMatching::matchString(partition.c_str(), part.c_str()))
             {
@@ -607,7 +648,7 @@ static bool check_subject_name(const IdentityHandle& ih, AccessPermissionsHandle
         if(returned_value)
         {
             // Retry governance info.
-            for(auto rule : governance.rules)
+            for(auto& rule : governance.rules)
             {
                 if(is_domain_in_set(domain_id, rule.domains))
                 {
@@ -678,6 +719,8 @@ static bool check_subject_name(const IdentityHandle& ih, AccessPermissionsHandle
                                     std::move(topic_expression), std::move(writer_attributes)));
                     }
 
+                    index_governance_topic_rules(**ah);
+
                     break;
                 }
             }
@@ -696,6 +739,114 @@ static bool check_subject_name(const IdentityHandle& ih, AccessPermissionsHandle
     return returned_value;
 }
 
+/*
+ * Evaluates the access of a remote datawriter. Must be called with access_mutex_ taken.
+ */
+static bool evaluate_remote_datawriter(const AccessPermissions& permissions, const uint32_t domain_id,
+        const WriterProxyData& publication_data, SecurityException& exception)
+{
+    bool returned_value = false;
+    const EndpointSecurityAttributes* attributes = nullptr;
+
+    if((attributes = is_topic_in_sec_attributes(permissions, publication_data.topicName().c_str(),
+            permissions.governance_writer_topic_rules_)) != nullptr)
+    {
+        if(!attributes->is_write_protected)
+        {
+            return true;
+        }
+    }
+    else
+    {
+        exception = _SecurityException_("Not found topic access rule for topic " + publication_data.topicName().to_string());
+        return false;
+    }
+
+    size_t position = get_grant_topic_index(permissions, true, domain_id).publishes.find_first(
+            publication_data.topicName().c_str());
+
+    if(position != StringMatchingIndex::npos)
+    {
+        if(permissions.grant.rules[position].allow)
+        {
+            returned_value = true;
+        }
+        else
+        {
+            exception = _SecurityException_(publication_data.topicName().to_string() +
+                    std::string(" topic denied by deny rule."));
+        }
+    }
+
+    if(!returned_value && strlen(exception.what()) == 0)
+    {
+        exception = _SecurityException_(publication_data.topicName().to_string() +
+                std::string(" topic not found in allow rule."));
+    }
+
+    return returned_value;
+}
+
+/*
+ * Evaluates the access of a remote datareader. Must be called with access_mutex_ taken.
+ */
+static bool evaluate_remote_datareader(const AccessPermissions& permissions, const uint32_t domain_id,
+        const ReaderProxyData& subscription_data, bool& relay_only, SecurityException& exception)
+{
+    bool returned_value = false;
+    const EndpointSecurityAttributes* attributes = nullptr;
+
+    relay_only = false;
+
+    if((attributes = is_topic_in_sec_attributes(permissions, subscription_data.topicName().c_str(),
+            permissions.governance_reader_topic_rules_)) != nullptr)
+    {
+        if(!attributes->is_read_protected)
+        {
+            return true;
+        }
+    }
+    else
+    {
+        exception = _SecurityException_("Not found topic access rule for topic " + subscription_data.topicName().to_string());
+        return false;
+    }
+
+    const GrantTopicIndex& index = get_grant_topic_index(permissions, true, domain_id);
+    size_t subscribe_position = index.subscribes.find_first(subscription_data.topicName().c_str());
+    size_t relay_position = index.relays.find_first(subscription_data.topicName().c_str());
+
+    // Within a rule, subscribes are checked before relays.
+    if(subscribe_position != StringMatchingIndex::npos && subscribe_position <= relay_position)
+    {
+        if(permissions.grant.rules[subscribe_position].allow)
+        {
+            returned_value = true;
+        }
+        else
+        {
+            exception = _SecurityException_(subscription_data.topicName().to_string() +
+                    std::string(" topic denied by deny rule."));
+        }
+    }
+    else if(relay_position != StringMatchingIndex::npos)
+    {
+        if(permissions.grant.rules[relay_position].allow)
+        {
+            relay_only = true;
+            returned_value = true;
+        }
+    }
+
+    if(!returned_value && strlen(exception.what()) == 0)
+    {
+        exception = _SecurityException_(subscription_data.topicName().to_string() +
+                std::string(" topic not found in allow rule."));
+    }
+
+    return returned_value;
+}
+
 static bool generate_permissions_token(AccessPermissionsHandle& handle)
 {
     Property property;
@@ -966,6 +1117,8 @@ PermissionsHandle* Permissions::validate_remote_permissions(Authentication&,
     (*handle)->governance_rule_ = lph->governance_rule_;
     (*handle)->governance_reader_topic_rules_ = lph->governance_reader_topic_rules_;
     (*handle)->governance_writer_topic_rules_ = lph->governance_writer_topic_rules_;
+    (*handle)->governance_topic_index_ = lph->governance_topic_index_;
+    (*handle)->governance_topic_expressions_ = lph->governance_topic_expressions_;
 
     return handle;
 }
@@ -983,7 +1136,7 @@ bool Permissions::check_create_participant(const PermissionsHandle& local_handle
     }
 
     //Search an allow rule with my domain
-    for(auto rule : lah->grant.rules)
+    for(auto& rule : lah->grant.rules)
     {
         if(rule.allow)
         {
@@ -1018,7 +1171,7 @@ bool Permissions::check_remote_participant(const PermissionsHandle& remote_handl
     }
 
     //Search an allow rule with my domain
-    for(auto rule : rah->grant.rules)
+    for(auto& rule : rah->grant.rules)
     {
         if(rule.allow)
         {
@@ -1053,7 +1206,7 @@ bool Permissions::check_create_datawriter(const PermissionsHandle& local_handle,
 
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_writer_topic_rules_)) != nullptr)
+    if((attributes = is_topic_in_sec_attributes(**lah, topic_name.c_str(), lah->governance_writer_topic_rules_)) != nullptr)
     {
         if(!attributes->is_write_protected)
         {
@@ -1067,42 +1220,43 @@ bool Permissions::check_create_datawriter(const PermissionsHandle& local_handle,
     }
 
     // Search topic
-    for(auto rule : lah->grant.rules)
+    std::unique_lock<std::mutex> lock(lah->access_mutex_);
+    size_t position = get_grant_topic_index(**lah, false, 0).publishes.find_first(topic_name.c_str());
+    lock.unlock();
+
+    if(position != StringMatchingIndex::npos)
     {
-        if(is_topic_in_criterias(topic_name.c_str(), rule.publishes))
+        const Rule& rule = lah->grant.rules[position];
+
+        if(rule.allow)
         {
-            if(rule.allow)
-            {
-                returned_value = true;
+            returned_value = true;
 
-                if (partitions.empty())
+            if (partitions.empty())
+            {
+                if (!is_partition_in_criterias(std::string(), rule.publishes))
                 {
-                    if (!is_partition_in_criterias(std::string(), rule.publishes))
-                    {
-                        returned_value = false;
-                        exception = _SecurityException_(std::string("<empty> partition not found in rule."));
-                    }
+                    returned_value = false;
+                    exception = _SecurityException_(std::string("<empty> partition not found in rule."));
                 }
-                else
+            }
+            else
+            {
+                // Search partitions
+                for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
+                    ++partition_it)
                 {
-                    // Search partitions
-                    for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
-                        ++partition_it)
+                    if (!is_partition_in_criterias(*partition_it, rule.publishes))
                     {
-                        if (!is_partition_in_criterias(*partition_it, rule.publishes))
-                        {
-                            returned_value = false;
-                            exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
-                        }
+                        returned_value = false;
+                        exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
                     }
                 }
             }
-            else
-            {
-                exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
-            }
-
-            break;
+        }
+        else
+        {
+            exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
         }
     }
 
@@ -1129,7 +1283,7 @@ bool Permissions::check_create_datareader(const PermissionsHandle& local_handle,
 
     const EndpointSecurityAttributes* attributes = nullptr;
 
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_reader_topic_rules_)) != nullptr)
+    if ((attributes = is_topic_in_sec_attributes(**lah, topic_name.c_str(), lah->governance_reader_topic_rules_)) != nullptr)
     {
         if(!attributes->is_read_protected)
         {
@@ -1142,42 +1296,43 @@ bool Permissions::check_create_datareader(const PermissionsHandle& local_handle,
         return false;
     }
 
-    for(auto rule : lah->grant.rules)
+    std::unique_lock<std::mutex> lock(lah->access_mutex_);
+    size_t position = get_grant_topic_index(**lah, false, 0).subscribes.find_first(topic_name.c_str());
+    lock.unlock();
+
+    if(position != StringMatchingIndex::npos)
     {
-        if(is_topic_in_criterias(topic_name.c_str(), rule.subscribes))
+        const Rule& rule = lah->grant.rules[position];
+
+        if(rule.allow)
         {
-            if(rule.allow)
-            {
-                returned_value = true;
+            returned_value = true;
 
-                if (partitions.empty())
+            if (partitions.empty())
+            {
+                if (!is_partition_in_criterias(std::string(), rule.subscribes))
                 {
-                    if (!is_partition_in_criterias(std::string(), rule.subscribes))
-                    {
-                        returned_value = false;
-                        exception = _SecurityException_(std::string("<empty> partition not found in rule."));
-                    }
+                    returned_value = false;
+                    exception = _SecurityException_(std::string("<empty> partition not found in rule."));
                 }
-                else
+            }
+            else
+            {
+                // Search partitions
+                for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
+                    ++partition_it)
                 {
-                    // Search partitions
-                    for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
-                        ++partition_it)
+                    if (!is_partition_in_criterias(*partition_it, rule.subscribes))
                     {
-                        if (!is_partition_in_criterias(*partition_it, rule.subscribes))
-                        {
-                            returned_value = false;
-                            exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
-                        }
+                        returned_value = false;
+                        exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
                     }
                 }
             }
-            else
-            {
-                exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
-            }
-
-            break;
+        }
+        else
+        {
+            exception = _SecurityException_(topic_name + std::string(" topic denied by deny rule."));
         }
     }
 
@@ -1193,7 +1348,6 @@ bool Permissions::check_remote_datawriter(const PermissionsHandle& remote_handle
         const uint32_t domain_id, const WriterProxyData& publication_data,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& rah = AccessPermissionsHandle::narrow(remote_handle);
 
     if(rah.nil())
@@ -1202,57 +1356,36 @@ bool Permissions::check_remote_datawriter(const PermissionsHandle& remote_handle
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
+    std::lock_guard<std::mutex> lock(rah->access_mutex_);
+    auto decision_key = std::make_pair(domain_id, publication_data.topicName().to_string());
+    auto decision = rah->remote_writer_decisions_.find(decision_key);
 
-    if((attributes = is_topic_in_sec_attributes(publication_data.topicName().c_str(),rah->governance_writer_topic_rules_))
-            != nullptr)
+    if(decision == rah->remote_writer_decisions_.end())
     {
-        if(!attributes->is_write_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_("Not found topic access rule for topic " + publication_data.topicName().to_string());
-        return false;
-    }
+        AccessDecision new_decision{false, false, std::string()};
+        SecurityException decision_exception;
+        new_decision.allowed = evaluate_remote_datawriter(**rah, domain_id, publication_data, decision_exception);
 
-    for(auto rule : rah->grant.rules)
-    {
-        if(is_domain_in_set(domain_id, rule.domains))
+        if(!new_decision.allowed)
         {
-            if(is_topic_in_criterias(publication_data.topicName().c_str(), rule.publishes))
-            {
-                if(rule.allow)
-                {
-                    returned_value = true;
-                }
-                else
-                {
-                    exception = _SecurityException_(publication_data.topicName().to_string() +
-                            std::string(" topic denied by deny rule."));
-                }
-
-                break;
-            }
+            new_decision.error = decision_exception.what();
         }
+
+        decision = rah->remote_writer_decisions_.emplace(std::move(decision_key), std::move(new_decision)).first;
     }
 
-    if(!returned_value && strlen(exception.what()) == 0)
+    if(!decision->second.allowed)
     {
-        exception = _SecurityException_(publication_data.topicName().to_string() +
-                std::string(" topic not found in allow rule."));
+        exception = SecurityException(decision->second.error);
     }
 
-    return returned_value;
+    return decision->second.allowed;
 }
 
 bool Permissions::check_remote_datareader(const PermissionsHandle& remote_handle,
         const uint32_t domain_id, const ReaderProxyData& subscription_data,
         bool& relay_only, SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& rah = AccessPermissionsHandle::narrow(remote_handle);
 
     relay_only = false;
@@ -1263,61 +1396,32 @@ bool Permissions::check_remote_datareader(const PermissionsHandle& remote_handle
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
+    std::lock_guard<std::mutex> lock(rah->access_mutex_);
+    auto decision_key = std::make_pair(domain_id, subscription_data.topicName().to_string());
+    auto decision = rah->remote_reader_decisions_.find(decision_key);
 
-    if((attributes = is_topic_in_sec_attributes(subscription_data.topicName().c_str(),rah->governance_reader_topic_rules_))
-            != nullptr)
-    {
-        if(!attributes->is_read_protected)
-        {
-            return true;
-        }
-    }
-    else
+    if(decision == rah->remote_reader_decisions_.end())
     {
-        exception = _SecurityException_("Not found topic access rule for topic " + subscription_data.topicName().to_string());
-        return false;
-    }
+        AccessDecision new_decision{false, false, std::string()};
+        SecurityException decision_exception;
+        new_decision.allowed = evaluate_remote_datareader(**rah, domain_id, subscription_data,
+                new_decision.relay_only, decision_exception);
 
-    for(auto rule : rah->grant.rules)
-    {
-        if(is_domain_in_set(domain_id, rule.domains))
+        if(!new_decision.allowed)
         {
-            if(is_topic_in_criterias(subscription_data.topicName(), rule.subscribes))
-            {
-                if(rule.allow)
-                {
-                    returned_value = true;
-                }
-                else
-                {
-                    exception = _SecurityException_(subscription_data.topicName().to_string() +
-                            std::string(" topic denied by deny rule."));
-                }
-
-                break;
-            }
-
-            if (is_topic_in_criterias(subscription_data.topicName(), rule.relays))
-            {
-                if (rule.allow)
-                {
-                    relay_only = true;
-                    returned_value = true;
-                }
-
-                break;
-            }
+            new_decision.error = decision_exception.what();
         }
+
+        decision = rah->remote_reader_decisions_.emplace(std::move(decision_key), std::move(new_decision)).first;
     }
 
-    if(!returned_value && strlen(exception.what()) == 0)
+    if(!decision->second.allowed)
     {
-        exception = _SecurityException_(subscription_data.topicName().to_string() +
-                std::string(" topic not found in allow rule."));
+        exception = SecurityException(decision->second.error);
     }
 
-    return returned_value;
+    relay_only = decision->second.relay_only;
+    return decision->second.allowed;
 }
 
 bool Permissions::get_participant_sec_attributes(const PermissionsHandle& local_handle,
@@ -1343,7 +1447,7 @@ bool Permissions::get_datawriter_sec_attributes(const PermissionsHandle& permiss
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_writer_topic_rules_))
+    if((attr = is_topic_in_sec_attributes(**lah, topic_name.c_str(), lah->governance_writer_topic_rules_))
             != nullptr)
     {
         attributes = *attr;
@@ -1364,7 +1468,7 @@ bool Permissions::get_datareader_sec_attributes(const PermissionsHandle& permiss
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(permissions_handle);
     const EndpointSecurityAttributes* attr = nullptr;
 
-    if((attr = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_reader_topic_rules_))
+    if((attr = is_topic_in_sec_attributes(**lah, topic_name.c_str(), lah->governance_reader_topic_rules_))
             != nullptr)
     {
         attributes = *attr;
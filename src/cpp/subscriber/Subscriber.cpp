@@ -61,3 +61,8 @@ uint64_t Subscriber::getUnreadCount() const
 {
 	return mp_impl->getUnreadCount();
 }
+
+ReaderStatistics Subscriber::get_statistics() const
+{
+    return mp_impl->get_statistics();
+}
@@ -19,12 +19,14 @@
 
 #include <fastrtps/subscriber/SubscriberHistory.h>
 #include "SubscriberImpl.h"
+#include "../utils/Tracepoints.hpp"
 
 #include <fastrtps/rtps/reader/RTPSReader.h>
 #include <fastrtps/rtps/reader/WriterProxy.h>
 
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/log/Log.h>
+#include <fastrtps/utils/eClock.h>
 
 #include <mutex>
 
@@ -84,8 +86,24 @@ bool SubscriberHistory::received_change(
         return false;
     }
 
+    FASTRTPS_TRACE_HISTORY_RECEIVED(mp_reader->getGuid(), a_change->writerGUID, a_change->sequenceNumber);
+
     std::lock_guard<std::recursive_timed_mutex> guard(*mp_mutex);
 
+    // Changes received without INFO_TS are stamped with the reception time.
+    if (a_change->sourceTimestamp == c_TimeZero)
+    {
+        eClock clock;
+        clock.setTimeNow(&a_change->sourceTimestamp);
+    }
+
+    if (is_change_expired(a_change))
+    {
+        logInfo(SUBSCRIBER, this->mp_subImpl->getGuid().entityId << ": Change " << a_change->sequenceNumber
+            << " from " << a_change->writerGUID << " discarded because its lifespan expired");
+        return false;
+    }
+
     //NO KEY HISTORY
     if (mp_subImpl->getAttributes().topic.getTopicKind() == NO_KEY)
     {
@@ -149,6 +167,7 @@ bool SubscriberHistory::received_change(
             if (this->add_change(a_change))
             {
                 increaseUnreadCount();
+                mp_subImpl->lifespan_change_added(a_change);
                 if ((int32_t)m_changes.size() == m_resourceLimitsQos.max_samples)
                     m_isHistoryFull = true;
                 logInfo(SUBSCRIBER, this->mp_subImpl->getGuid().entityId
@@ -165,13 +184,18 @@ bool SubscriberHistory::received_change(
         if (!a_change->instanceHandle.isDefined() && mp_subImpl->getType() != nullptr)
         {
             logInfo(RTPS_HISTORY, "Getting Key of change with no Key transmitted")
-                mp_subImpl->getType()->deserialize(&a_change->serializedPayload, mp_getKeyObject);
             bool is_key_protected = false;
 #if HAVE_SECURITY
             is_key_protected = mp_reader->getAttributes().security_attributes().is_key_protected;
 #endif
-            if(!mp_subImpl->getType()->getKey(mp_getKeyObject, &a_change->instanceHandle, is_key_protected))
-                return false;
+            // Types able to read the key straight from the payload avoid deserializing the whole sample.
+            if(!mp_subImpl->getType()->getKeyFromPayload(&a_change->serializedPayload, &a_change->instanceHandle,
+                        is_key_protected))
+            {
+                mp_subImpl->getType()->deserialize(&a_change->serializedPayload, mp_getKeyObject);
+                if(!mp_subImpl->getType()->getKey(mp_getKeyObject, &a_change->instanceHandle, is_key_protected))
+                    return false;
+            }
 
         }
         else if (!a_change->instanceHandle.isDefined())
@@ -248,6 +272,7 @@ bool SubscriberHistory::received_change(
                 if (this->add_change(a_change))
                 {
                     increaseUnreadCount();
+                    mp_subImpl->lifespan_change_added(a_change);
                     if ((int32_t)m_changes.size() == m_resourceLimitsQos.max_samples)
                         m_isHistoryFull = true;
                     //ADD TO KEY VECTOR
@@ -565,3 +590,79 @@ bool SubscriberHistory::remove_change_sub(CacheChange_t* change, t_v_Inst_Caches
     }
     return false;
 }
+
+bool SubscriberHistory::is_change_expired(const CacheChange_t* change) const
+{
+    // Changes received without INFO_TS will be stamped with the reception time, so they have not expired.
+    if (change->sourceTimestamp == c_TimeZero)
+    {
+        return false;
+    }
+
+    // Lifespan is a QoS of the writer.
+    Duration_t lifespan = mp_subImpl->writer_lifespan(change->writerGUID);
+    if (lifespan == c_TimeInfinite)
+    {
+        return false;
+    }
+
+    Time_t now;
+    eClock clock;
+    clock.setTimeNow(&now);
+    return !(now < change->sourceTimestamp + lifespan);
+}
+
+bool SubscriberHistory::remove_expired_changes(
+        const Time_t& now,
+        Time_t& next_expiration)
+{
+    if (mp_reader == nullptr || mp_mutex == nullptr)
+    {
+        logError(RTPS_HISTORY, "You need to create a Reader with this History before using it");
+        return false;
+    }
+
+    std::lock_guard<std::recursive_timed_mutex> guard(*mp_mutex);
+
+    // Changes from different writers are not ordered by source timestamp, so the whole history is checked.
+    bool remaining = false;
+    size_t index = 0;
+    while (index < m_changes.size())
+    {
+        CacheChange_t* change = m_changes[index];
+        Duration_t lifespan = mp_subImpl->writer_lifespan(change->writerGUID);
+        if (lifespan == c_TimeInfinite)
+        {
+            ++index;
+            continue;
+        }
+
+        Time_t expiration = change->sourceTimestamp + lifespan;
+        if (now < expiration)
+        {
+            if (!remaining || expiration < next_expiration)
+            {
+                next_expiration = expiration;
+            }
+            remaining = true;
+            ++index;
+            continue;
+        }
+
+        logInfo(SUBSCRIBER, this->mp_reader->getGuid().entityId << ": Removing change " << change->sequenceNumber
+            << " from " << change->writerGUID << " because its lifespan expired");
+        bool read = change->isRead;
+        if (!this->remove_change_sub(change))
+        {
+            ++index;
+            continue;
+        }
+
+        if (!read)
+        {
+            this->decreaseUnreadCount();
+        }
+    }
+
+    return remaining;
+}
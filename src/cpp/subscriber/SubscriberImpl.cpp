@@ -18,6 +18,9 @@
  */
 
 #include "SubscriberImpl.h"
+#include "../timedevent/TimedCallback.h"
+#include "../rtps/participant/RTPSParticipantImpl.h"
+#include "../utils/Tracepoints.hpp"
 #include <fastrtps/subscriber/Subscriber.h>
 #include <fastrtps/TopicDataType.h>
 #include <fastrtps/subscriber/SubscriberListener.h>
@@ -26,8 +29,11 @@
 
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
+#include <fastrtps/rtps/resources/ResourceEvent.h>
 
 #include <fastrtps/log/Log.h>
+#include <fastrtps/utils/TimeConversion.h>
+#include <fastrtps/utils/eClock.h>
 
 using namespace eprosima::fastrtps::rtps;
 
@@ -51,6 +57,8 @@ SubscriberImpl::SubscriberImpl(
     , m_readerListener(this)
     , mp_userSubscriber(nullptr)
     , mp_rtpsParticipant(nullptr)
+    , lifespan_timer_(nullptr)
+    , lifespan_scheduled_(false)
     {
 
     }
@@ -63,6 +71,9 @@ SubscriberImpl::~SubscriberImpl()
         logInfo(SUBSCRIBER,this->getGuid().entityId << " in topic: "<<this->m_att.topic.topicName);
     }
 
+    // Timer has to be destroyed before the reader, as its callback uses it.
+    delete(lifespan_timer_);
+
     RTPSDomain::removeRTPSReader(mp_reader);
     delete(this->mp_userSubscriber);
 }
@@ -84,10 +95,14 @@ void SubscriberImpl::waitForUnreadMessage()
 
 bool SubscriberImpl::readNextData(void* data,SampleInfo_t* info)
 {
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_reader->getMutex());
+    remove_expired_changes();
     return this->m_history.readNextData(data,info);
 }
 
 bool SubscriberImpl::takeNextData(void* data,SampleInfo_t* info) {
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_reader->getMutex());
+    remove_expired_changes();
     return this->m_history.takeNextData(data,info);
 }
 
@@ -97,6 +112,11 @@ const GUID_t& SubscriberImpl::getGuid(){
     return mp_reader->getGuid();
 }
 
+ReaderStatistics SubscriberImpl::get_statistics() const
+{
+    return mp_reader->get_statistics();
+}
+
 
 
 bool SubscriberImpl::updateAttributes(const SubscriberAttributes& att)
@@ -179,17 +199,24 @@ bool SubscriberImpl::updateAttributes(const SubscriberAttributes& att)
     return updated;
 }
 
-void SubscriberImpl::SubscriberReaderListener::onNewCacheChangeAdded(RTPSReader* /*reader*/, const CacheChange_t* const /*change*/)
+void SubscriberImpl::SubscriberReaderListener::onNewCacheChangeAdded(RTPSReader* reader, const CacheChange_t* const change)
 {
+    (void)reader;
+    (void)change;
+
     if(mp_subscriberImpl->mp_listener != nullptr)
     {
         //cout << "FIRST BYTE: "<< (int)change->serializedPayload.data[0] << endl;
+        FASTRTPS_TRACE_LISTENER_BEGIN(reader->getGuid(), change->writerGUID, change->sequenceNumber);
         mp_subscriberImpl->mp_listener->onNewDataMessage(mp_subscriberImpl->mp_userSubscriber);
+        FASTRTPS_TRACE_LISTENER_END(reader->getGuid(), change->writerGUID, change->sequenceNumber);
     }
 }
 
 void SubscriberImpl::SubscriberReaderListener::onReaderMatched(RTPSReader* /*reader*/, MatchingInfo& info)
 {
+    mp_subscriberImpl->update_writer_lifespan(info);
+
     if (this->mp_subscriberImpl->mp_listener != nullptr)
     {
         mp_subscriberImpl->mp_listener->onSubscriptionMatched(mp_subscriberImpl->mp_userSubscriber,info);
@@ -212,5 +239,110 @@ uint64_t SubscriberImpl::getUnreadCount() const
     return m_history.getUnreadCount();
 }
 
+void SubscriberImpl::lifespan_change_added(const CacheChange_t* change)
+{
+    Duration_t lifespan = writer_lifespan(change->writerGUID);
+    if(lifespan != c_TimeInfinite)
+    {
+        schedule_lifespan_timer(change->sourceTimestamp + lifespan);
+    }
+}
+
+Duration_t SubscriberImpl::writer_lifespan(const GUID_t& writer_guid) const
+{
+    std::lock_guard<std::mutex> guard(writer_lifespans_mutex_);
+
+    auto it = writer_lifespans_.find(writer_guid);
+    return it != writer_lifespans_.end() ? it->second : c_TimeInfinite;
+}
+
+void SubscriberImpl::update_writer_lifespan(const MatchingInfo& info)
+{
+    if(info.status == MATCHED_MATCHING)
+    {
+        WriterProxyData writer_data;
+        if(mp_reader->getRTPSParticipant()->get_remote_writer_info(info.remoteEndpointGuid, writer_data) &&
+                writer_data.m_qos.m_lifespan.duration != c_TimeInfinite)
+        {
+            std::lock_guard<std::mutex> guard(writer_lifespans_mutex_);
+            writer_lifespans_[info.remoteEndpointGuid] = writer_data.m_qos.m_lifespan.duration;
+        }
+    }
+    else
+    {
+        std::lock_guard<std::mutex> guard(writer_lifespans_mutex_);
+        writer_lifespans_.erase(info.remoteEndpointGuid);
+    }
+}
+
+void SubscriberImpl::remove_expired_changes()
+{
+    if(!lifespan_scheduled_)
+    {
+        return;
+    }
+
+    Time_t now;
+    eClock clock;
+    clock.setTimeNow(&now);
+
+    // Expired changes are removed before the timer fires, so they are never delivered to the user.
+    if(!(now < lifespan_next_expiration_))
+    {
+        purge_expired_changes(now);
+    }
+}
+
+void SubscriberImpl::purge_expired_changes(const Time_t& now)
+{
+    lifespan_scheduled_ = false;
+
+    Time_t next_expiration;
+    if(m_history.remove_expired_changes(now, next_expiration))
+    {
+        schedule_lifespan_timer(next_expiration);
+    }
+}
+
+void SubscriberImpl::schedule_lifespan_timer(const Time_t& expiration)
+{
+    if(lifespan_scheduled_ && lifespan_next_expiration_ <= expiration)
+    {
+        return;
+    }
+
+    if(lifespan_timer_ == nullptr)
+    {
+        ResourceEvent& event_resource = mp_reader->getRTPSParticipant()->getEventResource();
+        lifespan_timer_ = new TimedCallback(std::bind(&SubscriberImpl::lifespan_expired, this), 0,
+                event_resource.getIOService(), event_resource.getThread());
+    }
+
+    Time_t now;
+    eClock clock;
+    clock.setTimeNow(&now);
+
+    lifespan_timer_->cancel_timer();
+    lifespan_timer_->update_interval_millisec(expiration > now ?
+            TimeConv::Time_t2MilliSecondsDouble(expiration - now) : 0);
+    lifespan_timer_->restart_timer();
+
+    lifespan_next_expiration_ = expiration;
+    lifespan_scheduled_ = true;
+}
+
+void SubscriberImpl::lifespan_expired()
+{
+    std::lock_guard<std::recursive_timed_mutex> guard(mp_reader->getMutex());
+
+    if(lifespan_scheduled_)
+    {
+        Time_t now;
+        eClock clock;
+        clock.setTimeNow(&now);
+        purge_expired_changes(now);
+    }
+}
+
 } /* namespace fastrtps */
 } /* namespace eprosima */
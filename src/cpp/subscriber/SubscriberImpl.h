@@ -22,11 +22,15 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 #include <fastrtps/rtps/common/Locator.h>
 #include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/rtps/common/EntityStatistics.h>
 
 #include <fastrtps/attributes/SubscriberAttributes.h>
 #include <fastrtps/subscriber/SubscriberHistory.h>
 #include <fastrtps/rtps/reader/ReaderListener.h>
 
+#include <map>
+#include <mutex>
+
 
 namespace eprosima {
 namespace fastrtps {
@@ -41,6 +45,7 @@ class SubscriberListener;
 class ParticipantImpl;
 class SampleInfo_t;
 class Subscriber;
+class TimedCallback;
 
 /**
  * Class SubscriberImpl, contains the actual implementation of the behaviour of the Subscriber.
@@ -120,7 +125,59 @@ public:
 	 */
 	uint64_t getUnreadCount() const;
 
+    /**
+     * Get a snapshot of the counters of the associated RTPSReader.
+     * @return Copy of the counters.
+     */
+    rtps::ReaderStatistics get_statistics() const;
+
+    /**
+     * Update the lifespan timer with a change that has just been added to the history.
+     * Must be called with the reader mutex locked.
+     * @param change Pointer to the added change.
+     */
+    void lifespan_change_added(const rtps::CacheChange_t* change);
+
+    /**
+     * Get the lifespan of the samples sent by a matched writer.
+     * @param writer_guid GUID of the writer.
+     * @return Lifespan announced by the writer, or infinite if unknown.
+     */
+    rtps::Duration_t writer_lifespan(const rtps::GUID_t& writer_guid) const;
+
 private:
+
+    /**
+     * Remove the expired changes from the history if the earliest expiration time has been reached.
+     * Must be called with the reader mutex locked.
+     */
+    void remove_expired_changes();
+
+    /**
+     * Remove the expired changes from the history and reschedule the lifespan timer.
+     * Must be called with the reader mutex locked.
+     * @param now Current time.
+     */
+    void purge_expired_changes(const rtps::Time_t& now);
+
+    /**
+     * Schedule the lifespan timer to expire at the given time, unless it is already scheduled earlier.
+     * Must be called with the reader mutex locked.
+     * @param expiration Time when the first change in the history expires.
+     */
+    void schedule_lifespan_timer(const rtps::Time_t& expiration);
+
+    /**
+     * Method called when the lifespan timer expires.
+     */
+    void lifespan_expired();
+
+    /**
+     * Keep the lifespan announced by a writer while it is matched.
+     * @param info Matching information of the writer.
+     */
+    void update_writer_lifespan(const rtps::MatchingInfo& info);
+
 	//!Participant
 	ParticipantImpl* mp_participant;
 
@@ -147,6 +204,21 @@ private:
 	Subscriber* mp_userSubscriber;
 	//!RTPSParticipant
 	rtps::RTPSParticipant* mp_rtpsParticipant;
+
+    //! Timer used to remove the changes whose lifespan has expired.
+    TimedCallback* lifespan_timer_;
+
+    //! Expiration time the lifespan timer is scheduled for.
+    rtps::Time_t lifespan_next_expiration_;
+
+    //! Whether the lifespan timer is scheduled.
+    bool lifespan_scheduled_;
+
+    //! Lifespan of the matched writers with a finite one.
+    std::map<rtps::GUID_t, rtps::Duration_t> writer_lifespans_;
+
+    //! Protects writer_lifespans_, which is accessed from discovery and reception threads.
+    mutable std::mutex writer_lifespans_mutex_;
 };
 
 
@@ -0,0 +1,54 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimedCallback.cpp
+ *
+ */
+
+#include "TimedCallback.h"
+
+namespace eprosima {
+namespace fastrtps {
+
+TimedCallback::TimedCallback(
+        std::function<void()> callback,
+        double milliseconds,
+        asio::io_service& service,
+        const std::thread& event_thread)
+    : TimedEvent(service, event_thread, milliseconds)
+    , callback_(callback)
+{
+}
+
+TimedCallback::~TimedCallback()
+{
+    destroy();
+}
+
+void TimedCallback::event(
+        EventCode code,
+        const char* msg)
+{
+    // Unused in release mode.
+    (void)msg;
+
+    if (code == EVENT_SUCCESS)
+    {
+        callback_();
+    }
+}
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
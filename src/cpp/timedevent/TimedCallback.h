@@ -0,0 +1,75 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TimedCallback.h
+ *
+ */
+
+#ifndef _FASTRTPS_TIMEDEVENT_TIMEDCALLBACK_H_
+#define _FASTRTPS_TIMEDEVENT_TIMEDCALLBACK_H_
+#ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
+
+#include <fastrtps/rtps/resources/TimedEvent.h>
+
+#include <functional>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * TimedCallback class, a timed event that invokes a callback each time it expires successfully.
+ * @ingroup FASTRTPS_MODULE
+ */
+class TimedCallback : public rtps::TimedEvent
+{
+public:
+
+    /**
+     * Construct a TimedCallback event.
+     *
+     * @param callback Function to call when the event expires.
+     * @param milliseconds Event interval in milliseconds.
+     * @param service IO service to run the event.
+     * @param event_thread Thread of the IO service.
+     */
+    TimedCallback(
+            std::function<void()> callback,
+            double milliseconds,
+            asio::io_service& service,
+            const std::thread& event_thread);
+
+    virtual ~TimedCallback();
+
+    /**
+     * Method invoked when the event occurs
+     *
+     * @param code Code representing the status of the event
+     * @param msg Message associated to the event
+     */
+    void event(
+            EventCode code,
+            const char* msg = nullptr) override;
+
+private:
+
+    //! Function invoked on successful expiration
+    std::function<void()> callback_;
+};
+
+} /* namespace fastrtps */
+} /* namespace eprosima */
+
+#endif
+#endif /* _FASTRTPS_TIMEDEVENT_TIMEDCALLBACK_H_ */
@@ -47,6 +47,7 @@ TCPChannelResource::TCPChannelResource(
     , locator_(locator)
     , waiting_for_keep_alive_(false)
     , connection_status_(eConnectionStatus::eDisconnected)
+    , transport_priority_(0)
     , tcp_connection_type_(TCPConnectionType::TCP_CONNECT_TYPE)
 {
 }
@@ -59,6 +60,7 @@ TCPChannelResource::TCPChannelResource(
     , locator_()
     , waiting_for_keep_alive_(false)
     , connection_status_(eConnectionStatus::eDisconnected)
+    , transport_priority_(0)
     , tcp_connection_type_(TCPConnectionType::TCP_ACCEPT_TYPE)
 {
 }
@@ -68,6 +70,19 @@ TCPChannelResource::~TCPChannelResource()
     alive_ = false;
 }
 
+void TCPChannelResource::transport_priority(int32_t priority)
+{
+    int32_t current = transport_priority_.load();
+    while (priority > current)
+    {
+        if (transport_priority_.compare_exchange_weak(current, priority))
+        {
+            apply_transport_priority(priority);
+            break;
+        }
+    }
+}
+
 bool TCPChannelResource::disable()
 {
     disconnect();
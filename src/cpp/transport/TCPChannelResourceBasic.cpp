@@ -16,6 +16,7 @@
 #include <fastrtps/transport/TCPChannelResource.h>
 #include <fastrtps/transport/TCPTransportInterface.h>
 #include <fastrtps/utils/IPLocator.h>
+#include "TransportPriority.hpp"
 #include <fastrtps/utils/eClock.h>
 
 using namespace asio;
@@ -163,6 +164,24 @@ void TCPChannelResourceBasic::set_options(const TCPTransportDescriptor* options)
     socket_->set_option(socket_base::receive_buffer_size(options->receiveBufferSize));
     socket_->set_option(socket_base::send_buffer_size(options->sendBufferSize));
     socket_->set_option(ip::tcp::no_delay(options->enable_tcp_nodelay));
+
+    if (transport_priority_ > 0)
+    {
+        apply_transport_priority(transport_priority_);
+    }
+}
+
+void TCPChannelResourceBasic::apply_transport_priority(int32_t priority)
+{
+    if (socket_->is_open())
+    {
+        asio::error_code ec;
+        set_socket_transport_priority((*socket_), priority, ec);
+        if (ec)
+        {
+            logWarning(RTCP, "Cannot mark TCP connection with transport priority " << priority << ": " << ec.message());
+        }
+    }
 }
 
 void TCPChannelResourceBasic::cancel()
@@ -15,6 +15,7 @@
 #include <fastrtps/transport/TCPChannelResourceSecure.h>
 #include <fastrtps/transport/TCPTransportInterface.h>
 #include <fastrtps/utils/IPLocator.h>
+#include "TransportPriority.hpp"
 #include <fastrtps/utils/eClock.h>
 
 #include <future>
@@ -243,6 +244,24 @@ void TCPChannelResourceSecure::set_options(const TCPTransportDescriptor* options
     secure_socket_->lowest_layer().set_option(socket_base::receive_buffer_size(options->receiveBufferSize));
     secure_socket_->lowest_layer().set_option(socket_base::send_buffer_size(options->sendBufferSize));
     secure_socket_->lowest_layer().set_option(ip::tcp::no_delay(options->enable_tcp_nodelay));
+
+    if (transport_priority_ > 0)
+    {
+        apply_transport_priority(transport_priority_);
+    }
+}
+
+void TCPChannelResourceSecure::apply_transport_priority(int32_t priority)
+{
+    if (secure_socket_->lowest_layer().is_open())
+    {
+        asio::error_code ec;
+        set_socket_transport_priority(secure_socket_->lowest_layer(), priority, ec);
+        if (ec)
+        {
+            logWarning(RTCP, "Cannot mark TCP connection with transport priority " << priority << ": " << ec.message());
+        }
+    }
 }
 
 void TCPChannelResourceSecure::set_tls_verify_mode(const TCPTransportDescriptor* options)
@@ -42,8 +42,13 @@ class TCPSenderResource : public SenderResource
             send_lambda_ = [this, &transport] (
                     const octet* data,
                     uint32_t dataSize,
-                    const Locator_t& destination)-> bool
+                    const Locator_t& destination,
+                    int32_t transport_priority)-> bool
                 {
+                    if (transport_priority > 0)
+                    {
+                        channel_->transport_priority(transport_priority);
+                    }
                     return transport.send(data, dataSize, channel_, destination);
                 };
         }
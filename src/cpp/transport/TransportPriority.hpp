@@ -0,0 +1,88 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef __TRANSPORT_TRANSPORTPRIORITY_HPP__
+#define __TRANSPORT_TRANSPORTPRIORITY_HPP__
+
+#include <asio.hpp>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Maps the value of the TransportPriority QoS to a DSCP codepoint.
+ * Values are clamped to the 6 bits available, so applications can use the well known codepoints directly
+ * (i.e. 46 for Expedited Forwarding).
+ * @param transport_priority Value of the TransportPriority QoS.
+ * @return DSCP codepoint, 0 (best effort) for non-positive priorities.
+ */
+inline uint8_t transport_priority_to_dscp(int32_t transport_priority)
+{
+    if (transport_priority <= 0)
+    {
+        return 0;
+    }
+
+    return transport_priority > 63 ? 63 : static_cast<uint8_t>(transport_priority);
+}
+
+/**
+ * Marks all the traffic sent through a socket with the given transport priority.
+ * The DSCP field of the IP header is always set. On Linux the socket priority used by the queueing disciplines
+ * is also set from the class selector of the DSCP, bounded to the values allowed without CAP_NET_ADMIN.
+ * @param socket Socket already opened.
+ * @param transport_priority Value of the TransportPriority QoS.
+ * @param ec Error reported by the first option that could not be set.
+ */
+template<typename Socket>
+inline void set_socket_transport_priority(
+        Socket& socket,
+        int32_t transport_priority,
+        asio::error_code& ec)
+{
+    const int dscp = transport_priority_to_dscp(transport_priority);
+    const bool is_v6 = socket.local_endpoint(ec).address().is_v6();
+
+    if (ec)
+    {
+        return;
+    }
+
+    if (is_v6)
+    {
+#ifdef IPV6_TCLASS
+        socket.set_option(asio::detail::socket_option::integer<IPPROTO_IPV6, IPV6_TCLASS>(dscp << 2), ec);
+#endif
+    }
+    else
+    {
+        socket.set_option(asio::detail::socket_option::integer<IPPROTO_IP, IP_TOS>(dscp << 2), ec);
+    }
+
+#ifdef SO_PRIORITY
+    if (!ec)
+    {
+        const int priority = (dscp >> 3) > 6 ? 6 : (dscp >> 3);
+        socket.set_option(asio::detail::socket_option::integer<SOL_SOCKET, SO_PRIORITY>(priority), ec);
+    }
+#endif
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // __TRANSPORT_TRANSPORTPRIORITY_HPP__
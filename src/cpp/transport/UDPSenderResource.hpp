@@ -17,6 +17,10 @@
 
 #include <fastrtps/rtps/network/SenderResource.h>
 #include <fastrtps/transport/UDPTransportInterface.h>
+#include <fastrtps/log/Log.h>
+
+#include <map>
+#include <set>
 
 namespace eprosima {
 namespace fastrtps {
@@ -37,15 +41,37 @@ class UDPSenderResource : public SenderResource
             // Implementation functions are bound to the right transport parameters
             clean_up = [this, &transport]()
                 {
+                    for (auto& priority_socket : priority_sockets_)
+                    {
+                        transport.CloseOutputChannel(priority_socket.second);
+                    }
+                    priority_sockets_.clear();
                     transport.CloseOutputChannel(socket_);
                 };
 
             send_lambda_ = [this, &transport] (
                     const octet* data,
                     uint32_t dataSize,
-                    const Locator_t& destination)-> bool
+                    const Locator_t& destination,
+                    int32_t transport_priority)-> bool
                 {
-                    return transport.send(data, dataSize, socket_, destination, only_multicast_purpose_);
+                    eProsimaUDPSocket& socket = socket_for(transport, transport_priority, destination);
+                    if (transport.send(data, dataSize, socket, destination, only_multicast_purpose_))
+                    {
+                        return true;
+                    }
+
+                    if (&socket == &socket_ ||
+                            !transport.send(data, dataSize, socket_, destination, only_multicast_purpose_))
+                    {
+                        return false;
+                    }
+
+                    // Only the marked traffic is rejected on the way to this destination.
+                    logWarning(RTPS_MSG_OUT, "UDPTransport cannot send with transport priority " << transport_priority
+                            << " to " << destination << " (using default socket from now on)");
+                    unprioritized_locators_.insert(destination);
+                    return true;
                 };
         }
 
@@ -71,6 +97,48 @@ class UDPSenderResource : public SenderResource
 
     private:
 
+        /**
+         * Returns the socket used to send traffic with the given transport priority to a destination.
+         * Sockets marked with a transport priority are created the first time they are needed. The default socket
+         * is used for the priorities whose socket could not be opened and for the destinations that could not be
+         * reached through a marked socket. Callers are serialized by the participant's send resources mutex.
+         */
+        eProsimaUDPSocket& socket_for(
+                UDPTransportInterface& transport,
+                int32_t transport_priority,
+                const Locator_t& destination)
+        {
+            if (transport_priority <= 0 || unprioritized_locators_.count(destination) != 0)
+            {
+                return socket_;
+            }
+
+            auto it = priority_sockets_.find(transport_priority);
+            if (it == priority_sockets_.end())
+            {
+                if (failed_priorities_.count(transport_priority) != 0)
+                {
+                    return socket_;
+                }
+
+                try
+                {
+                    it = priority_sockets_.emplace(transport_priority,
+                            transport.OpenPriorityOutputSocket(socket_, transport_priority)).first;
+                }
+                catch (asio::system_error const& e)
+                {
+                    (void)e;
+                    logWarning(RTPS_MSG_OUT, "UDPTransport Error opening output socket for transport priority "
+                            << transport_priority << " (using default socket) with msg: " << e.what());
+                    failed_priorities_.insert(transport_priority);
+                    return socket_;
+                }
+            }
+
+            return it->second;
+        }
+
         UDPSenderResource() = delete;
 
         UDPSenderResource(const SenderResource&) = delete;
@@ -80,6 +148,15 @@ class UDPSenderResource : public SenderResource
         eProsimaUDPSocket socket_;
 
         bool only_multicast_purpose_;
+
+        //! Sockets marking their traffic with a transport priority, indexed by priority.
+        std::map<int32_t, eProsimaUDPSocket> priority_sockets_;
+
+        //! Priorities whose socket could not be opened.
+        std::set<int32_t> failed_priorities_;
+
+        //! Destinations only reachable through the default socket.
+        std::set<Locator_t> unprioritized_locators_;
 };
 
 } // namespace rtps
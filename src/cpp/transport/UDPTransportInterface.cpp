@@ -16,6 +16,8 @@
 #include <fastrtps/transport/UDPTransportInterface.h>
 #include <fastrtps/rtps/messages/CDRMessage.h>
 #include "UDPSenderResource.hpp"
+#include "TransportPriority.hpp"
+#include "../utils/Tracepoints.hpp"
 #include <utility>
 #include <cstring>
 #include <algorithm>
@@ -254,6 +256,44 @@ eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
     return socket;
 }
 
+eProsimaUDPSocket UDPTransportInterface::OpenPriorityOutputSocket(
+        eProsimaUDPSocket& socket,
+        int32_t transport_priority)
+{
+    ip::udp::endpoint local_endpoint = getSocketPtr(socket)->local_endpoint();
+    uint16_t port = 0;
+    eProsimaUDPSocket priority_socket =
+        OpenAndBindUnicastOutputSocket(ip::udp::endpoint(local_endpoint.address(), 0), port);
+
+    ip::multicast::enable_loopback loopback;
+    getSocketPtr(socket)->get_option(loopback);
+    getSocketPtr(priority_socket)->set_option(loopback);
+
+    if (local_endpoint.address().is_unspecified())
+    {
+        std::vector<IPFinder::info_IP> locNames;
+        get_ips(locNames);
+        if (!locNames.empty())
+        {
+            SetSocketOutboundInterface(priority_socket, (*locNames.begin()).name);
+        }
+    }
+    else
+    {
+        SetSocketOutboundInterface(priority_socket, local_endpoint.address().to_string());
+    }
+
+    asio::error_code ec;
+    set_socket_transport_priority(*getSocketPtr(priority_socket), transport_priority, ec);
+    if (ec)
+    {
+        logWarning(RTPS_MSG_OUT, "UDPTransport cannot mark traffic with transport priority " << transport_priority
+            << " (sending unmarked) with msg: " << ec.message());
+    }
+
+    return priority_socket;
+}
+
 bool UDPTransportInterface::OpenOutputChannel(
         SendResourceList& sender_resource_list,
         const Locator_t& locator)
@@ -413,6 +453,7 @@ bool UDPTransportInterface::Receive(UDPChannelResource* p_channel_resource, octe
                 return false;
             }
             endpoint_to_locator(senderEndpoint, remote_locator);
+            FASTRTPS_TRACE_UDP_RECEIVE(receive_buffer_size, remote_locator.port);
         }
         return (receive_buffer_size > 0);
     }
@@ -530,6 +571,7 @@ bool UDPTransportInterface::send(
         }
 
         (void)bytesSent;
+        FASTRTPS_TRACE_UDP_SEND(bytesSent, remote_locator.port);
         logInfo(RTPS_MSG_OUT, "UDPTransport: " << bytesSent << " bytes TO endpoint: " << destinationEndpoint
             << " FROM " << getSocketPtr(socket)->local_endpoint());
         success = true;
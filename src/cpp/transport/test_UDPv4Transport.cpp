@@ -34,7 +34,8 @@ test_UDPv4Transport::test_UDPv4Transport(const test_UDPv4TransportDescriptor& de
     drop_heartbeat_messages_percentage_(descriptor.dropHeartbeatMessagesPercentage),
     drop_ack_nack_messages_percentage_(descriptor.dropAckNackMessagesPercentage),
     sequence_number_data_messages_to_drop_(descriptor.sequenceNumberDataMessagesToDrop),
-    percentage_of_messages_to_drop_(descriptor.percentageOfMessagesToDrop)
+    percentage_of_messages_to_drop_(descriptor.percentageOfMessagesToDrop),
+    remove_info_timestamps_(descriptor.removeInfoTimestamps)
     {
         test_UDPv4Transport_DropLogLength = 0;
         test_UDPv4Transport_ShutdownAllNetwork = false;
@@ -56,6 +57,7 @@ test_UDPv4TransportDescriptor::test_UDPv4TransportDescriptor():
     dropAckNackMessagesPercentage(0),
     percentageOfMessagesToDrop(0),
     sequenceNumberDataMessagesToDrop(),
+    removeInfoTimestamps(false),
     dropLogLength(0)
     {
     }
@@ -77,6 +79,12 @@ bool test_UDPv4Transport::send(
         log_drop(send_buffer, send_buffer_size);
         return true;
     }
+    else if (remove_info_timestamps_)
+    {
+        std::vector<octet> message(send_buffer, send_buffer + send_buffer_size);
+        uint32_t size = remove_info_timestamps(message.data(), send_buffer_size);
+        return UDPv4Transport::send(message.data(), size, socket, remote_locator, only_multicast_purpose);
+    }
     else
     {
         return UDPv4Transport::send(send_buffer, send_buffer_size, socket, remote_locator, only_multicast_purpose);
@@ -212,6 +220,42 @@ bool test_UDPv4Transport::packet_should_drop(const octet* send_buffer, uint32_t
     return false;
 }
 
+uint32_t test_UDPv4Transport::remove_info_timestamps(octet* buffer, uint32_t size)
+{
+    CDRMessage_t cdrMessage(0);
+    cdrMessage.wraps = true;
+    cdrMessage.buffer = buffer;
+    cdrMessage.length = size;
+    cdrMessage.max_size = size;
+
+    if(size < RTPSMESSAGE_HEADER_SIZE || buffer[0] != 'R' || buffer[1] != 'T' || buffer[2] != 'P' || buffer[3] != 'S')
+        return size;
+
+    cdrMessage.pos = RTPSMESSAGE_HEADER_SIZE;
+    uint32_t new_size = RTPSMESSAGE_HEADER_SIZE;
+
+    SubmessageHeader_t cdrSubMessageHeader;
+    while (cdrMessage.pos < cdrMessage.length)
+    {
+        uint32_t submessage_begin = cdrMessage.pos;
+        if (!ReadSubmessageHeader(cdrMessage, cdrSubMessageHeader) ||
+                cdrMessage.pos + cdrSubMessageHeader.submessageLength > cdrMessage.length)
+            return size;
+
+        cdrMessage.pos += cdrSubMessageHeader.submessageLength;
+
+        // Submessages are moved over the removed ones.
+        if (cdrSubMessageHeader.submessageId != INFO_TS)
+        {
+            uint32_t length = cdrMessage.pos - submessage_begin;
+            memmove(&buffer[new_size], &buffer[submessage_begin], length);
+            new_size += length;
+        }
+    }
+
+    return new_size;
+}
+
 bool test_UDPv4Transport::log_drop(const octet* buffer, uint32_t size)
 {
     if (test_UDPv4Transport_DropLog.size() < test_UDPv4Transport_DropLogLength)
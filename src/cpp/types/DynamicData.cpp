@@ -5803,6 +5803,138 @@ void DynamicData::serializeKey(eprosima::fastcdr::Cdr &cdr) const
     }
 }
 
+template<typename T>
+static void extract_value(eprosima::fastcdr::Cdr &cdr, eprosima::fastcdr::Cdr &key, bool copy)
+{
+    T value;
+    cdr >> value;
+    if (copy)
+    {
+        key << value;
+    }
+}
+
+bool DynamicData::extractKey(const DynamicType_ptr type, eprosima::fastcdr::Cdr &cdr, eprosima::fastcdr::Cdr &key,
+    bool copy /*= false*/)
+{
+    // ALIAS types are deserialized as their base type.
+    if (type->GetKind() == TK_ALIAS)
+    {
+        return extractKey(type->GetBaseType(), cdr, key, copy);
+    }
+
+    // Like in serializeKey, structures look for the key in their members and any other type is part of the key,
+    // with all of its contents, when it is defined as key.
+    if (type->GetKind() != TK_STRUCTURE)
+    {
+        copy |= type->mIsKeyDefined;
+    }
+
+    switch (type->GetKind())
+    {
+    default:
+        break;
+    case TK_INT32:
+        extract_value<int32_t>(cdr, key, copy);
+        break;
+    case TK_UINT32:
+    case TK_ENUM:
+        extract_value<uint32_t>(cdr, key, copy);
+        break;
+    case TK_INT16:
+        extract_value<int16_t>(cdr, key, copy);
+        break;
+    case TK_UINT16:
+        extract_value<uint16_t>(cdr, key, copy);
+        break;
+    case TK_INT64:
+        extract_value<int64_t>(cdr, key, copy);
+        break;
+    case TK_UINT64:
+    case TK_BITSET:
+    case TK_BITMASK:
+        extract_value<uint64_t>(cdr, key, copy);
+        break;
+    case TK_FLOAT32:
+        extract_value<float>(cdr, key, copy);
+        break;
+    case TK_FLOAT64:
+        extract_value<double>(cdr, key, copy);
+        break;
+    case TK_FLOAT128:
+        extract_value<long double>(cdr, key, copy);
+        break;
+    case TK_CHAR8:
+        extract_value<char>(cdr, key, copy);
+        break;
+    case TK_CHAR16:
+        extract_value<wchar_t>(cdr, key, copy);
+        break;
+    case TK_BOOLEAN:
+        extract_value<bool>(cdr, key, copy);
+        break;
+    case TK_BYTE:
+        extract_value<octet>(cdr, key, copy);
+        break;
+    case TK_STRING8:
+        extract_value<std::string>(cdr, key, copy);
+        break;
+    case TK_STRING16:
+        extract_value<std::wstring>(cdr, key, copy);
+        break;
+    case TK_UNION:
+        // The member of a union depends on its discriminator labels, which are only resolved by a DynamicData.
+        return false;
+    case TK_STRUCTURE:
+    {
+        for (auto it = type->mMemberById.begin(); it != type->mMemberById.end(); ++it)
+        {
+            if (!extractKey(it->second->mDescriptor.mType, cdr, key, copy))
+            {
+                return false;
+            }
+        }
+        break;
+    }
+    case TK_ARRAY:
+    {
+        uint32_t size(type->GetTotalBounds());
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            if (!extractKey(type->GetElementType(), cdr, key, copy))
+            {
+                return false;
+            }
+        }
+        break;
+    }
+    case TK_SEQUENCE:
+    case TK_MAP:
+    {
+        uint32_t size(0);
+        cdr >> size;
+        if (copy)
+        {
+            key << size;
+        }
+
+        for (uint32_t i = 0; i < size; ++i)
+        {
+            if (type->GetKind() == TK_MAP && !extractKey(type->GetKeyElementType(), cdr, key, copy))
+            {
+                return false;
+            }
+            if (!extractKey(type->GetElementType(), cdr, key, copy))
+            {
+                return false;
+            }
+        }
+        break;
+    }
+    }
+    return true;
+}
+
 size_t DynamicData::getEmptyCdrSerializedSize(const DynamicType* type, size_t current_alignment /*= 0*/)
 {
     size_t initial_alignment = current_alignment;
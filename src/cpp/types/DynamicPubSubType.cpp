@@ -19,6 +19,7 @@
 #include <fastrtps/types/DynamicData.h>
 #include <fastrtps/log/Log.h>
 #include <fastcdr/Cdr.h>
+#include <fastcdr/exceptions/Exception.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -133,10 +134,56 @@ bool DynamicPubSubType::getKey(void* data, eprosima::fastrtps::rtps::InstanceHan
     eprosima::fastcdr::FastBuffer fastbuffer((char*)m_keyBuffer, keyBufferSize);
     eprosima::fastcdr::Cdr ser(fastbuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the data.
     pDynamicData->serializeKey(ser);
+    ComputeKeyHash(keyBufferSize, ser.getSerializedDataLength(), handle, force_md5);
+    return true;
+}
+
+bool DynamicPubSubType::getKeyFromPayload(eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+    eprosima::fastrtps::rtps::InstanceHandle_t* handle, bool force_md5)
+{
+    if (mDynamicType == nullptr || !m_isGetKeyDefined)
+    {
+        return false;
+    }
+    size_t keyBufferSize = static_cast<uint32_t>(DynamicData::getKeyMaxCdrSerializedSize(mDynamicType));
+
+    if (m_keyBuffer == nullptr)
+    {
+        m_keyBuffer = (unsigned char*)malloc(keyBufferSize > 16 ? keyBufferSize : 16);
+        memset(m_keyBuffer, 0, keyBufferSize > 16 ? keyBufferSize : 16);
+    }
+
+    eprosima::fastcdr::FastBuffer fastbuffer((char*)payload->data, payload->length); // Object that manages the raw buffer.
+    eprosima::fastcdr::Cdr deser(fastbuffer, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN,
+        eprosima::fastcdr::Cdr::DDS_CDR); // Object that deserializes the data.
+    eprosima::fastcdr::FastBuffer keybuffer((char*)m_keyBuffer, keyBufferSize);
+    eprosima::fastcdr::Cdr ser(keybuffer, eprosima::fastcdr::Cdr::BIG_ENDIANNESS);     // Object that serializes the key.
+
+    try
+    {
+        deser.read_encapsulation();
+        // The members of the sample are only read, and the ones of the key copied, on their way to the key.
+        if (!DynamicData::extractKey(mDynamicType, deser, ser))
+        {
+            return false;
+        }
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        return false;
+    }
+
+    ComputeKeyHash(keyBufferSize, ser.getSerializedDataLength(), handle, force_md5);
+    return true;
+}
+
+void DynamicPubSubType::ComputeKeyHash(size_t keyBufferSize, size_t keyLength,
+    eprosima::fastrtps::rtps::InstanceHandle_t* handle, bool force_md5)
+{
     if (force_md5 || keyBufferSize > 16)
     {
         m_md5.init();
-        m_md5.update(m_keyBuffer, (unsigned int)ser.getSerializedDataLength());
+        m_md5.update(m_keyBuffer, (unsigned int)keyLength);
         m_md5.finalize();
         for (uint8_t i = 0; i < 16; ++i)
         {
@@ -150,7 +197,6 @@ bool DynamicPubSubType::getKey(void* data, eprosima::fastrtps::rtps::InstanceHan
             handle->value[i] = m_keyBuffer[i];
         }
     }
-    return true;
 }
 
 std::function<uint32_t()> DynamicPubSubType::getSerializedSizeProvider(void* data)
@@ -188,12 +188,13 @@ ResponseCode DynamicType::CopyFromBuilder(const DynamicTypeBuilder* other)
             AnnotationDescriptor* newDescriptor = new AnnotationDescriptor(*it);
             mAnnotation.push_back(newDescriptor);
         }
+        mIsKeyDefined = GetKeyAnnotation();
 
         for (auto it = other->mMemberById.begin(); it != other->mMemberById.end(); ++it)
         {
             DynamicTypeMember* newMember = new DynamicTypeMember(it->second);
             newMember->SetParent(this);
-            mIsKeyDefined = newMember->GetKeyAnnotation();
+            mIsKeyDefined |= newMember->GetKeyAnnotation();
             mMemberById.insert(std::make_pair(newMember->GetId(), newMember));
             mMemberByName.insert(std::make_pair(newMember->GetName(), newMember));
         }
@@ -104,6 +104,117 @@ bool StringMatching::matchString(const char* str1, const char* str2)
 
 #endif
 
+const size_t StringMatchingIndex::npos;
+
+/*
+ * Only the fnmatch implementation is compiled into literal and prefix expressions. The other ones have a
+ * different syntax or are case insensitive, so every expression is evaluated with matchString.
+ */
+#if defined(_WIN32)
+static bool has_wildcards(const std::string&)
+{
+    return true;
+}
+
+static bool is_prefix_expression(const std::string&)
+{
+    return false;
+}
+#else
+static bool has_wildcards(const std::string& str)
+{
+    return str.find_first_of("*?[") != std::string::npos;
+}
+
+static bool is_prefix_expression(const std::string& str)
+{
+    return !str.empty() && str.find_first_of("*?[") == str.size() - 1 && str.back() == '*';
+}
+#endif
+
+void StringMatchingIndex::add(const std::string& expression, size_t position)
+{
+    expressions_.emplace_back(expression, position);
+
+    if (!has_wildcards(expression))
+    {
+        literals_.emplace(expression, position);
+    }
+    else if (is_prefix_expression(expression))
+    {
+        std::string prefix = expression.substr(0, expression.size() - 1);
+        prefixes_[prefix.size()].emplace(std::move(prefix), position);
+    }
+    else
+    {
+        wildcards_.emplace_back(expression, position);
+    }
+}
+
+size_t StringMatchingIndex::find_first(const char* input) const
+{
+    const std::string str(input);
+
+    if (has_wildcards(str))
+    {
+        for (const auto& expression : expressions_)
+        {
+            if (StringMatching::matchString(expression.first.c_str(), input))
+            {
+                return expression.second;
+            }
+        }
+
+        return npos;
+    }
+
+    size_t returned_value = npos;
+
+    auto literal = literals_.find(str);
+    if (literal != literals_.end())
+    {
+        returned_value = literal->second;
+    }
+
+    for (const auto& length : prefixes_)
+    {
+        if (length.first > str.size())
+        {
+            break;
+        }
+
+        auto prefix = length.second.find(str.substr(0, length.first));
+        if (prefix != length.second.end() && prefix->second < returned_value)
+        {
+            returned_value = prefix->second;
+        }
+    }
+
+    for (const auto& expression : wildcards_)
+    {
+        if (expression.second >= returned_value)
+        {
+            break;
+        }
+
+        if (StringMatching::matchString(expression.first.c_str(), input))
+        {
+            returned_value = expression.second;
+            break;
+        }
+    }
+
+    return returned_value;
+}
+
+void StringMatchingIndex::clear()
+{
+    literals_.clear();
+    prefixes_.clear();
+    wildcards_.clear();
+    expressions_.clear();
+}
+
 }
 } /* namespace rtps */
 } /* namespace eprosima */
@@ -0,0 +1,139 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Tracepoints.hpp
+ *
+ * Static tracepoints of the data path, under the provider "fastrtps".
+ * They are only emitted when the library is built with the TRACEPOINTS option. Otherwise the macros expand to
+ * nothing and their arguments are not evaluated.
+ *
+ * GUIDs are passed as two 64 bit integers with the bytes of the GUID in network order: the first eight bytes of
+ * the prefix, and the last four bytes of the prefix followed by the entity id. Sequence numbers are passed as
+ * 64 bit integers.
+ */
+
+#ifndef FASTRTPS_UTILS_TRACEPOINTS_HPP_
+#define FASTRTPS_UTILS_TRACEPOINTS_HPP_
+
+#include <fastrtps/config.h>
+
+#if HAVE_TRACEPOINTS
+
+#include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/rtps/common/SequenceNumber.h>
+
+#include <sys/sdt.h>
+#include <cstdint>
+
+namespace eprosima{
+namespace fastrtps{
+namespace rtps{
+namespace tracepoints{
+
+inline uint64_t guid_high(const GUID_t& guid)
+{
+    uint64_t value = 0;
+    for(uint8_t i = 0; i < 8; ++i)
+    {
+        value = (value << 8) | guid.guidPrefix.value[i];
+    }
+    return value;
+}
+
+inline uint64_t guid_low(const GUID_t& guid)
+{
+    uint64_t value = 0;
+    for(uint8_t i = 8; i < 12; ++i)
+    {
+        value = (value << 8) | guid.guidPrefix.value[i];
+    }
+    for(uint8_t i = 0; i < 4; ++i)
+    {
+        value = (value << 8) | guid.entityId.value[i];
+    }
+    return value;
+}
+
+inline uint64_t sequence(const SequenceNumber_t& seq)
+{
+    return seq.to64long();
+}
+
+} // namespace tracepoints
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#define FASTRTPS_TRACE_GUID_HIGH_(guid) ::eprosima::fastrtps::rtps::tracepoints::guid_high(guid)
+#define FASTRTPS_TRACE_GUID_LOW_(guid) ::eprosima::fastrtps::rtps::tracepoints::guid_low(guid)
+#define FASTRTPS_TRACE_SEQ_(seq) ::eprosima::fastrtps::rtps::tracepoints::sequence(seq)
+
+//! A user sample starts being written by the publisher.
+#define FASTRTPS_TRACE_WRITE_BEGIN(writer) \
+    DTRACE_PROBE2(fastrtps, write_begin, FASTRTPS_TRACE_GUID_HIGH_(writer), FASTRTPS_TRACE_GUID_LOW_(writer))
+
+//! The write of the sample finished. seq is its sequence number in the writer history, or 0 if it was not added.
+#define FASTRTPS_TRACE_WRITE_END(writer, seq) \
+    DTRACE_PROBE3(fastrtps, write_end, FASTRTPS_TRACE_GUID_HIGH_(writer), FASTRTPS_TRACE_GUID_LOW_(writer), \
+            FASTRTPS_TRACE_SEQ_(seq))
+
+//! An RTPS message of an endpoint is going to be sent. first_seq and last_seq delimit its DATA submessages (0 if none).
+#define FASTRTPS_TRACE_MESSAGE_SEND(endpoint, first_seq, last_seq, bytes, destinations) \
+    DTRACE_PROBE6(fastrtps, message_send, FASTRTPS_TRACE_GUID_HIGH_(endpoint), FASTRTPS_TRACE_GUID_LOW_(endpoint), \
+            (uint64_t)(first_seq), (uint64_t)(last_seq), (uint32_t)(bytes), (uint32_t)(destinations))
+
+//! A datagram was sent through an UDP socket.
+#define FASTRTPS_TRACE_UDP_SEND(bytes, port) \
+    DTRACE_PROBE2(fastrtps, udp_send, (uint32_t)(bytes), (uint32_t)(port))
+
+//! A datagram was received from an UDP socket.
+#define FASTRTPS_TRACE_UDP_RECEIVE(bytes, port) \
+    DTRACE_PROBE2(fastrtps, udp_receive, (uint32_t)(bytes), (uint32_t)(port))
+
+//! A DATA submessage was parsed by the message receiver.
+#define FASTRTPS_TRACE_DATA_RECEIVED(writer, seq, bytes) \
+    DTRACE_PROBE4(fastrtps, data_received, FASTRTPS_TRACE_GUID_HIGH_(writer), FASTRTPS_TRACE_GUID_LOW_(writer), \
+            FASTRTPS_TRACE_SEQ_(seq), (uint32_t)(bytes))
+
+//! A change reached the history of a subscriber.
+#define FASTRTPS_TRACE_HISTORY_RECEIVED(reader, writer, seq) \
+    DTRACE_PROBE5(fastrtps, history_received, FASTRTPS_TRACE_GUID_HIGH_(reader), FASTRTPS_TRACE_GUID_LOW_(reader), \
+            FASTRTPS_TRACE_GUID_HIGH_(writer), FASTRTPS_TRACE_GUID_LOW_(writer), FASTRTPS_TRACE_SEQ_(seq))
+
+//! The onNewDataMessage callback of a subscriber listener is called for a change.
+#define FASTRTPS_TRACE_LISTENER_BEGIN(reader, writer, seq) \
+    DTRACE_PROBE5(fastrtps, listener_begin, FASTRTPS_TRACE_GUID_HIGH_(reader), FASTRTPS_TRACE_GUID_LOW_(reader), \
+            FASTRTPS_TRACE_GUID_HIGH_(writer), FASTRTPS_TRACE_GUID_LOW_(writer), FASTRTPS_TRACE_SEQ_(seq))
+
+//! The onNewDataMessage callback of a subscriber listener returned.
+#define FASTRTPS_TRACE_LISTENER_END(reader, writer, seq) \
+    DTRACE_PROBE5(fastrtps, listener_end, FASTRTPS_TRACE_GUID_HIGH_(reader), FASTRTPS_TRACE_GUID_LOW_(reader), \
+            FASTRTPS_TRACE_GUID_HIGH_(writer), FASTRTPS_TRACE_GUID_LOW_(writer), FASTRTPS_TRACE_SEQ_(seq))
+
+#else
+
+#define FASTRTPS_TRACE_WRITE_BEGIN(writer)
+#define FASTRTPS_TRACE_WRITE_END(writer, seq)
+#define FASTRTPS_TRACE_MESSAGE_SEND(endpoint, first_seq, last_seq, bytes, destinations)
+#define FASTRTPS_TRACE_UDP_SEND(bytes, port)
+#define FASTRTPS_TRACE_UDP_RECEIVE(bytes, port)
+#define FASTRTPS_TRACE_DATA_RECEIVED(writer, seq, bytes)
+#define FASTRTPS_TRACE_HISTORY_RECEIVED(reader, writer, seq)
+#define FASTRTPS_TRACE_LISTENER_BEGIN(reader, writer, seq)
+#define FASTRTPS_TRACE_LISTENER_END(reader, writer, seq)
+
+#endif // HAVE_TRACEPOINTS
+
+#endif // FASTRTPS_UTILS_TRACEPOINTS_HPP_
@@ -43,6 +43,8 @@ XMLP_ret XMLParser::getXMLBuiltinAttributes(tinyxml2::XMLElement *elem, BuiltinA
                 <xs:element name="readerHistoryMemoryPolicy" type="historyMemoryPolicyType" minOccurs="0"/>
                 <xs:element name="writerHistoryMemoryPolicy" type="historyMemoryPolicyType" minOccurs="0"/>
                 <xs:element name="mutation_tries" type="uint32Type" minOccurs="0"/>
+                <xs:element name="discoveryProtocol" type="discoveryProtocolType" minOccurs="0"/>
+                <xs:element name="discoveryServersList" type="locatorListType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -183,6 +185,47 @@ XMLP_ret XMLParser::getXMLBuiltinAttributes(tinyxml2::XMLElement *elem, BuiltinA
             if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &builtin.mutation_tries, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, DISCOVERY_PROTOCOL) == 0)
+        {
+            /*
+                <xs:simpleType name="discoveryProtocolType">
+                    <xs:restriction base="xs:string">
+                        <xs:enumeration value="SIMPLE"/>
+                        <xs:enumeration value="CLIENT"/>
+                        <xs:enumeration value="SERVER"/>
+                    </xs:restriction>
+                </xs:simpleType>
+            */
+            const char* text = p_aux0->GetText();
+            if (nullptr == text)
+            {
+                logError(XMLPARSER, "Node '" << DISCOVERY_PROTOCOL << "' without content");
+                return XMLP_ret::XML_ERROR;
+            }
+            else if (strcmp(text, SIMPLE) == 0)
+            {
+                builtin.discoveryProtocol = DiscoveryProtocol_t::SIMPLE;
+            }
+            else if (strcmp(text, DISCOVERY_CLIENT) == 0)
+            {
+                builtin.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+            }
+            else if (strcmp(text, DISCOVERY_SERVER) == 0)
+            {
+                builtin.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+            }
+            else
+            {
+                logError(XMLPARSER, "Node '" << DISCOVERY_PROTOCOL << "' with bad content");
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, DISCOVERY_SERVERS_LIST) == 0)
+        {
+            // discoveryServersList
+            if (XMLP_ret::XML_OK != getXMLLocatorList(p_aux0, builtin.discoveryServersList, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'builtinAttributesType'. Name: " << name);
@@ -350,6 +393,47 @@ XMLP_ret XMLParser::getXMLThroughputController(tinyxml2::XMLElement *elem,
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLFlowScheduling(tinyxml2::XMLElement *elem,
+                                         FlowSchedulingDescriptor &flowScheduling,
+                                         uint8_t ident)
+{
+    /*
+        <xs:complexType name="flowSchedulingType">
+            <xs:all minOccurs="0">
+                <xs:element name="weight" type="uint32Type" minOccurs="0"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+    */
+
+    tinyxml2::XMLElement *p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, WEIGHT) == 0)
+        {
+            // weight - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &flowScheduling.weight, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            int priority = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &priority, ident))
+                return XMLP_ret::XML_ERROR;
+            flowScheduling.priority = static_cast<int32_t>(priority);
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'flowSchedulingType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLTopicAttributes(tinyxml2::XMLElement *elem, TopicAttributes &topic, uint8_t ident)
 {
     /*
@@ -642,6 +726,7 @@ XMLP_ret XMLParser::getXMLWriterQosPolicies(tinyxml2::XMLElement *elem, WriterQo
                 <xs:element name="topicData" type="topicDataQosPolicyType" minOccurs="0"/>
                 <xs:element name="groupData" type="groupDataQosPolicyType" minOccurs="0"/>
                 <xs:element name="publishMode" type="publishModeQosPolicyType" minOccurs="0"/>
+                <xs:element name="transportPriority" type="transportPriorityQosPolicyType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
     */
@@ -675,14 +760,31 @@ XMLP_ret XMLParser::getXMLWriterQosPolicies(tinyxml2::XMLElement *elem, WriterQo
             if (XMLP_ret::XML_OK != getXMLPartitionQos(p_aux0, qos.m_partition, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, LIFESPAN) == 0)
+        {
+            // lifespan
+            if (XMLP_ret::XML_OK != getXMLLifespanQos(p_aux0, qos.m_lifespan, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, LATENCY_BUDGET) == 0)
+        {
+            // latencyBudget
+            if (XMLP_ret::XML_OK != getXMLLatencyBudgetQos(p_aux0, qos.m_latencyBudget, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, PUB_MODE) == 0)
         {
             // publishMode
             if (XMLP_ret::XML_OK != getXMLPublishModeQos(p_aux0, qos.m_publishMode, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, TRANSPORT_PRIORITY) == 0)
+        {
+            // transportPriority
+            if (XMLP_ret::XML_OK != getXMLTransportPriorityQos(p_aux0, qos.m_transportPriority, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, DURABILITY_SRV) == 0 || strcmp(name, DEADLINE) == 0 ||
-            strcmp(name, LATENCY_BUDGET) == 0 || strcmp(name, LIFESPAN) == 0 ||
             strcmp(name, USER_DATA) == 0 || strcmp(name, TIME_FILTER) == 0 ||
             strcmp(name, OWNERSHIP) == 0 || strcmp(name, OWNERSHIP_STRENGTH) == 0 ||
             strcmp(name, DEST_ORDER) == 0 || strcmp(name, PRESENTATION) == 0 ||
@@ -691,8 +793,6 @@ XMLP_ret XMLParser::getXMLWriterQosPolicies(tinyxml2::XMLElement *elem, WriterQo
             // TODO: Do not supported for now
             //if (nullptr != (p_aux = elem->FirstChildElement(    DURABILITY_SRV))) getXMLDurabilityServiceQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(          DEADLINE))) getXMLDeadlineQos(p_aux, ident);
-            //if (nullptr != (p_aux = elem->FirstChildElement(    LATENCY_BUDGET))) getXMLLatencyBudgetQos(p_aux, ident);
-            //if (nullptr != (p_aux = elem->FirstChildElement(          LIFESPAN))) getXMLLifespanQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(         USER_DATA))) getXMLUserDataQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(       TIME_FILTER))) getXMLTimeBasedFilterQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(         OWNERSHIP))) getXMLOwnershipQos(p_aux, ident);
@@ -765,9 +865,14 @@ XMLP_ret XMLParser::getXMLReaderQosPolicies(tinyxml2::XMLElement *elem, ReaderQo
             if (XMLP_ret::XML_OK != getXMLPartitionQos(p_aux0, qos.m_partition, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, LIFESPAN) == 0)
+        {
+            // lifespan
+            if (XMLP_ret::XML_OK != getXMLLifespanQos(p_aux0, qos.m_lifespan, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, DURABILITY_SRV) == 0 || strcmp(name, DEADLINE) == 0 ||
-            strcmp(name, LATENCY_BUDGET) == 0 || strcmp(name, LIFESPAN) == 0 ||
-            strcmp(name, USER_DATA) == 0 || strcmp(name, TIME_FILTER) == 0 ||
+            strcmp(name, LATENCY_BUDGET) == 0 || strcmp(name, USER_DATA) == 0 || strcmp(name, TIME_FILTER) == 0 ||
             strcmp(name, OWNERSHIP) == 0 || strcmp(name, OWNERSHIP_STRENGTH) == 0 ||
             strcmp(name, DEST_ORDER) == 0 || strcmp(name, PRESENTATION) == 0 ||
             strcmp(name, TOPIC_DATA) == 0 || strcmp(name, GROUP_DATA) == 0)
@@ -776,7 +881,6 @@ XMLP_ret XMLParser::getXMLReaderQosPolicies(tinyxml2::XMLElement *elem, ReaderQo
             //if (nullptr != (p_aux = elem->FirstChildElement(    DURABILITY_SRV))) getXMLDurabilityServiceQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(          DEADLINE))) getXMLDeadlineQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(    LATENCY_BUDGET))) getXMLLatencyBudgetQos(p_aux, ident);
-            //if (nullptr != (p_aux = elem->FirstChildElement(          LIFESPAN))) getXMLLifespanQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(         USER_DATA))) getXMLUserDataQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(       TIME_FILTER))) getXMLTimeBasedFilterQos(p_aux, ident);
             //if (nullptr != (p_aux = elem->FirstChildElement(         OWNERSHIP))) getXMLOwnershipQos(p_aux, ident);
@@ -1022,6 +1126,46 @@ XMLP_ret XMLParser::getXMLLatencyBudgetQos(tinyxml2::XMLElement *elem, LatencyBu
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLTransportPriorityQos(
+        tinyxml2::XMLElement *elem,
+        TransportPriorityQosPolicy &transportPriority,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="transportPriorityQosPolicyType">
+            <xs:all>
+                <xs:element name="value" type="uint32Type"/>
+            </xs:all>
+        </xs:complexType>
+    */
+
+    tinyxml2::XMLElement *p_aux0 = nullptr;
+    const char* name = nullptr;
+    bool bValueDefined = false;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, VALUE) == 0)
+        {
+            bValueDefined = true;
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &transportPriority.value, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'transportPriorityQosPolicyType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    if (!bValueDefined)
+    {
+        logError(XMLPARSER, "Node 'transportPriorityQosPolicyType' without content");
+        return XMLP_ret::XML_ERROR;
+    }
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLLivelinessQos(tinyxml2::XMLElement *elem, LivelinessQosPolicy &liveliness, uint8_t ident)
 {
     /*
@@ -1999,6 +2143,7 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
                 <xs:enumeration value="PREALLOCATED"/>
                 <xs:enumeration value="PREALLOCATED_WITH_REALLOC"/>
                 <xs:enumeration value="DYNAMIC"/>
+                <xs:enumeration value="DYNAMIC_REUSABLE"/>
             </xs:restriction>
         </xs:simpleType>
     */
@@ -2014,6 +2159,8 @@ XMLP_ret XMLParser::getXMLHistoryMemoryPolicy(tinyxml2::XMLElement *elem,
         historyMemoryPolicy = MemoryManagementPolicy::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
     else if (strcmp(text, DYNAMIC) == 0)
         historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_RESERVE_MEMORY_MODE;
+    else if (strcmp(text, DYNAMIC_REUSABLE) == 0)
+        historyMemoryPolicy = MemoryManagementPolicy::DYNAMIC_REUSABLE_MEMORY_MODE;
     else
     {
         logError(XMLPARSER, "Node '" << KIND << "' bad content");
@@ -2260,6 +2260,8 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Parti
                 <xs:element name="throughputController" type="throughputControllerType" minOccurs="0"/>
                 <xs:element name="userTransports" type="stringListType" minOccurs="0"/>
                 <xs:element name="useBuiltinTransports" type="boolType" minOccurs="0"/>
+                <xs:element name="sharedEventThreads" type="uint32Type" minOccurs="0"/>
+                <xs:element name="submessageBatchingWindow" type="durationType" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="name" type="stringType" minOccurs="0"/>
             </xs:all>
@@ -2356,6 +2358,19 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Parti
             if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &participant_node.get()->rtps.useBuiltinTransports, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, SHARED_EVENT_THREADS) == 0)
+        {
+            // sharedEventThreads - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &participant_node.get()->rtps.sharedEventThreads, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, SUBMESSAGE_BATCHING_WINDOW) == 0)
+        {
+            // submessageBatchingWindow - durationType
+            if (XMLP_ret::XML_OK !=
+                getXMLDuration(p_aux0, participant_node.get()->rtps.submessageBatchingWindow, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, PROPERTIES_POLICY) == 0)
         {
             // propertiesPolicy
@@ -2390,6 +2405,8 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Publi
                 <xs:element name="unicastLocatorList" type="locatorListType" minOccurs="0"/>
                 <xs:element name="multicastLocatorList" type="locatorListType" minOccurs="0"/>
                 <xs:element name="throughputController" type="throughputControllerType" minOccurs="0"/>
+                <xs:element name="flowScheduling" type="flowSchedulingType" minOccurs="0"/>
+                <xs:element name="sendKeyHash" type="boolType" minOccurs="0"/>
                 <xs:element name="historyMemoryPolicy" type="historyMemoryPolicyType" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="userDefinedID" type="int16Type" minOccurs="0"/>
@@ -2456,6 +2473,18 @@ XMLP_ret XMLParser::fillDataNode(tinyxml2::XMLElement* p_profile, DataNode<Publi
                 getXMLThroughputController(p_aux0, publisher_node.get()->throughputController, ident))
                 return XMLP_ret::XML_ERROR;
         }
+        else if (strcmp(name, FLOW_SCHEDULING) == 0)
+        {
+            // flowScheduling
+            if (XMLP_ret::XML_OK != getXMLFlowScheduling(p_aux0, publisher_node.get()->flowScheduling, ident))
+                return XMLP_ret::XML_ERROR;
+        }
+        else if (strcmp(name, SEND_KEY_HASH) == 0)
+        {
+            // sendKeyHash - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &publisher_node.get()->sendKeyHash, ident))
+                return XMLP_ret::XML_ERROR;
+        }
         else if (strcmp(name, HIST_MEM_POLICY) == 0)
         {
             // historyMemoryPolicy
@@ -76,6 +76,8 @@ const char* PART_ID = "participantID";
 const char* THROUGHPUT_CONT = "throughputController";
 const char* USER_TRANS = "userTransports";
 const char* USE_BUILTIN_TRANS = "useBuiltinTransports";
+const char* SHARED_EVENT_THREADS = "sharedEventThreads";
+const char* SUBMESSAGE_BATCHING_WINDOW = "submessageBatchingWindow";
 const char* PROPERTIES_POLICY = "propertiesPolicy";
 const char* NAME = "name";
 
@@ -89,6 +91,8 @@ const char* REM_LOC_LIST = "remoteLocatorList";
 //const char* THROUGHPUT_CONT = "throughputController";
 const char* EXP_INLINE_QOS = "expectsInlineQos";
 const char* HIST_MEM_POLICY = "historyMemoryPolicy";
+const char* FLOW_SCHEDULING = "flowScheduling";
+const char* SEND_KEY_HASH = "sendKeyHash";
 //const char* PROPERTIES_POLICY = "propertiesPolicy";
 const char* USER_DEF_ID = "userDefinedID";
 const char* ENTITY_ID = "entityID";
@@ -103,6 +107,7 @@ const char* PROPAGATE = "propagate";
 const char* PREALLOCATED = "PREALLOCATED";
 const char* PREALLOCATED_WITH_REALLOC = "PREALLOCATED_WITH_REALLOC";
 const char* DYNAMIC = "DYNAMIC";
+const char* DYNAMIC_REUSABLE = "DYNAMIC_REUSABLE";
 const char* LOCATOR = "locator";
 const char* UDPv4_LOCATOR = "udpv4";
 const char* UDPv6_LOCATOR = "udpv6";
@@ -150,6 +155,7 @@ const char* PARTITION = "partition";
 const char* TOPIC_DATA = "topicData";
 const char* GROUP_DATA = "groupData";
 const char* PUB_MODE = "publishMode";
+const char* TRANSPORT_PRIORITY = "transportPriority";
 
 const char* SYNCHRONOUS = "SYNCHRONOUS";
 const char* ASYNCHRONOUS = "ASYNCHRONOUS";
@@ -192,6 +198,8 @@ const char* DEPTH = "depth";
 const char* ALLOCATED_SAMPLES = "allocated_samples";
 const char* BYTES_PER_SECOND = "bytesPerPeriod";
 const char* PERIOD_MILLISECS = "periodMillisecs";
+const char* WEIGHT = "weight";
+const char* PRIORITY = "priority";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
@@ -217,6 +225,10 @@ const char* STATIC_ENDPOINT_XML = "staticEndpointXMLFilename";
 const char* READER_HIST_MEM_POLICY = "readerHistoryMemoryPolicy";
 const char* WRITER_HIST_MEM_POLICY = "writerHistoryMemoryPolicy";
 const char* MUTATION_TRIES = "mutation_tries";
+const char* DISCOVERY_PROTOCOL = "discoveryProtocol";
+const char* DISCOVERY_SERVERS_LIST = "discoveryServersList";
+const char* DISCOVERY_CLIENT = "CLIENT";
+const char* DISCOVERY_SERVER = "SERVER";
 const char* ACCESS_SCOPE = "access_scope";
 
 // Endpoint parser
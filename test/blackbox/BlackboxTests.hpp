@@ -21,6 +21,9 @@
 #elif defined(DYNAMIC_RESERVE_MEMORY_MODE_TEST)
 #define MEMORY_MODE_STRING DynMem
 #define MEMORY_MODE_BYTE 2
+#elif defined(DYNAMIC_REUSABLE_MEMORY_MODE_TEST)
+#define MEMORY_MODE_STRING DynReusableMem
+#define MEMORY_MODE_BYTE 4
 #else
 #define MEMORY_MODE_STRING PreallocMem
 #define MEMORY_MODE_BYTE 3
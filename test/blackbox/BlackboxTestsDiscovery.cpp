@@ -18,6 +18,13 @@
 #include "PubSubWriter.hpp"
 
 #include <fastrtps/transport/test_UDPv4Transport.h>
+#include <fastrtps/participant/ParticipantListener.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -318,6 +325,158 @@ BLACKBOXTEST(BlackBox, LocalInitialPeers)
     reader.block_for_all();
 }
 
+BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldDiscoveryServer)
+{
+    Locator_t server_locator;
+    IPLocator::setIPv4(server_locator, 127, 0, 0, 1);
+    server_locator.port = static_cast<uint16_t>(global_port);
+    LocatorList_t servers;
+    servers.push_back(server_locator);
+
+    ParticipantAttributes server_attr;
+    server_attr.rtps.builtin.domainId = (uint32_t)GET_PID() % 230;
+    server_attr.rtps.builtin.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+    server_attr.rtps.builtin.metatrafficUnicastLocatorList = servers;
+    Participant* server = Domain::createParticipant(server_attr);
+    ASSERT_NE(server, nullptr);
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // Clients only know the server, so they discover each other through the announcements it relays.
+    reader.discovery_client(servers).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.discovery_client(servers).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    reader.destroy();
+    writer.destroy();
+    Domain::removeParticipant(server);
+}
+
+class EndpointDiscoveryListener : public ParticipantListener
+{
+    public:
+
+        void onSubscriberDiscovery(Participant*, ReaderDiscoveryInfo&& info) override
+        {
+            discovered(info.info.topicName().to_string());
+        }
+
+        void onPublisherDiscovery(Participant*, WriterDiscoveryInfo&& info) override
+        {
+            discovered(info.info.topicName().to_string());
+        }
+
+        bool wait_topic(const std::string& topic_name, const std::chrono::seconds& timeout)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return cv_.wait_for(lock, timeout, [&]() { return topics_.count(topic_name) != 0; });
+        }
+
+        bool has_topic(const std::string& topic_name)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return topics_.count(topic_name) != 0;
+        }
+
+    private:
+
+        void discovered(const std::string& topic_name)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            topics_.insert(topic_name);
+            cv_.notify_all();
+        }
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::set<std::string> topics_;
+};
+
+BLACKBOXTEST(BlackBox, DiscoveryServerRelaysOnlyEndpointsOnMatchingTopics)
+{
+    Locator_t server_locator;
+    IPLocator::setIPv4(server_locator, 127, 0, 0, 1);
+    server_locator.port = static_cast<uint16_t>(global_port);
+    LocatorList_t servers;
+    servers.push_back(server_locator);
+
+    ParticipantAttributes server_attr;
+    server_attr.rtps.builtin.domainId = (uint32_t)GET_PID() % 230;
+    server_attr.rtps.builtin.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+    server_attr.rtps.builtin.metatrafficUnicastLocatorList = servers;
+    Participant* server = Domain::createParticipant(server_attr);
+    ASSERT_NE(server, nullptr);
+
+    // A client only interested in another topic, where a second client publishes.
+    std::string other_topic = TEST_TOPIC_NAME + "_other";
+    EndpointDiscoveryListener listener;
+    ParticipantAttributes client_attr;
+    client_attr.rtps.builtin.domainId = (uint32_t)GET_PID() % 230;
+    client_attr.rtps.builtin.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+    client_attr.rtps.builtin.discoveryServersList = servers;
+    Participant* client = Domain::createParticipant(client_attr, &listener);
+    ASSERT_NE(client, nullptr);
+
+    HelloWorldType type;
+    ASSERT_TRUE(Domain::registerType(client, &type));
+    SubscriberAttributes sub_attr;
+    sub_attr.topic.topicDataType = type.getName();
+    sub_attr.topic.topicName = other_topic;
+    sub_attr.topic.topicKind = type.m_isGetKeyDefined ? WITH_KEY : NO_KEY;
+    ASSERT_NE(Domain::createSubscriber(client, sub_attr), nullptr);
+
+    PubSubWriter<HelloWorldType> other_writer(other_topic);
+    other_writer.discovery_client(servers).init();
+    ASSERT_TRUE(other_writer.isInitialized());
+
+    // The writer on its topic is relayed to the client.
+    ASSERT_TRUE(listener.wait_topic(other_topic, std::chrono::seconds(10)));
+
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.discovery_client(servers).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+    writer.discovery_client(servers).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    // The endpoints on the topic of the test are not relayed to the client.
+    ASSERT_FALSE(listener.has_topic(TEST_TOPIC_NAME));
+
+    reader.destroy();
+    writer.destroy();
+    other_writer.destroy();
+    Domain::removeParticipant(client);
+    Domain::removeParticipant(server);
+}
+
 // Test created to check bug #2010 (Github #90)
 BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldPartitions)
 {
@@ -450,3 +609,116 @@ BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldUserData)
     reader.wait_discovery_result();
 }
 
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldUnchangedParticipantAnnouncements)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // The writer announces itself every 100ms, and is dropped if none of them renews its lease in one second.
+    writer.history_depth(100).
+        lease_duration(Duration_t(1, 0), Duration_t(0.1)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    std::atomic<unsigned int> changed(0);
+    std::atomic<unsigned int> dropped(0);
+    reader.setOnDiscoveryFunction([&writer, &changed, &dropped](const ParticipantDiscoveryInfo& info) -> bool{
+            if(info.info.m_guid == writer.participant_guid())
+            {
+                if(info.status == ParticipantDiscoveryInfo::CHANGED_QOS_PARTICIPANT)
+                {
+                    ++changed;
+                }
+                else if(info.status == ParticipantDiscoveryInfo::DROPPED_PARTICIPANT)
+                {
+                    ++dropped;
+                }
+            }
+
+            return false;
+        });
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    reader.wait_discovery();
+    writer.wait_discovery();
+
+    // Unchanged announcements are not parsed again nor notified, but they still renew the lease.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2500));
+    ASSERT_EQ(changed.load(), 0u);
+    ASSERT_EQ(dropped.load(), 0u);
+}
+
+static eprosima::fastrtps::types::TypeIdentifier minimal_type_identifier(octet hash_seed)
+{
+    eprosima::fastrtps::types::EquivalenceHash hash;
+    for(octet i = 0; i < 14; ++i)
+    {
+        hash[i] = static_cast<octet>(hash_seed + i);
+    }
+
+    eprosima::fastrtps::types::TypeIdentifier identifier;
+    identifier.equivalence_hash(hash);
+    identifier._d(eprosima::fastrtps::types::EK_MINIMAL);
+    return identifier;
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldMatchingTypeIdentifiers)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        type_identifier(MINIMAL, minimal_type_identifier(1)).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(10).
+        type_identifier(MINIMAL, minimal_type_identifier(1)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldMismatchingTypeIdentifiers)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        type_identifier(MINIMAL, minimal_type_identifier(1)).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(10).
+        type_identifier(MINIMAL, minimal_type_identifier(2)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // The endpoints have different equivalence hashes, so they never match.
+    writer.wait_discovery(std::chrono::seconds(3));
+    reader.wait_discovery(std::chrono::seconds(1));
+
+    ASSERT_FALSE(writer.is_matched());
+    ASSERT_FALSE(reader.is_matched());
+}
@@ -0,0 +1,177 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "BlackboxTests.hpp"
+
+#include "PubSubReader.hpp"
+#include "PubSubWriter.hpp"
+
+#include <fastrtps/transport/test_UDPv4Transport.h>
+
+#include <thread>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableLifespanValidSamplesDelivered)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(10).
+        reliability(RELIABLE_RELIABILITY_QOS).
+        lifespan_period(Duration_t(10, 0)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableLifespanExpiredSamplesPurged)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(10).
+        reliability(RELIABLE_RELIABILITY_QOS).
+        lifespan_period(Duration_t(0.2)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Samples are in the reader history before they expire.
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // Let all samples expire before taking them. The sleep is much longer than the lifespan, so both purge
+    // timers have fired.
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    // Expired samples have been removed from the writer history.
+    size_t number_of_changes_removed = 0;
+    ASSERT_FALSE(writer.remove_all_changes(&number_of_changes_removed));
+    ASSERT_EQ(number_of_changes_removed, 0u);
+
+    // Expired samples have been removed from the reader history.
+    data = default_helloworld_data_generator();
+    reader.startReception(data);
+    ASSERT_EQ(reader.block_for_all(std::chrono::milliseconds(300)), 0u);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsNonReliableLifespanExpiredSamplesNotDelivered)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        reliability(BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Lifespan of the writer is applied by the reader. Samples have expired when they arrive.
+    writer.history_depth(10).
+        reliability(BEST_EFFORT_RELIABILITY_QOS).
+        lifespan_period(Duration_t(0, 1)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+
+    // Expired samples are not delivered to the user.
+    ASSERT_EQ(reader.block_for_all(std::chrono::milliseconds(300)), 0u);
+}
+
+static void lifespan_samples_without_timestamp_delivered(
+        ReliabilityQosPolicyKind reliability)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(10).
+        reliability(reliability).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // The writer sends its samples without INFO_TS, so the reader stamps them with the reception time.
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->removeInfoTimestamps = true;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(10).
+        reliability(reliability).
+        lifespan_period(Duration_t(10, 0)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableLifespanSamplesWithoutTimestampDelivered)
+{
+    lifespan_samples_without_timestamp_delivered(RELIABLE_RELIABILITY_QOS);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsNonReliableLifespanSamplesWithoutTimestampDelivered)
+{
+    lifespan_samples_without_timestamp_delivered(BEST_EFFORT_RELIABILITY_QOS);
+}
@@ -19,6 +19,15 @@
 #include "ReqRepAsReliableHelloWorldRequester.hpp"
 #include "ReqRepAsReliableHelloWorldReplier.hpp"
 
+#include <fastrtps/Domain.h>
+#include <fastrtps/participant/Participant.h>
+#include <fastrtps/attributes/ParticipantAttributes.h>
+#include <fastrtps/rtps/resources/ResourceEvent.h>
+#include <fastrtps/transport/test_UDPv4Transport.h>
+
+#include <algorithm>
+#include <thread>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -111,6 +120,343 @@ BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworld)
     reader.block_for_all();
 }
 
+BLACKBOXTEST(BlackBox, PubSubAsReliableHelloworldStatistics)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    size_t samples = data.size();
+
+    reader.startReception(data);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    reader.block_for_all();
+
+    eprosima::fastrtps::rtps::WriterStatistics writer_statistics = writer.statistics();
+    ASSERT_GE(writer_statistics.samples_sent, samples);
+    ASSERT_GT(writer_statistics.bytes_sent, 0u);
+    ASSERT_GT(writer_statistics.send_latency.count, 0u);
+
+    eprosima::fastrtps::rtps::ReaderStatistics reader_statistics = reader.statistics();
+    ASSERT_EQ(reader_statistics.samples_received, samples);
+    ASSERT_GT(reader_statistics.bytes_received, 0u);
+    ASSERT_EQ(reader_statistics.reception_latency.count, samples);
+
+    eprosima::fastrtps::rtps::ParticipantStatistics participant_statistics = writer.participant_statistics();
+    ASSERT_GT(participant_statistics.datagrams_sent, 0u);
+    ASSERT_GT(participant_statistics.datagrams_received, 0u);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableSharedEventThreadHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // Both participants run their timed events on the same shared thread.
+    reader.history_depth(100).shared_event_threads(1).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).shared_event_threads(1).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Because its volatile the durability
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, SharedEventThreadsCreatedOnDemand)
+{
+    const size_t pool_size = 2;
+    const size_t num_participants = 4;
+
+    ParticipantAttributes participant_attr;
+    participant_attr.rtps.builtin.domainId = (uint32_t)GET_PID() % 230;
+    participant_attr.rtps.sharedEventThreads = pool_size;
+
+    ASSERT_EQ(ResourceEvent::shared_threads_count(), 0u);
+
+    // A thread is created for each participant until the pool is full. The next ones share them.
+    std::vector<Participant*> participants;
+    for (size_t i = 1; i <= num_participants; ++i)
+    {
+        participants.push_back(Domain::createParticipant(participant_attr));
+        ASSERT_NE(participants.back(), nullptr);
+        ASSERT_EQ(ResourceEvent::shared_threads_count(), std::min(i, pool_size));
+    }
+
+    // The threads are stopped when their last participant is removed.
+    for (Participant* participant : participants)
+    {
+        ASSERT_TRUE(Domain::removeParticipant(participant));
+    }
+    ASSERT_EQ(ResourceEvent::shared_threads_count(), 0u);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableSubmessageBatchingHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // Heartbeats, acknacks and gaps of the builtin and user endpoints wait 5ms to be sent together.
+    eprosima::fastrtps::rtps::Duration_t window(0, 21474836);
+
+    reader.history_depth(100).submessage_batching_window(window).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).submessage_batching_window(window).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+    // Acknowledgements arrive through the batches of the reader participant.
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableSubmessageBatchingFewerDatagrams)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    // The reader answers every heartbeat with an ACKNACK. Those sent during 100ms share one datagram per locator.
+    reader.history_depth(10).submessage_batching_window(Duration_t(0.1)).
+        reliability(RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // User samples never reach the reader, so the writer keeps sending heartbeats every 10ms.
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 100;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(10).heartbeat_period_seconds(0).heartbeat_period_fraction(42949673).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(2);
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+
+    ReaderStatistics reader_begin = reader.statistics();
+    ParticipantStatistics participant_begin = reader.participant_statistics();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    ReaderStatistics reader_end = reader.statistics();
+    ParticipantStatistics participant_end = reader.participant_statistics();
+
+    uint64_t acknacks = reader_end.acknacks_sent - reader_begin.acknacks_sent;
+    uint64_t datagrams = participant_end.datagrams_sent - participant_begin.datagrams_sent;
+    ASSERT_GT(acknacks, 20u);
+    // Without batching, every ACKNACK needs at least one datagram.
+    ASSERT_LT(datagrams, acknacks);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableSubmessageBatchingMulticastReaders)
+{
+    PubSubReader<HelloWorldType> reader_1(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> reader_2(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    std::string ip("239.255.1.4");
+
+    Duration_t window(0, 21474836);
+
+    // Both readers receive on the same multicast locator.
+    reader_1.history_depth(100).submessage_batching_window(window).
+        reliability(RELIABLE_RELIABILITY_QOS).durability_kind(TRANSIENT_LOCAL_DURABILITY_QOS).
+        add_to_multicast_locator_list(ip, global_port).init();
+
+    ASSERT_TRUE(reader_1.isInitialized());
+
+    reader_2.history_depth(100).submessage_batching_window(window).
+        reliability(RELIABLE_RELIABILITY_QOS).durability_kind(TRANSIENT_LOCAL_DURABILITY_QOS).
+        add_to_multicast_locator_list(ip, global_port).init();
+
+    ASSERT_TRUE(reader_2.isInitialized());
+
+    // Lost samples are repaired with submessages addressed to one reader, which are batched on the multicast
+    // locator together with the heartbeats addressed to both.
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 20;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(100).submessage_batching_window(window).
+        durability_kind(TRANSIENT_LOCAL_DURABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader_1.wait_discovery();
+    reader_2.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader_1.startReception(data);
+    reader_2.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block readers until reception finished or timeout.
+    reader_1.block_for_all();
+    reader_2.block_for_all();
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableRepairsMulticastWhenRequestedByAllReaders)
+{
+    PubSubReader<HelloWorldType> reader_1(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> reader_2(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    std::string ip("239.255.1.5");
+
+    // Both readers receive on the same multicast locator, so both lose the same samples.
+    reader_1.history_depth(100).reliability(RELIABLE_RELIABILITY_QOS).
+        add_to_unicast_locator_list("127.0.0.1", global_port + 1).
+        add_to_multicast_locator_list(ip, global_port).init();
+
+    ASSERT_TRUE(reader_1.isInitialized());
+
+    reader_2.history_depth(100).reliability(RELIABLE_RELIABILITY_QOS).
+        add_to_unicast_locator_list("127.0.0.1", global_port + 2).
+        add_to_multicast_locator_list(ip, global_port).init();
+
+    ASSERT_TRUE(reader_2.isInitialized());
+
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 20;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(100).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader_1.wait_discovery();
+    reader_2.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader_1.startReception(data);
+    reader_2.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block readers until reception finished or timeout.
+    reader_1.block_for_all();
+    reader_2.block_for_all();
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // Changes requested by both readers reach the default threshold and are repaired once on the multicast locator.
+    RepairStatistics repairs = writer.statistics().repairs;
+    ASSERT_GT(repairs.requested_changes, 0u);
+    ASSERT_GT(repairs.repairs_sent, 0u);
+    ASSERT_GT(repairs.multicast_repairs, 0u);
+    ASSERT_LE(repairs.multicast_repairs, repairs.repairs_sent);
+    ASSERT_GE(repairs.saved_repairs, repairs.multicast_repairs);
+    ASSERT_GT(repairs.saved_bytes, 0u);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableRepairsUnicastBelowThreshold)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    std::string ip("239.255.1.6");
+
+    // New samples are sent to the multicast locator, and repairs to the unicast one.
+    reader.history_depth(100).reliability(RELIABLE_RELIABILITY_QOS).
+        add_to_unicast_locator_list("127.0.0.1", global_port + 1).
+        add_to_multicast_locator_list(ip, global_port).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+    testTransport->dropDataMessagesPercentage = 20;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+
+    writer.history_depth(100).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+    ASSERT_TRUE(writer.waitForAllAcked(std::chrono::seconds(10)));
+
+    // A single requester is below the default threshold, so repairs go to the unicast locators of the reader.
+    RepairStatistics repairs = writer.statistics().repairs;
+    ASSERT_GT(repairs.requested_changes, 0u);
+    ASSERT_GT(repairs.repairs_sent, 0u);
+    ASSERT_EQ(repairs.multicast_repairs, 0u);
+    ASSERT_EQ(repairs.saved_repairs, 0u);
+    ASSERT_EQ(repairs.saved_bytes, 0u);
+}
+
 BLACKBOXTEST(BlackBox, AsyncPubSubAsReliableHelloworld)
 {
     PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
@@ -143,6 +489,195 @@ BLACKBOXTEST(BlackBox, AsyncPubSubAsReliableHelloworld)
     reader.block_for_all();
 }
 
+BLACKBOXTEST(BlackBox, PubSubAsNonReliableLatencyBudgetHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+        latency_budget_duration(eprosima::fastrtps::rtps::Duration_t(0.05)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableLatencyBudgetHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).
+        latency_budget_duration(eprosima::fastrtps::rtps::Duration_t(0.05)).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsNonReliableLatencyBudgetFewerDatagrams)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> batched_writer(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    batched_writer.history_depth(100).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).
+        latency_budget_duration(eprosima::fastrtps::rtps::Duration_t(0.05)).init();
+
+    ASSERT_TRUE(batched_writer.isInitialized());
+
+    writer.history_depth(100).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    batched_writer.wait_discovery();
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    // Each writer lives in its own participant, so the datagrams of its participant are its own.
+    auto data = default_helloworld_data_generator();
+    ParticipantStatistics batched_begin = batched_writer.participant_statistics();
+    batched_writer.send(data);
+    ASSERT_TRUE(data.empty());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ParticipantStatistics batched_end = batched_writer.participant_statistics();
+
+    data = default_helloworld_data_generator();
+    ParticipantStatistics begin = writer.participant_statistics();
+    writer.send(data);
+    ASSERT_TRUE(data.empty());
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    ParticipantStatistics end = writer.participant_statistics();
+
+    uint64_t batched_datagrams = batched_end.datagrams_sent - batched_begin.datagrams_sent;
+    uint64_t datagrams = end.datagrams_sent - begin.datagrams_sent;
+    ASSERT_GT(batched_datagrams, 0u);
+    // The ten samples written within the budget share the datagram of each reader locator.
+    ASSERT_LT(batched_datagrams * 2, datagrams);
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableTransportPriorityHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(100).
+        transport_priority(46).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, AsyncPubSubAsReliableTransportPriorityHelloworld)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubReader<HelloWorldType> bulk_reader(TEST_TOPIC_NAME + "_bulk");
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> bulk_writer(TEST_TOPIC_NAME + "_bulk");
+
+    reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+    bulk_reader.history_depth(100).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(bulk_reader.isInitialized());
+
+    // The bulk writer is created first, so only the priority places the control writer before it.
+    bulk_writer.history_depth(100).
+        asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE).init();
+    writer.history_depth(100).
+        transport_priority(46).
+        asynchronously(eprosima::fastrtps::ASYNCHRONOUS_PUBLISH_MODE).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+    ASSERT_TRUE(bulk_writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    bulk_writer.wait_discovery();
+    reader.wait_discovery();
+    bulk_reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator();
+    auto bulk_data = default_helloworld_data_generator();
+
+    reader.startReception(data);
+    bulk_reader.startReception(bulk_data);
+
+    // Send data
+    bulk_writer.send(bulk_data);
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    ASSERT_TRUE(bulk_data.empty());
+    // Block readers until reception finished or timeout.
+    reader.block_for_all();
+    bulk_reader.block_for_all();
+}
+
 BLACKBOXTEST(BlackBox, ReqRepAsReliableHelloworld)
 {
     ReqRepAsReliableHelloWorldRequester requester;
@@ -25,38 +25,99 @@ using namespace eprosima::fastrtps::rtps;
 
 BLACKBOXTEST(BlackBox, PubSubAsNonReliableData300kb)
 {
-    // Mutes an expected error
-    Log::SetErrorStringFilter(std::regex("^((?!Big data).)*$"));
-
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
     PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
 
-    writer.reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
+    reader.init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(10).
+        reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS).init();
 
     ASSERT_TRUE(writer.isInitialized());
 
-    auto data = default_data300kb_data_generator(1);
+    // Because its volatile the durability
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator();
+
+    reader.startReception(data);
     // Send data
     writer.send(data);
-    // In this test data is not sent.
-    ASSERT_FALSE(data.empty());
+    // In this test data is fragmented and sent from the calling thread.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_at_least(2);
 }
 
 BLACKBOXTEST(BlackBox, PubSubAsReliableData300kb)
 {
-    // Mutes an expected error
-    Log::SetErrorStringFilter(std::regex("^((?!Big data).)*$"));
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(5).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(5).init();
 
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Because its volatile the durability
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator(5);
+
+    reader.startReception(data);
+
+    // Send data
+    writer.send(data);
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
+BLACKBOXTEST(BlackBox, PubSubAsReliableData300kbSmallFragments)
+{
+    PubSubReader<Data1mbType> reader(TEST_TOPIC_NAME);
     PubSubWriter<Data1mbType> writer(TEST_TOPIC_NAME);
 
-    writer.init();
+    reader.history_depth(5).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    // Small messages split each sample in more fragments than a writer collects in one pass for a repair.
+    auto testTransport = std::make_shared<UDPv4TransportDescriptor>();
+    testTransport->maxMessageSize = 1024;
+    writer.disable_builtin_transport();
+    writer.add_user_transport_to_pparams(testTransport);
+    writer.history_depth(5).init();
 
     ASSERT_TRUE(writer.isInitialized());
 
-    auto data = default_data300kb_data_generator(1);
+    // Because its volatile the durability
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_data300kb_data_generator(5);
+
+    reader.startReception(data);
+
     // Send data
     writer.send(data);
-    // In this test data is not sent.
-    ASSERT_FALSE(data.empty());
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
 }
 
 BLACKBOXTEST(BlackBox, AsyncPubSubAsNonReliableData300kb)
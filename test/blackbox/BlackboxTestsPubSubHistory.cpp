@@ -383,3 +383,86 @@ BLACKBOXTEST(BlackBox, PubSubAsReliableMultithreadKeepLast1)
     reader.block_for_at_least(105);
 }
 
+// The caches of the history are reserved by the writing threads before locking the writer. No write may fail while
+// the other threads fill the free caches.
+BLACKBOXTEST(BlackBox, PubSubAsReliableMultithreadKeepLast1FiveWriters)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.history_depth(1).
+        reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_depth(1).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(500);
+
+    reader.startReception(data);
+
+    std::vector<std::thread> threads;
+    for(auto it = data.begin(); it != data.end(); std::advance(it, 100))
+    {
+        threads.emplace_back(&send_async_data<HelloWorldType>, std::ref(writer),
+                std::list<HelloWorld>(it, std::next(it, 100)));
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Block reader until reception finished or timeout.
+    reader.block_for_at_least(1);
+}
+
+// With KEEP_ALL every write blocks until there is room in the history, also when the free caches are being filled
+// by other threads.
+BLACKBOXTEST(BlackBox, PubSubAsReliableMultithreadKeepAll)
+{
+    PubSubReader<HelloWorldType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<HelloWorldType> writer(TEST_TOPIC_NAME);
+
+    reader.reliability(eprosima::fastrtps::RELIABLE_RELIABILITY_QOS).
+        history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).init();
+
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.history_kind(eprosima::fastrtps::KEEP_ALL_HISTORY_QOS).
+        max_blocking_time({10, 0}).
+        resource_limits_allocated_samples(2).
+        resource_limits_max_samples(2).init();
+
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    auto data = default_helloworld_data_generator(200);
+
+    reader.startReception(data);
+
+    std::vector<std::thread> threads;
+    for(auto it = data.begin(); it != data.end(); std::advance(it, 50))
+    {
+        threads.emplace_back(&send_async_data<HelloWorldType>, std::ref(writer),
+                std::list<HelloWorld>(it, std::next(it, 50)));
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+}
+
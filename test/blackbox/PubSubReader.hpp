@@ -167,6 +167,8 @@ class PubSubReader
             subscriber_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
 #elif defined(DYNAMIC_RESERVE_MEMORY_MODE_TEST)
             subscriber_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::DYNAMIC_RESERVE_MEMORY_MODE;
+#elif defined(DYNAMIC_REUSABLE_MEMORY_MODE_TEST)
+            subscriber_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::DYNAMIC_REUSABLE_MEMORY_MODE;
 #else
             subscriber_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE;
 #endif
@@ -366,6 +368,15 @@ class PubSubReader
             return *this;
         }
 
+        PubSubReader& type_identifier(
+                eprosima::fastrtps::rtps::TopicDiscoveryKind_t kind,
+                const eprosima::fastrtps::types::TypeIdentifier& identifier)
+        {
+            subscriber_attr_.topic.topicDiscoveryKind = kind;
+            subscriber_attr_.topic.type_id.m_type_identifier = identifier;
+            return *this;
+        }
+
         PubSubReader& disable_builtin_transport()
         {
             participant_attr_.rtps.useBuiltinTransports = false;
@@ -467,12 +478,37 @@ class PubSubReader
             return *this;
         }
 
+        PubSubReader& shared_event_threads(uint32_t pool_size)
+        {
+            participant_attr_.rtps.sharedEventThreads = pool_size;
+            return *this;
+        }
+
+        PubSubReader& submessage_batching_window(const eprosima::fastrtps::rtps::Duration_t& window)
+        {
+            participant_attr_.rtps.submessageBatchingWindow = window;
+            return *this;
+        }
+
+        PubSubReader& discovery_client(const eprosima::fastrtps::rtps::LocatorList_t& servers)
+        {
+            participant_attr_.rtps.builtin.discoveryProtocol = eprosima::fastrtps::rtps::DiscoveryProtocol_t::CLIENT;
+            participant_attr_.rtps.builtin.discoveryServersList = servers;
+            return *this;
+        }
+
         PubSubReader& durability_kind(const eprosima::fastrtps::DurabilityQosPolicyKind kind)
         {
             subscriber_attr_.qos.m_durability.kind = kind;
             return *this;
         }
 
+        PubSubReader& lifespan_period(const eprosima::fastrtps::rtps::Duration_t lifespan_period)
+        {
+            subscriber_attr_.qos.m_lifespan.duration = lifespan_period;
+            return *this;
+        }
+
         PubSubReader& static_discovery(const char* filename)
         {
             participant_attr_.rtps.builtin.use_SIMPLE_EndpointDiscoveryProtocol = false;
@@ -596,6 +632,16 @@ class PubSubReader
             return subscriber_->updateAttributes(subscriber_attr_);
         }
 
+        eprosima::fastrtps::rtps::ReaderStatistics statistics() const
+        {
+            return subscriber_->get_statistics();
+        }
+
+        eprosima::fastrtps::rtps::ParticipantStatistics participant_statistics() const
+        {
+            return participant_->get_statistics();
+        }
+
         /*** Function for discovery callback ***/
 
         void wait_discovery_result()
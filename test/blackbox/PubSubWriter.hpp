@@ -181,6 +181,8 @@ class PubSubWriter
         publisher_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
 #elif defined(DYNAMIC_RESERVE_MEMORY_MODE_TEST)
         publisher_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::DYNAMIC_RESERVE_MEMORY_MODE;
+#elif defined(DYNAMIC_REUSABLE_MEMORY_MODE_TEST)
+        publisher_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::DYNAMIC_REUSABLE_MEMORY_MODE;
 #else
         publisher_attr_.historyMemoryPolicy = eprosima::fastrtps::rtps::PREALLOCATED_MEMORY_MODE;
 #endif
@@ -398,6 +400,15 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& type_identifier(
+            eprosima::fastrtps::rtps::TopicDiscoveryKind_t kind,
+            const eprosima::fastrtps::types::TypeIdentifier& identifier)
+    {
+        publisher_attr_.topic.topicDiscoveryKind = kind;
+        publisher_attr_.topic.type_id.m_type_identifier = identifier;
+        return *this;
+    }
+
     PubSubWriter& disable_builtin_transport()
     {
         participant_attr_.rtps.useBuiltinTransports = false;
@@ -416,6 +427,24 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& latency_budget_duration(const eprosima::fastrtps::rtps::Duration_t latency_budget)
+    {
+        publisher_attr_.qos.m_latencyBudget.duration = latency_budget;
+        return *this;
+    }
+
+    PubSubWriter& transport_priority(uint32_t priority)
+    {
+        publisher_attr_.qos.m_transportPriority.value = priority;
+        return *this;
+    }
+
+    PubSubWriter& lifespan_period(const eprosima::fastrtps::rtps::Duration_t lifespan_period)
+    {
+        publisher_attr_.qos.m_lifespan.duration = lifespan_period;
+        return *this;
+    }
+
     PubSubWriter& resource_limits_allocated_samples(const int32_t initial)
     {
         publisher_attr_.topic.resourceLimitsQos.allocated_samples = initial;
@@ -523,6 +552,25 @@ class PubSubWriter
         return *this;
     }
 
+    PubSubWriter& shared_event_threads(uint32_t pool_size)
+    {
+        participant_attr_.rtps.sharedEventThreads = pool_size;
+        return *this;
+    }
+
+    PubSubWriter& submessage_batching_window(const eprosima::fastrtps::rtps::Duration_t& window)
+    {
+        participant_attr_.rtps.submessageBatchingWindow = window;
+        return *this;
+    }
+
+    PubSubWriter& discovery_client(const eprosima::fastrtps::rtps::LocatorList_t& servers)
+    {
+        participant_attr_.rtps.builtin.discoveryProtocol = eprosima::fastrtps::rtps::DiscoveryProtocol_t::CLIENT;
+        participant_attr_.rtps.builtin.discoveryServersList = servers;
+        return *this;
+    }
+
     PubSubWriter& static_discovery(const char* filename)
     {
         participant_attr_.rtps.builtin.use_SIMPLE_EndpointDiscoveryProtocol = false;
@@ -657,6 +705,16 @@ class PubSubWriter
         return publisher_->removeAllChange(number_of_changes_removed);
     }
 
+    eprosima::fastrtps::rtps::WriterStatistics statistics() const
+    {
+        return publisher_->get_statistics();
+    }
+
+    eprosima::fastrtps::rtps::ParticipantStatistics participant_statistics() const
+    {
+        return participant_->get_statistics();
+    }
+
     bool is_matched() const
     {
         return matched_ > 0;
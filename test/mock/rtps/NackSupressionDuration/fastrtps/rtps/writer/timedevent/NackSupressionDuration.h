@@ -0,0 +1,58 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _RTPS_WRITER_TIMEDEVENT_NACKSUPRESSIONDURATION_H_
+#define _RTPS_WRITER_TIMEDEVENT_NACKSUPRESSIONDURATION_H_
+
+#include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/rtps/common/Time_t.h>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            // Forward declarations
+            class StatefulWriter;
+
+            class NackSupressionDuration
+            {
+                public:
+
+                    NackSupressionDuration(StatefulWriter* /*writer*/, double /*interval_in_ms*/)
+                    {
+                    }
+
+                    void reader_guid(const GUID_t /*guid*/)
+                    {
+                    }
+
+                    void restart_timer()
+                    {
+                    }
+
+                    void cancel_timer()
+                    {
+                    }
+
+                    bool update_interval(const Duration_t& /*interval*/)
+                    {
+                        return true;
+                    }
+            };
+        } // namespace rtps
+    } // namespace fastrtps
+} // namespace eprosima
+#endif // _RTPS_WRITER_TIMEDEVENT_NACKSUPRESSIONDURATION_H_
@@ -36,7 +36,7 @@ class PDPSimple
 
         MOCK_METHOD1(notifyAboveRemoteEndpoints, void(const ParticipantProxyData&));
 
-        MOCK_METHOD1(get_participant_proxy_data_serialized, CDRMessage_t(Endianness_t));
+        MOCK_METHOD2(get_participant_proxy_data_serialized, void(Endianness_t, CDRMessage_t&));
 
         EDP* getEDP() { return &edp_; }
 
@@ -449,6 +449,8 @@ class  PartitionQosPolicy : public Parameter_t, public QosPolicy
 
     private:
 
+    inline void add_name(const std::string& name){ names.push_back(name); };
+
     std::vector<std::string> names;
 };
 
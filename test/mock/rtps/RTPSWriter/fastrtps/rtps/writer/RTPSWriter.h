@@ -47,6 +47,8 @@ class RTPSWriter : public Endpoint
 			
 		MOCK_METHOD1(set_separate_sending, void(bool));
 
+        bool is_relevant(const CacheChange_t&, const GUID_t&) const { return true; }
+
         WriterHistory* history_;
 };
 
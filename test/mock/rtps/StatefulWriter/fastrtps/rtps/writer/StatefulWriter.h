@@ -31,7 +31,7 @@ class StatefulWriter : public RTPSWriter
 {
     public:
 
-        StatefulWriter(RTPSParticipantImpl* participant) : participant_(participant) {}
+        StatefulWriter(RTPSParticipantImpl* participant) : mp_history(nullptr), participant_(participant) {}
 
         virtual ~StatefulWriter() {}
 
@@ -43,8 +43,13 @@ class StatefulWriter : public RTPSWriter
 
         MOCK_METHOD1(unsent_change_added_to_history_mock, void(CacheChange_t*));
 
+        MOCK_METHOD0(get_seq_num_min, SequenceNumber_t());
+
         RTPSParticipantImpl* getRTPSParticipant() { return participant_; }
 
+        // In real class, inherited from RTPSWriter base class.
+        WriterHistory* mp_history;
+
     private:
 
         RTPSParticipantImpl* participant_;
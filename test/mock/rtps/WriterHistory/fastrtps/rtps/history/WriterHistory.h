@@ -20,6 +20,12 @@
 #define _RTPS_HISTORY_WRITERHISTORY_H_
 
 #include <fastrtps/rtps/attributes/HistoryAttributes.h>
+#include <fastrtps/rtps/common/CacheChange.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+#include <gmock/gmock.h>
 
 namespace eprosima {
 namespace fastrtps {
@@ -30,7 +36,7 @@ class WriterHistory
     public:
 
 
-        WriterHistory(const HistoryAttributes& /*att*/) : samples_number_(0) {}
+        WriterHistory(const HistoryAttributes& att) : m_att(att), samples_number_(0) {}
 
         MOCK_METHOD1(release_Cache, bool (CacheChange_t* change));
 
@@ -60,6 +66,10 @@ class WriterHistory
             return ret;
         }
 
+        std::vector<CacheChange_t*>::iterator changesBegin() { return m_changes.begin(); }
+
+        std::vector<CacheChange_t*>::iterator changesEnd() { return m_changes.end(); }
+
         void wait_for_more_samples_than(unsigned int minimum)
         {
             std::unique_lock<std::mutex> lock(samples_number_mutex_);
@@ -70,6 +80,11 @@ class WriterHistory
             }
         }
 
+        HistoryAttributes m_att;
+
+        //! Changes returned by changesBegin and changesEnd, sorted by sequence number.
+        std::vector<CacheChange_t*> m_changes;
+
     private:
 
         std::condition_variable samples_number_cond_;
@@ -0,0 +1,410 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryTest.cpp
+ *
+ */
+
+#include "DiscoveryTest.h"
+
+#include <asio.hpp>
+
+#include <fastrtps/log/Log.h>
+#include <fastrtps/log/Colors.h>
+
+#include <algorithm>
+#include <fstream>
+
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+using namespace eprosima;
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+DiscoveryTest::TestParticipant::TestParticipant(DiscoveryTest* test)
+    : test_(test)
+    , participant_(nullptr)
+    , discovered_participants_(0)
+    , matched_readers_(0)
+    , matched_writers_(0)
+    , matched_(false)
+{
+}
+
+DiscoveryTest::TestParticipant::~TestParticipant()
+{
+    if (participant_ != nullptr)
+    {
+        Domain::removeParticipant(participant_);
+    }
+}
+
+bool DiscoveryTest::TestParticipant::create(uint32_t index)
+{
+    ParticipantAttributes PParam;
+    PParam.rtps.builtin.domainId = test_->domain_id_;
+    std::ostringstream name;
+    name << "DiscoveryTest_" << index;
+    PParam.rtps.setName(name.str().c_str());
+
+    participant_ = Domain::createParticipant(PParam, this);
+    if (participant_ == nullptr)
+    {
+        return false;
+    }
+
+    Domain::registerType(participant_, &test_->type_);
+
+    for (uint32_t i = 0; i < test_->n_endpoints_; ++i)
+    {
+        std::ostringstream topic;
+        topic << test_->topic_prefix_ << i;
+
+        PublisherAttributes Wparam;
+        Wparam.topic.topicDataType = test_->type_.getName();
+        Wparam.topic.topicKind = NO_KEY;
+        Wparam.topic.topicName = topic.str();
+        if (Domain::createPublisher(participant_, Wparam, this) == nullptr)
+        {
+            return false;
+        }
+
+        SubscriberAttributes Rparam;
+        Rparam.topic.topicDataType = test_->type_.getName();
+        Rparam.topic.topicKind = NO_KEY;
+        Rparam.topic.topicName = topic.str();
+        if (Domain::createSubscriber(participant_, Rparam, this) == nullptr)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DiscoveryTest::TestParticipant::onParticipantDiscovery(Participant* /*participant*/,
+        ParticipantDiscoveryInfo&& info)
+{
+    std::unique_lock<std::mutex> lock(test_->mutex_);
+    if (info.status == ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT)
+    {
+        ++discovered_participants_;
+    }
+    else if (info.status == ParticipantDiscoveryInfo::REMOVED_PARTICIPANT ||
+            info.status == ParticipantDiscoveryInfo::DROPPED_PARTICIPANT)
+    {
+        --discovered_participants_;
+    }
+    check_matched_nts();
+}
+
+void DiscoveryTest::TestParticipant::onPublicationMatched(Publisher* /*pub*/, MatchingInfo& info)
+{
+    std::unique_lock<std::mutex> lock(test_->mutex_);
+    matched_readers_ += (info.status == MATCHED_MATCHING) ? 1 : -1;
+    check_matched_nts();
+}
+
+void DiscoveryTest::TestParticipant::onSubscriptionMatched(Subscriber* /*sub*/, MatchingInfo& info)
+{
+    std::unique_lock<std::mutex> lock(test_->mutex_);
+    matched_writers_ += (info.status == MATCHED_MATCHING) ? 1 : -1;
+    check_matched_nts();
+}
+
+void DiscoveryTest::TestParticipant::check_matched_nts()
+{
+    int32_t expected = static_cast<int32_t>(test_->expected_participants_);
+    int32_t expected_matches = expected * static_cast<int32_t>(test_->n_endpoints_);
+    bool matched = discovered_participants_ == expected - 1 && matched_readers_ == expected_matches &&
+        matched_writers_ == expected_matches;
+
+    if (matched && !matched_)
+    {
+        matched_time_ = std::chrono::steady_clock::now();
+        test_->matched_cond_.notify_one();
+    }
+    matched_ = matched;
+}
+
+DiscoveryTest::DiscoveryTest()
+    : next_index_(0)
+    , n_participants_(0)
+    , n_total_participants_(0)
+    , n_endpoints_(0)
+    , expected_participants_(0)
+    , domain_id_(0)
+    , export_csv_(false)
+{
+}
+
+DiscoveryTest::~DiscoveryTest()
+{
+    participants_.clear();
+}
+
+bool DiscoveryTest::init(uint32_t participants, uint32_t total_participants, uint32_t endpoints, uint32_t pid,
+        bool hostname, bool export_csv, const std::string& export_prefix)
+{
+    n_participants_ = participants;
+    n_total_participants_ = std::max(participants, total_participants);
+    n_endpoints_ = endpoints;
+    export_csv_ = export_csv;
+    export_prefix_ = export_prefix.empty() ? "perf_DiscoveryTest" : export_prefix;
+
+    // Participant ports grow with the participant id, so low domains leave room for hundreds of participants.
+    domain_id_ = pid % 100;
+
+    std::ostringstream topic;
+    topic << "DiscoveryTest_";
+    if (hostname)
+    {
+        topic << asio::ip::host_name() << "_";
+    }
+    topic << pid << "_";
+    topic_prefix_ = topic.str();
+
+    if (n_participants_ == 0)
+    {
+        std::cout << "At least one participant is needed" << std::endl;
+        return false;
+    }
+
+    output_file_ << "\"Phase\",\"Participants\",\"Endpoints\",\"Min match (ms)\",\"Mean match (ms)\","
+        "\"Max match (ms)\",\"Bytes sent\",\"Datagrams sent\",\"Bytes received\",\"Datagrams received\","
+        "\"CPU (ms)\",\"Memory (KB)\"" << std::endl;
+
+    return true;
+}
+
+bool DiscoveryTest::run(DiscoveryTestScenario scenario, uint32_t churn_participants, uint32_t churn_cycles,
+        uint32_t timeout)
+{
+    if (scenario != STARTUP_SCENARIO && (n_total_participants_ != n_participants_ || n_participants_ < 2))
+    {
+        std::cout << "Late joiner and churn scenarios need at least two participants, all of them in the same "
+            "process" << std::endl;
+        return false;
+    }
+
+    printf("Printing discovery costs per participant, for %u participants with %u publishers and %u subscribers\n",
+        n_total_participants_, n_endpoints_, n_endpoints_);
+    printf("           Phase, Participants, Min match, Mean match, Max match,  Bytes sent,  Dgrams sent,"
+        "  Bytes recv,  Dgrams recv,  CPU (ms), Mem (KB)\n");
+    printf("----------------,-------------,----------,-----------,----------,------------,-------------,"
+        "------------,-------------,----------,---------\n");
+
+    DiscoveryTestResources resources;
+    bool success = true;
+
+    switch (scenario)
+    {
+        case STARTUP_SCENARIO:
+        {
+            begin_phase(resources, n_total_participants_);
+            success = create_participants(n_participants_) && wait_matched(timeout);
+            end_phase("startup", resources, n_participants_, success);
+            break;
+        }
+        case LATE_JOINER_SCENARIO:
+        {
+            begin_phase(resources, n_participants_ - 1);
+            success = create_participants(n_participants_ - 1) && wait_matched(timeout);
+            end_phase("startup", resources, n_participants_ - 1, success);
+
+            if (success)
+            {
+                begin_phase(resources, n_participants_);
+                success = create_participants(1) && wait_matched(timeout);
+                end_phase("late_joiner", resources, 1, success);
+            }
+            break;
+        }
+        case CHURN_SCENARIO:
+        {
+            churn_participants = std::min(std::max(churn_participants, 1u), n_participants_ - 1);
+
+            begin_phase(resources, n_participants_);
+            success = create_participants(n_participants_) && wait_matched(timeout);
+            end_phase("startup", resources, n_participants_, success);
+
+            for (uint32_t cycle = 0; success && cycle < churn_cycles; ++cycle)
+            {
+                begin_phase(resources, n_participants_ - churn_participants);
+                remove_participants(churn_participants);
+                success = wait_matched(timeout);
+                end_phase("churn_leave", resources, 0, success);
+
+                if (success)
+                {
+                    begin_phase(resources, n_participants_);
+                    success = create_participants(churn_participants) && wait_matched(timeout);
+                    end_phase("churn_join", resources, churn_participants, success);
+                }
+            }
+            break;
+        }
+    }
+
+    if (export_csv_)
+    {
+        std::ofstream outFile(export_prefix_ + ".csv");
+        outFile << output_file_.str();
+    }
+
+    participants_.clear();
+    return success;
+}
+
+void DiscoveryTest::begin_phase(DiscoveryTestResources& resources, uint32_t expected_participants)
+{
+    resources = DiscoveryTestResources();
+    process_resources(resources.cpu_ms, resources.rss_kb);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    phase_start_ = std::chrono::steady_clock::now();
+    // Set before creating or removing participants, so no match is taken against the previous expectation.
+    expected_participants_ = expected_participants;
+    for (std::unique_ptr<TestParticipant>& participant : participants_)
+    {
+        participant->phase_start_ = participant->participant_->get_statistics();
+        participant->matched_ = false;
+        participant->check_matched_nts();
+    }
+}
+
+bool DiscoveryTest::create_participants(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        std::unique_ptr<TestParticipant> participant(new TestParticipant(this));
+        if (!participant->create(next_index_++))
+        {
+            std::cout << "Error creating participant " << next_index_ - 1 << std::endl;
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        participants_.push_back(std::move(participant));
+    }
+
+    return true;
+}
+
+void DiscoveryTest::remove_participants(uint32_t count)
+{
+    // The oldest participants leave.
+    for (uint32_t i = 0; i < count && !participants_.empty(); ++i)
+    {
+        std::unique_ptr<TestParticipant> participant;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            participant = std::move(participants_.front());
+            participants_.erase(participants_.begin());
+        }
+        // Removed out of the lock, as its listener may be called meanwhile.
+        participant.reset();
+    }
+}
+
+bool DiscoveryTest::wait_matched(uint32_t timeout)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return matched_cond_.wait_for(lock, std::chrono::seconds(timeout), [&]()
+    {
+        return std::all_of(participants_.begin(), participants_.end(),
+            [](const std::unique_ptr<TestParticipant>& participant) { return participant->matched_; });
+    });
+}
+
+void DiscoveryTest::end_phase(const std::string& name, const DiscoveryTestResources& begin, uint32_t created,
+        bool success)
+{
+    DiscoveryTestResources end;
+    process_resources(end.cpu_ms, end.rss_kb);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    double min_ms = 0, mean_ms = 0, max_ms = 0;
+    uint32_t n_matched = 0;
+    for (std::unique_ptr<TestParticipant>& participant : participants_)
+    {
+        ParticipantStatistics stats = participant->participant_->get_statistics();
+        end.bytes_sent += stats.bytes_sent - participant->phase_start_.bytes_sent;
+        end.datagrams_sent += stats.datagrams_sent - participant->phase_start_.datagrams_sent;
+        end.bytes_received += stats.bytes_received - participant->phase_start_.bytes_received;
+        end.datagrams_received += stats.datagrams_received - participant->phase_start_.datagrams_received;
+
+        if (participant->matched_)
+        {
+            double ms = std::chrono::duration<double, std::milli>(participant->matched_time_ - phase_start_).count();
+            min_ms = n_matched == 0 ? ms : std::min(min_ms, ms);
+            max_ms = std::max(max_ms, ms);
+            mean_ms += ms;
+            ++n_matched;
+        }
+    }
+    size_t alive = participants_.size();
+    lock.unlock();
+
+    if (!success)
+    {
+        std::cout << C_RED << "Phase " << name << " did not complete: " << n_matched << " of " << alive <<
+            " participants matched" << C_DEF << std::endl;
+    }
+
+    mean_ms = n_matched > 0 ? mean_ms / n_matched : 0;
+    double divisor = alive > 0 ? static_cast<double>(alive) : 1.0;
+    double bytes_sent = end.bytes_sent / divisor;
+    double datagrams_sent = end.datagrams_sent / divisor;
+    double bytes_received = end.bytes_received / divisor;
+    double datagrams_received = end.datagrams_received / divisor;
+    double cpu_ms = (end.cpu_ms - begin.cpu_ms) / divisor;
+    // Memory is only attributed to the participants created during the phase.
+    double rss_kb = created > 0 ? static_cast<double>(end.rss_kb - begin.rss_kb) / created : 0;
+
+    printf("%16s,%13u,%10.2f,%11.2f,%10.2f,%12.0f,%13.1f,%12.0f,%13.1f,%10.2f,%9.1f\n", name.c_str(),
+        static_cast<uint32_t>(alive), min_ms, mean_ms, max_ms, bytes_sent, datagrams_sent, bytes_received,
+        datagrams_received, cpu_ms, rss_kb);
+
+    output_file_ << "\"" << name << "\",\"" << alive << "\",\"" << n_endpoints_ << "\",\"" << min_ms << "\",\"" <<
+        mean_ms << "\",\"" << max_ms << "\",\"" << bytes_sent << "\",\"" << datagrams_sent << "\",\"" <<
+        bytes_received << "\",\"" << datagrams_received << "\",\"" << cpu_ms << "\",\"" << rss_kb << "\"" <<
+        std::endl;
+}
+
+void DiscoveryTest::process_resources(double& cpu_ms, int64_t& rss_kb)
+{
+    cpu_ms = 0;
+    rss_kb = 0;
+
+#ifndef _WIN32
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+        cpu_ms = (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 +
+            (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+    }
+
+    std::ifstream statm("/proc/self/statm");
+    int64_t size = 0, resident = 0;
+    if (statm >> size >> resident)
+    {
+        rss_kb = resident * static_cast<int64_t>(sysconf(_SC_PAGESIZE)) / 1024;
+    }
+#endif
+}
@@ -0,0 +1,139 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryTest.h
+ *
+ */
+
+#ifndef DISCOVERYTEST_H_
+#define DISCOVERYTEST_H_
+
+#include "LatencyTestTypes.h"
+
+#include <fastrtps/participant/ParticipantListener.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+enum DiscoveryTestScenario
+{
+    //! All the participants are created at once.
+    STARTUP_SCENARIO,
+    //! One participant joins a fully matched system.
+    LATE_JOINER_SCENARIO,
+    //! Some participants of a fully matched system leave and are replaced by new ones, several times.
+    CHURN_SCENARIO
+};
+
+//! Resources used during a phase of the test, summed for all the local participants.
+class DiscoveryTestResources
+{
+public:
+    DiscoveryTestResources() : bytes_sent(0), datagrams_sent(0), bytes_received(0), datagrams_received(0),
+        cpu_ms(0), rss_kb(0) {}
+    uint64_t bytes_sent;
+    uint64_t datagrams_sent;
+    uint64_t bytes_received;
+    uint64_t datagrams_received;
+    double cpu_ms;
+    int64_t rss_kb;
+};
+
+class DiscoveryTest
+{
+public:
+
+    DiscoveryTest();
+    virtual ~DiscoveryTest();
+
+    /**
+     * @param participants Number of participants created by this process.
+     * @param total_participants Number of participants in the whole system, in this and other processes.
+     * @param endpoints Number of publishers, and of subscribers, of each participant. Publisher and subscriber j
+     * of every participant use the same topic, so each endpoint matches one endpoint of every participant.
+     */
+    bool init(uint32_t participants, uint32_t total_participants, uint32_t endpoints, uint32_t pid, bool hostname,
+        bool export_csv, const std::string& export_prefix);
+
+    bool run(DiscoveryTestScenario scenario, uint32_t churn_participants, uint32_t churn_cycles, uint32_t timeout);
+
+private:
+
+    class TestParticipant : public eprosima::fastrtps::ParticipantListener,
+        public eprosima::fastrtps::PublisherListener, public eprosima::fastrtps::SubscriberListener
+    {
+    public:
+        TestParticipant(DiscoveryTest* test);
+        ~TestParticipant();
+
+        bool create(uint32_t index);
+
+        void onParticipantDiscovery(eprosima::fastrtps::Participant* participant,
+            eprosima::fastrtps::rtps::ParticipantDiscoveryInfo&& info) override;
+
+        void onPublicationMatched(eprosima::fastrtps::Publisher* pub,
+            eprosima::fastrtps::rtps::MatchingInfo& info) override;
+
+        void onSubscriptionMatched(eprosima::fastrtps::Subscriber* sub,
+            eprosima::fastrtps::rtps::MatchingInfo& info) override;
+
+        //! Updates the match state of the participant. Should be called with the mutex of the test taken.
+        void check_matched_nts();
+
+        DiscoveryTest* test_;
+        eprosima::fastrtps::Participant* participant_;
+        int32_t discovered_participants_;
+        int32_t matched_readers_;
+        int32_t matched_writers_;
+        bool matched_;
+        std::chrono::steady_clock::time_point matched_time_;
+        eprosima::fastrtps::rtps::ParticipantStatistics phase_start_;
+    };
+
+    void begin_phase(DiscoveryTestResources& resources, uint32_t expected_participants);
+
+    bool create_participants(uint32_t count);
+
+    void remove_participants(uint32_t count);
+
+    bool wait_matched(uint32_t timeout);
+
+    void end_phase(const std::string& name, const DiscoveryTestResources& begin, uint32_t created, bool success);
+
+    static void process_resources(double& cpu_ms, int64_t& rss_kb);
+
+    std::mutex mutex_;
+    std::condition_variable matched_cond_;
+    std::vector<std::unique_ptr<TestParticipant>> participants_;
+    uint32_t next_index_;
+    uint32_t n_participants_;
+    uint32_t n_total_participants_;
+    uint32_t n_endpoints_;
+    uint32_t expected_participants_;
+    uint32_t domain_id_;
+    std::string topic_prefix_;
+    std::chrono::steady_clock::time_point phase_start_;
+    TestCommandDataType type_;
+    bool export_csv_;
+    std::string export_prefix_;
+    std::stringstream output_file_;
+};
+
+#endif /* DISCOVERYTEST_H_ */
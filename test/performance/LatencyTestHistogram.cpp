@@ -0,0 +1,209 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyTestHistogram.cpp
+ *
+ */
+
+#include "LatencyTestHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static int32_t bit_length(uint64_t value)
+{
+    int32_t length = 0;
+    while (value != 0)
+    {
+        ++length;
+        value >>= 1;
+    }
+    return length;
+}
+
+LatencyTestHistogram::LatencyTestHistogram(uint64_t highest_trackable_ns, uint8_t significant_digits)
+    : highest_trackable_(std::max<uint64_t>(highest_trackable_ns, 2))
+    , total_count_(0)
+    , min_(std::numeric_limits<uint64_t>::max())
+    , max_(0)
+{
+    significant_digits = std::min<uint8_t>(std::max<uint8_t>(significant_digits, 1), 5);
+
+    // Enough sub buckets to keep the significant digits on the lower half of every bucket.
+    uint64_t largest_single_unit = 2;
+    for (uint8_t i = 0; i < significant_digits; ++i)
+    {
+        largest_single_unit *= 10;
+    }
+    int32_t sub_bucket_count_magnitude = bit_length(largest_single_unit - 1);
+    sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude - 1;
+    sub_bucket_count_ = 1u << sub_bucket_count_magnitude;
+    sub_bucket_half_count_ = sub_bucket_count_ / 2;
+    sub_bucket_mask_ = sub_bucket_count_ - 1;
+
+    uint64_t smallest_untrackable = sub_bucket_count_;
+    uint32_t bucket_count = 1;
+    while (smallest_untrackable <= highest_trackable_)
+    {
+        if (smallest_untrackable > (std::numeric_limits<uint64_t>::max() >> 1))
+        {
+            ++bucket_count;
+            break;
+        }
+        smallest_untrackable <<= 1;
+        ++bucket_count;
+    }
+
+    counts_.assign((bucket_count + 1) * sub_bucket_half_count_, 0);
+}
+
+size_t LatencyTestHistogram::counts_index(uint64_t value) const
+{
+    int32_t bucket = bit_length(value | sub_bucket_mask_) - (sub_bucket_half_count_magnitude_ + 1);
+    uint64_t sub_bucket = value >> bucket;
+    return (static_cast<size_t>(bucket + 1) << sub_bucket_half_count_magnitude_) +
+        static_cast<size_t>(sub_bucket - sub_bucket_half_count_);
+}
+
+uint64_t LatencyTestHistogram::value_from_index(size_t index) const
+{
+    int32_t bucket = static_cast<int32_t>(index >> sub_bucket_half_count_magnitude_) - 1;
+    uint64_t sub_bucket = (index & (sub_bucket_half_count_ - 1)) + sub_bucket_half_count_;
+    if (bucket < 0)
+    {
+        sub_bucket -= sub_bucket_half_count_;
+        bucket = 0;
+    }
+    return sub_bucket << bucket;
+}
+
+uint64_t LatencyTestHistogram::highest_equivalent_value(uint64_t value) const
+{
+    int32_t bucket = bit_length(value | sub_bucket_mask_) - (sub_bucket_half_count_magnitude_ + 1);
+    uint64_t lowest = (value >> bucket) << bucket;
+    return lowest + (1ULL << bucket) - 1;
+}
+
+double LatencyTestHistogram::median_equivalent_value(uint64_t value) const
+{
+    return (static_cast<double>(value) + static_cast<double>(highest_equivalent_value(value))) / 2.0;
+}
+
+void LatencyTestHistogram::record(uint64_t value_ns)
+{
+    value_ns = std::min(value_ns, highest_trackable_);
+    ++counts_[counts_index(value_ns)];
+    ++total_count_;
+    min_ = std::min(min_, value_ns);
+    max_ = std::max(max_, value_ns);
+}
+
+void LatencyTestHistogram::reset()
+{
+    std::fill(counts_.begin(), counts_.end(), 0);
+    total_count_ = 0;
+    min_ = std::numeric_limits<uint64_t>::max();
+    max_ = 0;
+}
+
+double LatencyTestHistogram::mean() const
+{
+    if (total_count_ == 0)
+    {
+        return 0;
+    }
+
+    double total = 0;
+    for (size_t i = 0; i < counts_.size(); ++i)
+    {
+        if (counts_[i] != 0)
+        {
+            total += static_cast<double>(counts_[i]) * median_equivalent_value(value_from_index(i));
+        }
+    }
+    return total / total_count_;
+}
+
+double LatencyTestHistogram::stdev() const
+{
+    if (total_count_ == 0)
+    {
+        return 0;
+    }
+
+    double avg = mean();
+    double total = 0;
+    for (size_t i = 0; i < counts_.size(); ++i)
+    {
+        if (counts_[i] != 0)
+        {
+            double deviation = median_equivalent_value(value_from_index(i)) - avg;
+            total += static_cast<double>(counts_[i]) * deviation * deviation;
+        }
+    }
+    return std::sqrt(total / total_count_);
+}
+
+uint64_t LatencyTestHistogram::value_at_percentile(double percentile) const
+{
+    if (total_count_ == 0)
+    {
+        return 0;
+    }
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t count_at_percentile = static_cast<uint64_t>(std::ceil(percentile / 100.0 * total_count_));
+    count_at_percentile = std::max<uint64_t>(count_at_percentile, 1);
+
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < counts_.size(); ++i)
+    {
+        accumulated += counts_[i];
+        if (accumulated >= count_at_percentile)
+        {
+            return std::min(highest_equivalent_value(value_from_index(i)), max_);
+        }
+    }
+    return max_;
+}
+
+std::vector<std::pair<double, uint64_t>> LatencyTestHistogram::percentile_spectrum(
+        uint32_t ticks_per_half_distance) const
+{
+    std::vector<std::pair<double, uint64_t>> spectrum;
+    if (total_count_ == 0)
+    {
+        return spectrum;
+    }
+
+    ticks_per_half_distance = std::max<uint32_t>(ticks_per_half_distance, 1);
+    double percentile = 0;
+    while (percentile < 100.0)
+    {
+        spectrum.emplace_back(percentile, value_at_percentile(percentile));
+
+        // Once a tick is smaller than a single value, the rest of the spectrum is the maximum.
+        double half_distance = std::pow(2.0, std::floor(std::log2(100.0 / (100.0 - percentile))) + 1);
+        double step = 100.0 / (half_distance * ticks_per_half_distance);
+        if (step * total_count_ < 100.0)
+        {
+            break;
+        }
+        percentile += step;
+    }
+    spectrum.emplace_back(100.0, max_);
+    return spectrum;
+}
@@ -0,0 +1,93 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyTestHistogram.h
+ *
+ */
+
+#ifndef LATENCYTESTHISTOGRAM_H_
+#define LATENCYTESTHISTOGRAM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * High dynamic range histogram of latencies in nanoseconds.
+ * Values are kept with a fixed number of significant decimal digits from 1 ns up to the highest trackable value,
+ * so the whole percentile spectrum can be reported without storing every value.
+ */
+class LatencyTestHistogram
+{
+public:
+
+    LatencyTestHistogram(uint64_t highest_trackable_ns = 60000000000ULL, uint8_t significant_digits = 3);
+
+    //! Records a value. Values above the highest trackable value are saturated.
+    void record(uint64_t value_ns);
+
+    void reset();
+
+    uint64_t count() const { return total_count_; }
+
+    uint64_t min() const { return total_count_ == 0 ? 0 : min_; }
+
+    uint64_t max() const { return max_; }
+
+    double mean() const;
+
+    double stdev() const;
+
+    //! Highest value equivalent to the one below which the given percentage of the values are.
+    uint64_t value_at_percentile(double percentile) const;
+
+    /**
+     * Percentile spectrum, as pairs of percentile and value. The step between percentiles is halved every time
+     * the distance to 100% is halved, and the spectrum stops when there are not enough values to resolve it.
+     * @param ticks_per_half_distance Number of percentiles reported on each halving.
+     */
+    std::vector<std::pair<double, uint64_t>> percentile_spectrum(uint32_t ticks_per_half_distance = 5) const;
+
+private:
+
+    size_t counts_index(uint64_t value) const;
+
+    uint64_t value_from_index(size_t index) const;
+
+    uint64_t highest_equivalent_value(uint64_t value) const;
+
+    double median_equivalent_value(uint64_t value) const;
+
+    uint64_t highest_trackable_;
+
+    int32_t sub_bucket_half_count_magnitude_;
+
+    uint32_t sub_bucket_count_;
+
+    uint32_t sub_bucket_half_count_;
+
+    uint64_t sub_bucket_mask_;
+
+    std::vector<uint64_t> counts_;
+
+    uint64_t total_count_;
+
+    uint64_t min_;
+
+    uint64_t max_;
+};
+
+#endif /* LATENCYTESTHISTOGRAM_H_ */
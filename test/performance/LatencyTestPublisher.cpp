@@ -21,10 +21,13 @@
 #include "fastrtps/log/Log.h"
 #include "fastrtps/log/Colors.h"
 #include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <fastrtps/transport/test_UDPv4TransportDescriptor.h>
 
+#include <algorithm>
 #include <numeric>
 #include <cmath>
 #include <fstream>
+#include <thread>
 #include <inttypes.h>
 
 #define TIME_LIMIT_US 10000
@@ -60,7 +63,11 @@ LatencyTestPublisher::LatencyTestPublisher():
     mp_latency_in(nullptr),
     mp_latency_out(nullptr),
     m_DynData_in(nullptr),
-    m_DynData_out(nullptr)
+    m_DynData_out(nullptr),
+    hdr_mode_(false),
+    test_duration_(0),
+    target_rate_(0),
+    loss_percentage_(0)
 {
     m_forcedDomain = -1;
     m_datapublistener.mp_up = this;
@@ -78,7 +85,7 @@ LatencyTestPublisher::~LatencyTestPublisher()
 bool LatencyTestPublisher::init(int n_sub, int n_sam, bool reliable, uint32_t pid, bool hostname, bool export_csv,
         const std::string& export_prefix, const PropertyPolicy& part_property_policy,
         const PropertyPolicy& property_policy, bool large_data, const std::string& sXMLConfigFile, bool dynamic_types,
-        int forced_domain)
+        int forced_domain, bool hdr, uint32_t duration, uint32_t rate, uint8_t loss)
 {
     m_sXMLConfigFile = sXMLConfigFile;
     n_samples = n_sam;
@@ -88,6 +95,16 @@ bool LatencyTestPublisher::init(int n_sub, int n_sam, bool reliable, uint32_t pi
     reliable_ = reliable;
     dynamic_data = dynamic_types;
     m_forcedDomain = forced_domain;
+    hdr_mode_ = hdr;
+    test_duration_ = duration;
+    target_rate_ = rate;
+    loss_percentage_ = loss;
+
+    if (hdr_mode_ && (test_duration_ == 0 || target_rate_ == 0))
+    {
+        std::cout << "Open loop mode needs a duration and a rate" << std::endl;
+        return false;
+    }
 
     if(!large_data)
     {
@@ -217,6 +234,15 @@ bool LatencyTestPublisher::init(int n_sub, int n_sam, bool reliable, uint32_t pi
     PParam.rtps.properties = part_property_policy;
     PParam.rtps.setName("Participant_pub");
 
+    if (loss_percentage_ > 0)
+    {
+        // Lossy loopback through the test transport, which drops the given percentage of DATA submessages.
+        auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+        testTransport->dropDataMessagesPercentage = loss_percentage_;
+        PParam.rtps.useBuiltinTransports = false;
+        PParam.rtps.userTransports.push_back(testTransport);
+    }
+
     if (m_sXMLConfigFile.length() > 0)
     {
         if (m_forcedDomain >= 0)
@@ -276,6 +302,11 @@ bool LatencyTestPublisher::init(int n_sub, int n_sam, bool reliable, uint32_t pi
     {
         PubDataparam.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
     }
+    if (hdr_mode_)
+    {
+        // Samples are not waited for in open loop, so the lost ones must not be overwritten before their repair.
+        PubDataparam.topic.historyQos.kind = KEEP_ALL_HISTORY_QOS;
+    }
     PubDataparam.properties = property_policy;
     if (large_data)
     {
@@ -314,6 +345,10 @@ bool LatencyTestPublisher::init(int n_sub, int n_sam, bool reliable, uint32_t pi
     {
         SubDataparam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
     }
+    if (hdr_mode_)
+    {
+        SubDataparam.topic.historyQos.kind = KEEP_ALL_HISTORY_QOS;
+    }
     SubDataparam.properties = property_policy;
     if (large_data)
     {
@@ -523,7 +558,21 @@ void LatencyTestPublisher::CommandSubListener::onNewDataMessage(Subscriber* subs
 
 void LatencyTestPublisher::DataSubListener::onNewDataMessage(Subscriber* subscriber)
 {
-    if (mp_up->dynamic_data)
+    if (mp_up->hdr_mode_)
+    {
+        if (mp_up->dynamic_data)
+        {
+            if (subscriber->takeNextData((void*)mp_up->m_DynData_in, &mp_up->m_sampleinfo))
+            {
+                mp_up->echoReceived(mp_up->m_DynData_in->GetUint32Value(0));
+            }
+        }
+        else if (subscriber->takeNextData((void*)mp_up->mp_latency_in, &mp_up->m_sampleinfo))
+        {
+            mp_up->echoReceived(mp_up->mp_latency_in->seqnum);
+        }
+    }
+    else if (mp_up->dynamic_data)
     {
         subscriber->takeNextData((void*)mp_up->m_DynData_in,&mp_up->m_sampleinfo);
         if (mp_up->m_DynData_in->GetUint32Value(0) == mp_up->m_DynData_out->GetUint32Value(0))
@@ -579,9 +628,19 @@ void LatencyTestPublisher::run()
     disc_lock.unlock();
 
     cout << C_B_MAGENTA << "DISCOVERY COMPLETE "<<C_DEF<<endl;
-    printf("Printing round-trip times in us, statistics for %d samples\n",n_samples);
-    printf("   Bytes, Samples,   stdev,    mean,     min,     50%%,     90%%,     99%%,  99.99%%,     max\n");
-    printf("--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,\n");
+    if (hdr_mode_)
+    {
+        printf("Printing round-trip times in us, open loop at %u samples/s during %u s\n", target_rate_,
+            test_duration_);
+        printf("   Bytes,    Sent,Received,   stdev,    mean,     min,     50%%,     90%%,     99%%,   99.9%%,  99.99%%, 99.999%%,     max\n");
+        printf("--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,\n");
+    }
+    else
+    {
+        printf("Printing round-trip times in us, statistics for %d samples\n",n_samples);
+        printf("   Bytes, Samples,   stdev,    mean,     min,     50%%,     90%%,     99%%,  99.99%%,     max\n");
+        printf("--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,\n");
+    }
 
     for(std::vector<uint32_t>::iterator ndata = data_size_pub.begin(); ndata != data_size_pub.end(); ++ndata)
     {
@@ -617,6 +676,12 @@ void LatencyTestPublisher::run()
             prefix = "perf_LatencyTest";
         }
 
+        if (hdr_mode_)
+        {
+            exportHdrStats(prefix, str_reliable);
+            return;
+        }
+
         outFile.open(prefix + "_minimum_" + str_reliable + ".csv");
         outFile << output_file_minimum.str();
         outFile.close();
@@ -701,28 +766,35 @@ bool LatencyTestPublisher::test(uint32_t datasize)
     //cout << endl;
     //BEGIN THE TEST:
 
-    for(unsigned int count = 1; count <= n_samples; ++count)
+    if (hdr_mode_)
     {
-        if (dynamic_data)
-        {
-            m_DynData_in->SetUint32Value(0, 0);
-            m_DynData_out->SetUint32Value(count, 0);
-            t_start_ = std::chrono::steady_clock::now();
-            mp_datapub->write((void*)m_DynData_out);
-        }
-        else
+        runOpenLoop();
+    }
+    else
+    {
+        for(unsigned int count = 1; count <= n_samples; ++count)
         {
-            mp_latency_in->seqnum = 0;
-            mp_latency_out->seqnum = count;
-            t_start_ = std::chrono::steady_clock::now();
-            mp_datapub->write((void*)mp_latency_out);
-        }
+            if (dynamic_data)
+            {
+                m_DynData_in->SetUint32Value(0, 0);
+                m_DynData_out->SetUint32Value(count, 0);
+                t_start_ = std::chrono::steady_clock::now();
+                mp_datapub->write((void*)m_DynData_out);
+            }
+            else
+            {
+                mp_latency_in->seqnum = 0;
+                mp_latency_out->seqnum = count;
+                t_start_ = std::chrono::steady_clock::now();
+                mp_datapub->write((void*)mp_latency_out);
+            }
 
 
-        lock.lock();
-        data_cond_.wait_for(lock, std::chrono::seconds(1), [&]() { return data_count_ > 0; });
-        data_count_ = 0;
-        lock.unlock();
+            lock.lock();
+            data_cond_.wait_for(lock, std::chrono::seconds(1), [&]() { return data_count_ > 0; });
+            data_count_ = 0;
+            lock.unlock();
+        }
     }
 
     command.m_command = STOP;
@@ -737,8 +809,23 @@ bool LatencyTestPublisher::test(uint32_t datasize)
     size_t removed=0;
     mp_datapub->removeAllChange(&removed);
     //cout << "   REMOVED: "<< removed<<endl;
-    analyzeTimes(datasize);
-    printStat(m_stats.back());
+    if (hdr_mode_)
+    {
+        lock.lock();
+        HdrTimeStats TS;
+        TS.nbytes = datasize + 4;
+        TS.sent = intended_times_.size() - 1;
+        TS.received = n_received;
+        TS.histogram = histogram_;
+        m_hdr_stats.push_back(TS);
+        lock.unlock();
+        printHdrStat(m_hdr_stats.back());
+    }
+    else
+    {
+        analyzeTimes(datasize);
+        printStat(m_stats.back());
+    }
 
     if (dynamic_data)
     {
@@ -881,3 +968,130 @@ void LatencyTestPublisher::printStat(TimeStats& TS)
         TS.m_max.count());
 #endif
 }
+
+void LatencyTestPublisher::runOpenLoop()
+{
+    uint64_t total_samples = static_cast<uint64_t>(test_duration_) * target_rate_;
+    std::unique_lock<std::mutex> lock(mutex_);
+    intended_times_.assign(total_samples + 1, std::chrono::steady_clock::time_point());
+    echo_received_.assign(total_samples + 1, false);
+    histogram_.reset();
+    n_received = 0;
+    lock.unlock();
+
+    std::chrono::nanoseconds period(1000000000ULL / target_rate_);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (uint64_t count = 1; count <= total_samples; ++count)
+    {
+        // Samples keep their schedule although previous ones were delayed, so the delays are not hidden.
+        std::chrono::steady_clock::time_point intended = start + period * (count - 1);
+        std::this_thread::sleep_until(intended);
+
+        lock.lock();
+        intended_times_[count] = intended;
+        lock.unlock();
+
+        if (dynamic_data)
+        {
+            m_DynData_out->SetUint32Value(static_cast<uint32_t>(count), 0);
+            mp_datapub->write((void*)m_DynData_out);
+        }
+        else
+        {
+            mp_latency_out->seqnum = static_cast<uint32_t>(count);
+            mp_datapub->write((void*)mp_latency_out);
+        }
+    }
+
+    // Wait for the echoes still on their way. The ones not received are reported as lost.
+    if (reliable_)
+    {
+        // Every sample and echo is eventually delivered, the test duration only bounds a stalled subscriber.
+        mp_datapub->wait_for_all_acked(eprosima::fastrtps::rtps::Time_t(static_cast<int32_t>(test_duration_), 0));
+        lock.lock();
+        data_cond_.wait_for(lock, std::chrono::seconds(test_duration_),
+                [&]() { return n_received >= total_samples; });
+    }
+    else
+    {
+        // Lost samples are not repaired, so the rest arrive within the longest round trip measured.
+        lock.lock();
+        std::chrono::nanoseconds drain(std::max<uint64_t>(2 * histogram_.max(), 100000000ULL));
+        data_cond_.wait_for(lock, drain, [&]() { return n_received >= total_samples; });
+    }
+    lock.unlock();
+}
+
+void LatencyTestPublisher::echoReceived(uint32_t seqnum)
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Only the first echo of each sample is taken into account.
+    if (seqnum == 0 || seqnum >= intended_times_.size() || echo_received_[seqnum])
+    {
+        return;
+    }
+
+    echo_received_[seqnum] = true;
+    histogram_.record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(now - intended_times_[seqnum]).count()));
+
+    if (++n_received == intended_times_.size() - 1)
+    {
+        lock.unlock();
+        data_cond_.notify_one();
+    }
+}
+
+void LatencyTestPublisher::printHdrStat(HdrTimeStats& TS)
+{
+    const LatencyTestHistogram& h = TS.histogram;
+
+#ifdef _WIN32
+    printf("%8I64u,%8I64u,%8I64u,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f \n",
+#else
+    printf("%8" PRIu64 ",%8" PRIu64 ",%8" PRIu64 ",%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f,%8.2f \n",
+#endif
+        TS.nbytes, TS.sent, TS.received, h.stdev() / 1e3, h.mean() / 1e3, h.min() / 1e3,
+        h.value_at_percentile(50) / 1e3, h.value_at_percentile(90) / 1e3, h.value_at_percentile(99) / 1e3,
+        h.value_at_percentile(99.9) / 1e3, h.value_at_percentile(99.99) / 1e3, h.value_at_percentile(99.999) / 1e3,
+        h.max() / 1e3);
+}
+
+void LatencyTestPublisher::exportHdrStats(const std::string& prefix, const std::string& str_reliable)
+{
+    // CSV with the percentile spectrum of every data size, and JSON with the summary and the spectrum.
+    std::ofstream csvFile(prefix + "_hdr_" + str_reliable + ".csv");
+    csvFile << "\"Bytes\",\"Percentile\",\"Latency (us)\"" << std::endl;
+
+    std::ofstream jsonFile(prefix + "_hdr_" + str_reliable + ".json");
+    jsonFile << "{" << std::endl;
+    jsonFile << "  \"reliability\": \"" << str_reliable << "\"," << std::endl;
+    jsonFile << "  \"rate\": " << target_rate_ << "," << std::endl;
+    jsonFile << "  \"duration\": " << test_duration_ << "," << std::endl;
+    jsonFile << "  \"loss\": " << static_cast<uint32_t>(loss_percentage_) << "," << std::endl;
+    jsonFile << "  \"results\": [" << std::endl;
+
+    for (std::vector<HdrTimeStats>::iterator it = m_hdr_stats.begin(); it != m_hdr_stats.end(); ++it)
+    {
+        const LatencyTestHistogram& h = it->histogram;
+        std::vector<std::pair<double, uint64_t>> spectrum = h.percentile_spectrum();
+
+        jsonFile << "    {\"bytes\": " << it->nbytes << ", \"sent\": " << it->sent << ", \"received\": " <<
+            it->received << ", \"min\": " << h.min() / 1e3 << ", \"mean\": " << h.mean() / 1e3 << ", \"stdev\": " <<
+            h.stdev() / 1e3 << ", \"max\": " << h.max() / 1e3 << "," << std::endl;
+        jsonFile << "     \"percentiles\": [";
+        for (size_t i = 0; i < spectrum.size(); ++i)
+        {
+            csvFile << "\"" << it->nbytes << "\",\"" << spectrum[i].first << "\",\"" << spectrum[i].second / 1e3 <<
+                "\"" << std::endl;
+            jsonFile << (i == 0 ? "" : ", ") << "[" << spectrum[i].first << ", " << spectrum[i].second / 1e3 << "]";
+        }
+        jsonFile << "]}" << (it + 1 == m_hdr_stats.end() ? "" : ",") << std::endl;
+    }
+
+    jsonFile << "  ]" << std::endl;
+    jsonFile << "}" << std::endl;
+}
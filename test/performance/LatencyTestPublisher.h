@@ -23,6 +23,7 @@
 #include <asio.hpp>
 
 #include "LatencyTestTypes.h"
+#include "LatencyTestHistogram.h"
 
 #include <condition_variable>
 #include <chrono>
@@ -47,6 +48,16 @@ public:
     double p50, p90, p99, p9999, mean, stdev;
 };
 
+//! Results of an open loop test of a data size.
+class HdrTimeStats{
+public:
+    HdrTimeStats() :nbytes(0), sent(0), received(0){}
+    uint64_t nbytes;
+    uint64_t sent;
+    uint64_t received;
+    LatencyTestHistogram histogram;
+};
+
 class LatencyTestPublisher {
 
 public:
@@ -80,11 +91,16 @@ public:
         const std::string& export_prefix,
         const eprosima::fastrtps::rtps::PropertyPolicy& part_property_policy,
         const eprosima::fastrtps::rtps::PropertyPolicy& property_policy, bool large_data,
-        const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain);
+        const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain, bool hdr, uint32_t duration,
+        uint32_t rate, uint8_t loss);
     void run();
     void analyzeTimes(uint32_t datasize);
     bool test(uint32_t datasize);
     void printStat(TimeStats& TS);
+    void runOpenLoop();
+    void echoReceived(uint32_t seqnum);
+    void printHdrStat(HdrTimeStats& TS);
+    void exportHdrStats(const std::string& prefix, const std::string& str_reliable);
 
     class DataPubListener : public eprosima::fastrtps::PublisherListener
     {
@@ -162,6 +178,16 @@ public:
     eprosima::fastrtps::types::DynamicData* m_DynData_out;
     eprosima::fastrtps::types::DynamicPubSubType m_DynType;
     eprosima::fastrtps::types::DynamicType_ptr m_pDynType;
+    // Open loop mode. Samples are sent at a fixed rate, without waiting for the echo of the previous one, and the
+    // round trip is measured from the time each sample should have been sent, to avoid coordinated omission.
+    bool hdr_mode_;
+    uint32_t test_duration_;
+    uint32_t target_rate_;
+    uint8_t loss_percentage_;
+    std::vector<std::chrono::steady_clock::time_point> intended_times_;
+    std::vector<bool> echo_received_;
+    LatencyTestHistogram histogram_;
+    std::vector<HdrTimeStats> m_hdr_stats;
 };
 
 
@@ -21,6 +21,7 @@
 #include "fastrtps/log/Log.h"
 #include "fastrtps/log/Colors.h"
 #include <fastrtps/xmlparser/XMLProfileManager.h>
+#include <fastrtps/transport/test_UDPv4TransportDescriptor.h>
 
 using namespace eprosima;
 using namespace eprosima::fastrtps;
@@ -66,7 +67,7 @@ LatencyTestSubscriber::~LatencyTestSubscriber()
 
 bool LatencyTestSubscriber::init(bool echo, int nsam, bool reliable, uint32_t pid, bool hostname,
         const PropertyPolicy& part_property_policy, const PropertyPolicy& property_policy, bool large_data,
-        const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain)
+        const std::string& sXMLConfigFile, bool dynamic_types, int forced_domain, uint8_t loss, bool hdr)
 {
     if(!large_data)
     {
@@ -114,6 +115,15 @@ bool LatencyTestSubscriber::init(bool echo, int nsam, bool reliable, uint32_t pi
     PParam.rtps.setName("Participant_sub");
     PParam.rtps.properties = part_property_policy;
 
+    if (loss > 0)
+    {
+        // Lossy loopback through the test transport, which drops the given percentage of DATA submessages.
+        auto testTransport = std::make_shared<test_UDPv4TransportDescriptor>();
+        testTransport->dropDataMessagesPercentage = loss;
+        PParam.rtps.useBuiltinTransports = false;
+        PParam.rtps.userTransports.push_back(testTransport);
+    }
+
     if (m_sXMLConfigFile.length() > 0)
     {
         if (m_forcedDomain >= 0)
@@ -172,6 +182,11 @@ bool LatencyTestSubscriber::init(bool echo, int nsam, bool reliable, uint32_t pi
     {
         PubDataparam.qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
     }
+    if (hdr)
+    {
+        // The open loop publisher does not wait for each echo, so the lost ones must not be overwritten.
+        PubDataparam.topic.historyQos.kind = KEEP_ALL_HISTORY_QOS;
+    }
     PubDataparam.properties = property_policy;
     if (large_data)
     {
@@ -211,6 +226,10 @@ bool LatencyTestSubscriber::init(bool echo, int nsam, bool reliable, uint32_t pi
     {
         SubDataparam.qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
     }
+    if (hdr)
+    {
+        SubDataparam.topic.historyQos.kind = KEEP_ALL_HISTORY_QOS;
+    }
     SubDataparam.properties = property_policy;
     if (large_data)
     {
@@ -0,0 +1,52 @@
+# Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import subprocess, os, sys
+
+command = os.environ.get("DISCOVERY_TEST_BIN")
+
+# Number of participants of each run. The whole scalability sweep can be run with i.e.
+#   DISCOVERY_TEST_SIZES=10,50,100,200,500
+sizes = [int(s) for s in os.environ.get("DISCOVERY_TEST_SIZES", "10,50").split(",")]
+endpoints = os.environ.get("DISCOVERY_TEST_ENDPOINTS", "1")
+processes = int(os.environ.get("DISCOVERY_TEST_PROCESSES", "2"))
+timeout = os.environ.get("DISCOVERY_TEST_TIMEOUT", "120")
+
+common_options = ["--seed", str(os.getpid()), "--hostname", "-m", endpoints, "--timeout=" + timeout, "--export_csv"]
+
+retvalue = 0
+
+for size in sizes:
+    # All the participants in this process.
+    for scenario in ["startup", "late_joiner", "churn"]:
+        proc = subprocess.Popen([command, "-n", str(size), "--scenario=" + scenario,
+            "--export_prefix=perf_DiscoveryTest_%s_%d" % (scenario, size)] + common_options)
+        proc.communicate()
+        if proc.returncode != 0:
+            retvalue = 1
+
+    # Participants split between several processes, communicating through the loopback.
+    if size >= processes:
+        procs = []
+        for p in range(processes):
+            local = size // processes + (1 if p < size % processes else 0)
+            procs.append(subprocess.Popen([command, "-n", str(local), "--total=" + str(size),
+                "--scenario=startup", "--export_prefix=perf_DiscoveryTest_multiprocess_%d_%d" % (size, p)] +
+                common_options))
+        for proc in procs:
+            proc.communicate()
+            if proc.returncode != 0:
+                retvalue = 1
+
+sys.exit(retvalue)
@@ -12,7 +12,41 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
-import shlex, subprocess, time, os, socket, sys
+import shlex, subprocess, time, os, socket, sys, json
+
+# Comparison of the results of two open loop runs (i.e. of two commits):
+#   latency_tests.py compare <baseline.json> <results.json>
+def compare(baseline_file, results_file):
+    with open(baseline_file) as f:
+        baseline = dict((r["bytes"], r) for r in json.load(f)["results"])
+    with open(results_file) as f:
+        results = json.load(f)["results"]
+
+    percentiles = [50.0, 90.0, 99.0, 99.9, 99.99, 100.0]
+
+    def at(result, percentile):
+        # Value of the first reported percentile not below the requested one.
+        for p, value in result["percentiles"]:
+            if p >= percentile:
+                return value
+        return result["max"]
+
+    print("Round-trip times in us (baseline -> results, change)")
+    print("   Bytes," + ",".join("%26s" % ("%g%%" % p) for p in percentiles))
+    for result in results:
+        if result["bytes"] not in baseline:
+            continue
+        base = baseline[result["bytes"]]
+        columns = []
+        for p in percentiles:
+            old, new = at(base, p), at(result, p)
+            change = (new - old) * 100.0 / old if old else 0.0
+            columns.append("%26s" % ("%.2f -> %.2f (%+.1f%%)" % (old, new, change)))
+        print("%8d," % result["bytes"] + ",".join(columns))
+
+if len(sys.argv) == 4 and sys.argv[1] == "compare":
+    compare(sys.argv[2], sys.argv[3])
+    quit()
 
 command = os.environ.get("LATENCY_TEST_BIN")
 certs_path = os.environ.get("CERTS_PATH")
@@ -22,6 +56,36 @@ security_options = []
 if certs_path:
     security_options = ["--security=true", "--certs=" + certs_path]
 
+# Open loop mode, reporting the full percentile spectrum. Results are exported to <prefix>_hdr_<reliability>.json,
+# and compared with the ones of the same name in LATENCY_TEST_BASELINE directory, if given.
+if os.environ.get("LATENCY_TEST_HDR"):
+    duration = os.environ.get("LATENCY_TEST_DURATION", "2")
+    rate = os.environ.get("LATENCY_TEST_RATE", "1000")
+    loss = os.environ.get("LATENCY_TEST_LOSS", "10")
+    baseline_dir = os.environ.get("LATENCY_TEST_BASELINE")
+
+    scenarios = [
+        ("perf_LatencyTest", "besteffort", []),
+        ("perf_LatencyTest", "reliable", []),
+        ("perf_LatencyTest_loss", "reliable", ["--loss=" + loss]),
+    ]
+
+    for prefix, reliability, extra_options in scenarios:
+        subscriber_proc = subprocess.Popen([command, "subscriber", "-r", reliability, "--seed", str(os.getpid()),
+            "--hostname", "--hdr"] + extra_options + security_options)
+        publisher_proc = subprocess.Popen([command, "publisher", "-r", reliability, "--seed", str(os.getpid()),
+            "--hostname", "--hdr", "--duration=" + duration, "--rate=" + rate, "--export_csv",
+            "--export_prefix=" + prefix] + extra_options + security_options)
+
+        subscriber_proc.communicate()
+        publisher_proc.communicate()
+
+        results_file = prefix + "_hdr_" + reliability + ".json"
+        if baseline_dir and os.path.isfile(os.path.join(baseline_dir, results_file)):
+            compare(os.path.join(baseline_dir, results_file), results_file)
+
+    quit()
+
 # Best effort
 subscriber_proc = subprocess.Popen([command, "subscriber", "--seed", str(os.getpid()), "--hostname"] +
         security_options)
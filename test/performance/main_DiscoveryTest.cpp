@@ -0,0 +1,276 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "DiscoveryTest.h"
+
+#include "optionparser.h"
+
+#include <stdio.h>
+#include <string>
+#include <iostream>
+#include <cstdint>
+
+#include <fastrtps/log/Log.h>
+#include <fastrtps/Domain.h>
+
+#if defined(_MSC_VER)
+#pragma warning (push)
+#pragma warning (disable:4512)
+#endif
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+struct Arg: public option::Arg
+{
+    static void printError(const char* msg1, const option::Option& opt, const char* msg2)
+    {
+        fprintf(stderr, "%s", msg1);
+        fwrite(opt.name, opt.namelen, 1, stderr);
+        fprintf(stderr, "%s", msg2);
+    }
+
+    static option::ArgStatus Unknown(const option::Option& option, bool msg)
+    {
+        if (msg) printError("Unknown option '", option, "'\n");
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Required(const option::Option& option, bool msg)
+    {
+        if (option.arg != 0 && option.arg[0] != 0)
+        return option::ARG_OK;
+
+        if (msg) printError("Option '", option, "' requires an argument\n");
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus Numeric(const option::Option& option, bool msg)
+    {
+        char* endptr = 0;
+        if (option.arg != 0 && strtol(option.arg, &endptr, 10))
+        {
+        }
+        if (endptr != option.arg && *endptr == 0)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            printError("Option '", option, "' requires a numeric argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus String(const option::Option& option, bool msg)
+    {
+        if (option.arg != 0)
+        {
+            return option::ARG_OK;
+        }
+        if (msg)
+        {
+            printError("Option '", option, "' requires an argument\n");
+        }
+        return option::ARG_ILLEGAL;
+    }
+};
+
+enum  optionIndex {
+    UNKNOWN_OPT,
+    HELP,
+    PARTICIPANTS,
+    TOTAL_PARTICIPANTS,
+    ENDPOINTS,
+    SCENARIO,
+    CHURN_PARTICIPANTS,
+    CHURN_CYCLES,
+    TIMEOUT,
+    SEED,
+    HOSTNAME,
+    EXPORT_CSV,
+    EXPORT_PREFIX
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0,"", "",                    Arg::None,      "Usage: DiscoveryTest [options]\n\nGeneral options:" },
+    { HELP,    0,"h", "help",                   Arg::None,      "  -h \t--help  \tProduce help message." },
+    { PARTICIPANTS,0,"n","participants",        Arg::Numeric,   "  -n <num>, \t--participants=<num>  \tParticipants created by this process (default 10)." },
+    { TOTAL_PARTICIPANTS,0,"","total",          Arg::Numeric,   "  \t--total=<num>  \tParticipants of all the processes of the test (default, the local ones)." },
+    { ENDPOINTS,0,"m","endpoints",              Arg::Numeric,   "  -m <num>, \t--endpoints=<num>  \tPublishers, and subscribers, of each participant (default 1)." },
+    { SCENARIO,0,"","scenario",                 Arg::Required,  "  \t--scenario=<arg>  \tScenario (\"startup\"/\"late_joiner\"/\"churn\")." },
+    { CHURN_PARTICIPANTS,0,"","churn",          Arg::Numeric,   "  \t--churn=<num>  \tParticipants replaced on each churn cycle (default 10% of them)." },
+    { CHURN_CYCLES,0,"","cycles",               Arg::Numeric,   "  \t--cycles=<num>  \tChurn cycles (default 3)." },
+    { TIMEOUT,0,"","timeout",                   Arg::Numeric,   "  \t--timeout=<s>  \tMaximum time for each phase to complete (default 60)." },
+    { SEED,0,"","seed",                         Arg::Numeric,   "  \t--seed=<num>  \tSeed to calculate domain and topic, to isolate test." },
+    { HOSTNAME,0,"","hostname",                 Arg::None,      "" },
+    { EXPORT_CSV,0,"","export_csv",             Arg::None,      "" },
+    { EXPORT_PREFIX,0,"","export_prefix",       Arg::String,    "\t--export_prefix \tFile prefix for the CSV file." },
+
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+int main(int argc, char** argv)
+{
+    int columns;
+
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+#endif
+
+    uint32_t participants = 10;
+    uint32_t total_participants = 0;
+    uint32_t endpoints = 1;
+    DiscoveryTestScenario scenario = STARTUP_SCENARIO;
+    uint32_t churn_participants = 0;
+    uint32_t churn_cycles = 3;
+    uint32_t timeout = 60;
+    uint32_t seed = 80;
+    bool hostname = false;
+    bool export_csv = false;
+    std::string export_prefix = "";
+
+    argc -= (argc > 0);
+    argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        switch (opt.index())
+        {
+            case HELP:
+                // not possible, because handled further above and exits the program
+                break;
+            case PARTICIPANTS:
+                participants = strtol(opt.arg, nullptr, 10);
+                break;
+            case TOTAL_PARTICIPANTS:
+                total_participants = strtol(opt.arg, nullptr, 10);
+                break;
+            case ENDPOINTS:
+                endpoints = strtol(opt.arg, nullptr, 10);
+                break;
+            case SCENARIO:
+                if (strcmp(opt.arg, "startup") == 0)
+                {
+                    scenario = STARTUP_SCENARIO;
+                }
+                else if (strcmp(opt.arg, "late_joiner") == 0)
+                {
+                    scenario = LATE_JOINER_SCENARIO;
+                }
+                else if (strcmp(opt.arg, "churn") == 0)
+                {
+                    scenario = CHURN_SCENARIO;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                break;
+            case CHURN_PARTICIPANTS:
+                churn_participants = strtol(opt.arg, nullptr, 10);
+                break;
+            case CHURN_CYCLES:
+                churn_cycles = strtol(opt.arg, nullptr, 10);
+                break;
+            case TIMEOUT:
+                timeout = strtol(opt.arg, nullptr, 10);
+                break;
+            case SEED:
+                seed = strtol(opt.arg, nullptr, 10);
+                break;
+            case HOSTNAME:
+                hostname = true;
+                break;
+            case EXPORT_CSV:
+                export_csv = true;
+                break;
+            case EXPORT_PREFIX:
+                if (opt.arg != nullptr)
+                {
+                    export_prefix = opt.arg;
+                }
+                else
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                break;
+            case UNKNOWN_OPT:
+                option::printUsage(fwrite, stdout, usage, columns);
+                return 0;
+                break;
+        }
+    }
+
+    if (churn_participants == 0)
+    {
+        churn_participants = participants / 10;
+    }
+
+    int result = 1;
+    {
+        DiscoveryTest discoveryTest;
+        if (discoveryTest.init(participants, total_participants, endpoints, seed, hostname, export_csv,
+                export_prefix) &&
+            discoveryTest.run(scenario, churn_participants, churn_cycles, timeout))
+        {
+            result = 0;
+        }
+    }
+
+    Domain::stopAll();
+    Log::Reset();
+
+    if (result == 0)
+    {
+        std::cout << "EVERYTHING STOPPED FINE" << std::endl;
+    }
+
+    return result;
+}
+
+#if defined(_MSC_VER)
+#pragma warning (pop)
+#endif
@@ -122,7 +122,11 @@ enum  optionIndex {
     LARGE_DATA,
     XML_FILE,
     DYNAMIC_TYPES,
-    FORCED_DOMAIN
+    FORCED_DOMAIN,
+    HDR,
+    DURATION,
+    RATE,
+    LOSS
 };
 
 const option::Descriptor usage[] = {
@@ -146,6 +150,11 @@ const option::Descriptor usage[] = {
     { XML_FILE, 0, "", "xml",               Arg::String,    "\t--xml \tXML Configuration file." },
     { FORCED_DOMAIN, 0, "", "domain",       Arg::Numeric,   "\t--RTPS Domain." },
     { DYNAMIC_TYPES, 0, "", "dynamic_types",Arg::None,      "\t--dynamic_types \tUse dynamic types." },
+    { LOSS, 0, "", "loss",                  Arg::Numeric,   "\t--loss=<percent> \tDrop this percentage of DATA messages with the test transport." },
+    { UNKNOWN_OPT, 0,"", "",                Arg::None,      "\nOpen loop options:"},
+    { HDR, 0, "", "hdr",                    Arg::None,      "\t--hdr \tSend at a fixed rate and report the full percentile spectrum. Needed by both sides." },
+    { DURATION, 0, "", "duration",          Arg::Numeric,   "\t--duration=<s> \tDuration of the test of each data size (default 10)." },
+    { RATE, 0, "", "rate",                  Arg::Numeric,   "\t--rate=<num> \tSamples sent per second (default 1000)." },
 
     { 0, 0, 0, 0, 0, 0 }
 };
@@ -189,6 +198,10 @@ int main(int argc, char** argv)
     std::string sXMLConfigFile = "";
     bool dynamic_types = false;
     int forced_domain = -1;
+    bool hdr = false;
+    uint32_t duration = 10;
+    uint32_t rate = 1000;
+    uint8_t loss = 0;
 
     argc -= (argc > 0);
     argv += (argc > 0); // skip program name argv[0] if present
@@ -323,6 +336,26 @@ int main(int argc, char** argv)
             case FORCED_DOMAIN:
                 forced_domain = strtol(opt.arg, nullptr, 10);
                 break;
+            case HDR:
+                hdr = true;
+                break;
+            case DURATION:
+                duration = strtol(opt.arg, nullptr, 10);
+                break;
+            case RATE:
+                rate = strtol(opt.arg, nullptr, 10);
+                break;
+            case LOSS:
+            {
+                long percentage = strtol(opt.arg, nullptr, 10);
+                if (percentage < 0 || percentage > 100)
+                {
+                    option::printUsage(fwrite, stdout, usage, columns);
+                    return 0;
+                }
+                loss = static_cast<uint8_t>(percentage);
+                break;
+            }
 
 #if HAVE_SECURITY
             case USE_SECURITY:
@@ -405,16 +438,21 @@ int main(int argc, char** argv)
     {
         cout << "Performing test with " << sub_number << " subscribers and " << n_samples << " samples" << endl;
         LatencyTestPublisher latencyPub;
-        latencyPub.init(sub_number, n_samples, reliable, seed, hostname, export_csv, export_prefix,
-            pub_part_property_policy, pub_property_policy, large_data, sXMLConfigFile, dynamic_types, forced_domain);
-        latencyPub.run();
+        if (latencyPub.init(sub_number, n_samples, reliable, seed, hostname, export_csv, export_prefix,
+            pub_part_property_policy, pub_property_policy, large_data, sXMLConfigFile, dynamic_types, forced_domain,
+            hdr, duration, rate, loss))
+        {
+            latencyPub.run();
+        }
     }
     else
     {
         LatencyTestSubscriber latencySub;
-        latencySub.init(echo, n_samples, reliable, seed, hostname, sub_part_property_policy, sub_property_policy,
-            large_data, sXMLConfigFile, dynamic_types, forced_domain);
-        latencySub.run();
+        if (latencySub.init(echo, n_samples, reliable, seed, hostname, sub_part_property_policy, sub_property_policy,
+            large_data, sXMLConfigFile, dynamic_types, forced_domain, loss, hdr))
+        {
+            latencySub.run();
+        }
     }
 
     eClock::my_sleep(1000);
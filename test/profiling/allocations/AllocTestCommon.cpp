@@ -162,5 +162,25 @@ void print_results(const std::string& file_prefix, const std::string& entity, co
     outFile.close();
 }
 
+/**
+ * Check that no memory operations were performed while exchanging the samples after the first one.
+ */
+bool check_steady_state()
+{
+    // Phase 2 goes from the first sample exchanged to the last one.
+    size_t allocs = g_allocations[2].load();
+    size_t deallocs = g_deallocations[2].load();
+
+    if(allocs != 0 || deallocs != 0)
+    {
+        std::cerr << "Steady state performed " << allocs << " allocations and " << deallocs <<
+            " deallocations" << std::endl;
+        return false;
+    }
+
+    std::cout << "Steady state performed no memory operations" << std::endl;
+    return true;
+}
+
 }   // namespace eprosima_profiling
 
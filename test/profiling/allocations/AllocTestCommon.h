@@ -67,6 +67,12 @@ void undiscovery_finished();
  */
 void print_results(const std::string& file_prefix, const std::string& entity, const std::string& config);
 
+/**
+ * Check that no memory operations were performed while exchanging the samples after the first one.
+ * @return true when the steady state of the data exchange did not allocate nor deallocate memory.
+ */
+bool check_steady_state();
+
 }   // namespace eprosima_profiling
 
 #endif   // FASTRTPS_TEST_PROFILING_ALLOCATIONS_ALLOCTESTCOMMON_H_
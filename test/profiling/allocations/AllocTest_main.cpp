@@ -19,6 +19,7 @@
 
 #include "AllocTestPublisher.h"
 #include "AllocTestSubscriber.h"
+#include "AllocTestCommon.h"
 
 #include <fastrtps/Domain.h>
 
@@ -34,6 +35,7 @@ int main(int argc, char** argv)
     int type = 1;
     int domain = 1;
     bool wait_unmatch = false;
+    bool check_steady_state = false;
     const char* profile = "tl_be";
     std::string outputFile = "";
     if(argc > 2)
@@ -55,6 +57,8 @@ int main(int argc, char** argv)
         {
             outputFile = argv[5];
         }
+
+        check_steady_state = (argc > 6) && (strcmp(argv[6], "true") == 0);
     }
     else
     {
@@ -72,6 +76,7 @@ int main(int argc, char** argv)
     }
 
 
+    int result = 0;
     switch(type)
     {
         case 1:
@@ -80,6 +85,10 @@ int main(int argc, char** argv)
                 if(mypub.init(profile, domain, outputFile))
                 {
                     mypub.run(60, wait_unmatch);
+                    if(check_steady_state && !eprosima_profiling::check_steady_state())
+                    {
+                        result = 1;
+                    }
                 }
                 break;
             }
@@ -89,11 +98,15 @@ int main(int argc, char** argv)
                 if(mysub.init(profile, domain, outputFile))
                 {
                     mysub.run(wait_unmatch);
+                    if(check_steady_state && !eprosima_profiling::check_steady_state())
+                    {
+                        result = 1;
+                    }
                 }
                 break;
             }
     }
     Domain::stopAll();
     Log::Reset();
-    return 0;
+    return result;
 }
@@ -0,0 +1,59 @@
+# Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Runs the allocation test for every entity and profile, checking that the steady state performs no memory
+# operations. The profiled entity is run with the memory tools preloaded, and its counterpart without them.
+
+import os, subprocess, sys
+
+alloc_test = os.environ.get("ALLOCTEST_BIN")
+# Environment variable preloading the memory tools, as NAME=value.
+preload = os.environ.get("MEMORY_TOOLS_PRELOAD")
+
+if not alloc_test:
+    alloc_test = "./AllocationTest"
+
+# Without the memory tools no operation is accounted, and the check would always pass.
+if not preload:
+    print("MEMORY_TOOLS_PRELOAD is not set")
+    sys.exit(1)
+
+profiles = ["tl_be", "tl_re", "vo_be", "vo_re"]
+domain = str(os.getpid() % 230)
+
+def run_test(entity, counterpart, profile):
+    env = os.environ.copy()
+    if preload:
+        name, value = preload.split("=", 1)
+        env[name] = value
+
+    output_file = "alloc_test_" + entity + "_" + profile + ".csv"
+    profiled = subprocess.Popen([alloc_test, entity, profile, "true", domain, output_file, "true"], env=env)
+    other = subprocess.Popen([alloc_test, counterpart, profile, "false", domain])
+
+    other.communicate()
+    profiled.communicate()
+
+    if profiled.returncode != 0 or other.returncode != 0:
+        print("Allocation test of " + entity + " with profile " + profile + " failed")
+        return False
+
+    return True
+
+result = True
+for profile in profiles:
+    result &= run_test("publisher", "subscriber", profile)
+    result &= run_test("subscriber", "publisher", profile)
+
+sys.exit(0 if result else 1)
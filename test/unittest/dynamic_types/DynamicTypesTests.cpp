@@ -4855,6 +4855,74 @@ TEST_F(DynamicTypesTests, DynamicType_bounded_wstring_unit_tests)
     }
 }
 
+TEST_F(DynamicTypesTests, DynamicType_key_from_payload_unit_tests)
+{
+    DynamicTypeBuilder_ptr key_builder = DynamicTypeBuilderFactory::GetInstance()->CreateInt32Builder();
+    ASSERT_TRUE(key_builder->ApplyAnnotation(ANNOTATION_KEY_ID, "true") == ResponseCode::RETCODE_OK);
+    DynamicTypeBuilder_ptr string_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStringBuilder();
+    DynamicTypeBuilder_ptr int64_builder = DynamicTypeBuilderFactory::GetInstance()->CreateInt64Builder();
+    DynamicTypeBuilder_ptr seq_builder = DynamicTypeBuilderFactory::GetInstance()->CreateSequenceBuilder(
+        int64_builder.get());
+
+    // The key is placed after members of variable size, which have to be skipped to reach it.
+    DynamicTypeBuilder_ptr struct_builder = DynamicTypeBuilderFactory::GetInstance()->CreateStructBuilder();
+    ASSERT_TRUE(struct_builder->AddMember(0, "text", string_builder.get()) == ResponseCode::RETCODE_OK);
+    ASSERT_TRUE(struct_builder->AddMember(1, "values", seq_builder.get()) == ResponseCode::RETCODE_OK);
+    ASSERT_TRUE(struct_builder->AddMember(2, "id", key_builder.get()) == ResponseCode::RETCODE_OK);
+    ASSERT_TRUE(struct_builder->ApplyAnnotationToMember(2, ANNOTATION_KEY_ID, "true") == ResponseCode::RETCODE_OK);
+    DynamicType_ptr struct_type = struct_builder->Build();
+    ASSERT_TRUE(struct_type != nullptr);
+
+    DynamicPubSubType pubsubType(struct_type);
+    DynamicData* data = DynamicDataFactory::GetInstance()->CreateData(struct_type);
+    ASSERT_TRUE(data->SetStringValue("first sample", 0) == ResponseCode::RETCODE_OK);
+    DynamicData* values = data->LoanValue(1);
+    ASSERT_TRUE(values != nullptr);
+    MemberId newId;
+    ASSERT_TRUE(values->InsertSequenceData(newId) == ResponseCode::RETCODE_OK);
+    ASSERT_TRUE(values->SetInt64Value(12, newId) == ResponseCode::RETCODE_OK);
+    ASSERT_TRUE(data->ReturnLoanedValue(values) == ResponseCode::RETCODE_OK);
+    ASSERT_TRUE(data->SetInt32Value(7, 2) == ResponseCode::RETCODE_OK);
+
+    uint32_t payloadSize = static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(data)());
+    SerializedPayload_t payload(payloadSize);
+    ASSERT_TRUE(pubsubType.serialize(data, &payload));
+
+    // The key obtained from the payload is the same as the one of the sample.
+    rtps::InstanceHandle_t handle, payload_handle;
+    ASSERT_TRUE(pubsubType.getKey(data, &handle));
+    ASSERT_TRUE(pubsubType.getKeyFromPayload(&payload, &payload_handle));
+    ASSERT_TRUE(handle.isDefined());
+    ASSERT_TRUE(handle == payload_handle);
+
+    rtps::InstanceHandle_t md5_handle, md5_payload_handle;
+    ASSERT_TRUE(pubsubType.getKey(data, &md5_handle, true));
+    ASSERT_TRUE(pubsubType.getKeyFromPayload(&payload, &md5_payload_handle, true));
+    ASSERT_TRUE(md5_handle == md5_payload_handle);
+
+    // Changing members out of the key keeps the instance.
+    ASSERT_TRUE(data->SetStringValue("a longer second sample", 0) == ResponseCode::RETCODE_OK);
+    SerializedPayload_t payload2(static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(data)()));
+    ASSERT_TRUE(pubsubType.serialize(data, &payload2));
+    ASSERT_TRUE(pubsubType.getKeyFromPayload(&payload2, &payload_handle));
+    ASSERT_TRUE(handle == payload_handle);
+
+    // Changing the key changes the instance.
+    ASSERT_TRUE(data->SetInt32Value(8, 2) == ResponseCode::RETCODE_OK);
+    SerializedPayload_t payload3(static_cast<uint32_t>(pubsubType.getSerializedSizeProvider(data)()));
+    ASSERT_TRUE(pubsubType.serialize(data, &payload3));
+    ASSERT_TRUE(pubsubType.getKeyFromPayload(&payload3, &payload_handle));
+    ASSERT_FALSE(handle == payload_handle);
+    ASSERT_TRUE(pubsubType.getKey(data, &handle));
+    ASSERT_TRUE(handle == payload_handle);
+
+    // A truncated payload is not read beyond its length.
+    payload3.length = 8;
+    ASSERT_FALSE(pubsubType.getKeyFromPayload(&payload3, &payload_handle));
+
+    ASSERT_TRUE(DynamicDataFactory::GetInstance()->DeleteData(data) == ResponseCode::RETCODE_OK);
+}
+
 int main(int argc, char **argv)
 {
     Log::SetVerbosity(Log::Info);
@@ -0,0 +1,95 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/qos/QosPolicies.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+static PartitionQosPolicy partitions(const std::vector<std::string>& names)
+{
+    PartitionQosPolicy policy;
+    for(const std::string& name : names)
+    {
+        policy.push_back(name.c_str());
+    }
+    return policy;
+}
+
+TEST(PartitionQosPolicyTests, default_partition)
+{
+    PartitionQosPolicy empty;
+
+    ASSERT_TRUE(empty.matches(PartitionQosPolicy()));
+
+    // The default partition is the empty name, which is not matched by wildcards.
+    ASSERT_TRUE(empty.matches(partitions({""})));
+    ASSERT_TRUE(partitions({"A", ""}).matches(empty));
+    ASSERT_FALSE(empty.matches(partitions({"A"})));
+    ASSERT_FALSE(partitions({"*"}).matches(empty));
+}
+
+TEST(PartitionQosPolicyTests, exact_names)
+{
+    PartitionQosPolicy policy = partitions({"A", "B", "C"});
+
+    ASSERT_TRUE(policy.matches(partitions({"B"})));
+    ASSERT_TRUE(partitions({"X", "C"}).matches(policy));
+    ASSERT_FALSE(policy.matches(partitions({"D", "E", "F", "G"})));
+    ASSERT_FALSE(policy.matches(partitions({"a"})));
+    ASSERT_FALSE(policy.matches(partitions({"AB"})));
+}
+
+TEST(PartitionQosPolicyTests, wildcards_on_either_side)
+{
+    PartitionQosPolicy names = partitions({"sensors/front", "actuators"});
+
+    ASSERT_TRUE(names.matches(partitions({"sensors/*"})));
+    ASSERT_TRUE(partitions({"sensors/*"}).matches(names));
+    ASSERT_TRUE(names.matches(partitions({"act?ators"})));
+    ASSERT_TRUE(names.matches(partitions({"*"})));
+    ASSERT_TRUE(names.matches(partitions({"x", "y", "*front"})));
+    ASSERT_FALSE(names.matches(partitions({"sensors/rear*"})));
+    ASSERT_FALSE(names.matches(partitions({"?"})));
+}
+
+TEST(PartitionQosPolicyTests, names_changes_update_matching)
+{
+    PartitionQosPolicy policy = partitions({"A"});
+    PartitionQosPolicy copy(policy);
+
+    std::vector<std::string> names{"B", "C*"};
+    policy.setNames(names);
+
+    ASSERT_FALSE(policy.matches(partitions({"A"})));
+    ASSERT_TRUE(policy.matches(partitions({"CD"})));
+
+    // Copies keep their own compiled names.
+    ASSERT_TRUE(copy.matches(partitions({"A"})));
+    ASSERT_FALSE(copy.matches(partitions({"CD"})));
+
+    policy.clear();
+    ASSERT_TRUE(policy.getNames().empty());
+    ASSERT_TRUE(policy.matches(PartitionQosPolicy()));
+    ASSERT_FALSE(policy.matches(partitions({"B"})));
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,97 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/builtin/data/SerializedParticipantData.h>
+#include <fastrtps/rtps/builtin/data/ParticipantProxyData.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+class SerializedParticipantDataTests : public ::testing::Test
+{
+    protected:
+
+        SerializedParticipantDataTests()
+        {
+            data_.m_guid.guidPrefix.value[0] = 1;
+            data_.m_participantName = "participant";
+        }
+
+        //! Serialize the participant data without the cache.
+        std::vector<octet> serialize(Endianness_t endian)
+        {
+            CDRMessage_t msg;
+            msg.msg_endian = endian;
+            EXPECT_TRUE(data_.writeToCDRMessage(&msg, false));
+            return std::vector<octet>(msg.buffer, msg.buffer + msg.length);
+        }
+
+        std::vector<octet> copy(Endianness_t endian)
+        {
+            CDRMessage_t msg(0);
+            EXPECT_TRUE(serialized_.copy_to(data_, endian, msg));
+            EXPECT_EQ(msg.msg_endian, endian);
+            return std::vector<octet>(msg.buffer, msg.buffer + msg.length);
+        }
+
+        ParticipantProxyData data_;
+        SerializedParticipantData serialized_;
+};
+
+TEST_F(SerializedParticipantDataTests, CopiesSerializedData)
+{
+    std::vector<octet> expected = serialize(BIGEND);
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(copy(BIGEND), expected);
+
+    // A buffer already big enough is reused.
+    CDRMessage_t msg(static_cast<uint32_t>(expected.size()) * 2);
+    octet* buffer = msg.buffer;
+    ASSERT_TRUE(serialized_.copy_to(data_, BIGEND, msg));
+    ASSERT_EQ(msg.buffer, buffer);
+    ASSERT_EQ(std::vector<octet>(msg.buffer, msg.buffer + msg.length), expected);
+}
+
+TEST_F(SerializedParticipantDataTests, KeepsSerializationUntilInvalidated)
+{
+    std::vector<octet> first = copy(BIGEND);
+
+    // Updates not notified are not seen.
+    data_.m_participantName = "renamed participant";
+    ASSERT_EQ(copy(BIGEND), first);
+
+    serialized_.invalidate();
+    std::vector<octet> second = copy(BIGEND);
+    ASSERT_NE(second, first);
+    ASSERT_EQ(second, serialize(BIGEND));
+}
+
+TEST_F(SerializedParticipantDataTests, SerializesAgainOnEndiannessChange)
+{
+    std::vector<octet> big = copy(BIGEND);
+    std::vector<octet> little = copy(LITTLEEND);
+
+    ASSERT_EQ(little, serialize(LITTLEEND));
+    ASSERT_NE(little, big);
+    ASSERT_EQ(copy(BIGEND), big);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,165 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/flowcontrol/FairShareController.h>
+#include <fastrtps/rtps/writer/ReaderLocator.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace std;
+using namespace eprosima::fastrtps::rtps;
+
+static const unsigned int testPayloadSize = 1000;
+static const unsigned int controllerSize = 8000;
+static const unsigned int periodMillisecs = 100;
+static const unsigned int numberOfTestChanges = 10;
+
+static const ThroughputControllerDescriptor testDescriptor = {controllerSize, periodMillisecs};
+
+class FairShareControllerTests: public ::testing::Test
+{
+   public:
+
+   FairShareControllerTests():
+      sController(testDescriptor, (const RTPSParticipantImpl*)nullptr)
+   {
+      bulkWriter.entityId.value[3] = 1;
+      commandWriter.entityId.value[3] = 2;
+
+      for (unsigned int i = 0; i < numberOfTestChanges; i++)
+      {
+         bulkChanges.emplace_back(new CacheChange_t(testPayloadSize));
+         bulkChanges.back()->writerGUID = bulkWriter;
+         bulkChanges.back()->sequenceNumber = {0, i+1};
+         bulkChanges.back()->serializedPayload.length = testPayloadSize;
+
+         commandChanges.emplace_back(new CacheChange_t(testPayloadSize));
+         commandChanges.back()->writerGUID = commandWriter;
+         commandChanges.back()->sequenceNumber = {0, i+1};
+         commandChanges.back()->serializedPayload.length = testPayloadSize;
+      }
+   }
+
+   void fill(RTPSWriterCollector<ReaderLocator*>& collector, std::vector<std::unique_ptr<CacheChange_t>>& changes)
+   {
+      collector.clear();
+      for (auto& change : changes)
+      {
+         collector.add_change(change.get(), &mock, FragmentNumberSet_t());
+      }
+   }
+
+   FairShareController sController;
+   ReaderLocator mock;
+   GUID_t bulkWriter;
+   GUID_t commandWriter;
+   std::vector<std::unique_ptr<CacheChange_t>> bulkChanges;
+   std::vector<std::unique_ptr<CacheChange_t>> commandChanges;
+   RTPSWriterCollector<ReaderLocator*> bulkChangesForUse;
+   RTPSWriterCollector<ReaderLocator*> commandChangesForUse;
+};
+
+TEST_F(FairShareControllerTests, writer_without_contenders_uses_the_whole_budget)
+{
+   // When
+   fill(bulkChangesForUse, bulkChanges);
+   sController(bulkChangesForUse);
+
+   // Then
+   ASSERT_EQ(controllerSize / testPayloadSize, bulkChangesForUse.size());
+
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+TEST_F(FairShareControllerTests, backlogged_writers_share_the_budget_by_weight)
+{
+   // Given
+   sController.add_writer(bulkWriter, FlowSchedulingDescriptor(1, 0));
+   sController.add_writer(commandWriter, FlowSchedulingDescriptor(3, 0));
+
+   // The bulk writer takes the whole budget, so the command writer gets backlogged.
+   fill(bulkChangesForUse, bulkChanges);
+   sController(bulkChangesForUse);
+   ASSERT_EQ(8u, bulkChangesForUse.size());
+   fill(commandChangesForUse, commandChanges);
+   sController(commandChangesForUse);
+   ASSERT_EQ(0u, commandChangesForUse.size());
+
+   // When
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+
+   // Then the bulk writer only gets its share, and the command writer gets the rest.
+   fill(bulkChangesForUse, bulkChanges);
+   sController(bulkChangesForUse);
+   EXPECT_EQ(2u, bulkChangesForUse.size());
+   fill(commandChangesForUse, commandChanges);
+   sController(commandChangesForUse);
+   EXPECT_EQ(6u, commandChangesForUse.size());
+
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+TEST_F(FairShareControllerTests, backlogged_writer_with_higher_priority_is_served_first)
+{
+   // Given
+   sController.add_writer(bulkWriter, FlowSchedulingDescriptor(1, 0));
+   sController.add_writer(commandWriter, FlowSchedulingDescriptor(1, 10));
+
+   fill(commandChangesForUse, commandChanges);
+   sController(commandChangesForUse);
+   ASSERT_EQ(8u, commandChangesForUse.size());
+
+   // When
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+
+   // Then the bulk writer is not served while the command writer is backlogged.
+   fill(bulkChangesForUse, bulkChanges);
+   sController(bulkChangesForUse);
+   EXPECT_EQ(0u, bulkChangesForUse.size());
+   fill(commandChangesForUse, commandChanges);
+   sController(commandChangesForUse);
+   EXPECT_EQ(8u, commandChangesForUse.size());
+
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+TEST_F(FairShareControllerTests, removed_writer_does_not_block_the_rest)
+{
+   // Given
+   sController.add_writer(bulkWriter, FlowSchedulingDescriptor(1, 0));
+   sController.add_writer(commandWriter, FlowSchedulingDescriptor(1, 10));
+
+   fill(commandChangesForUse, commandChanges);
+   sController(commandChangesForUse);
+   ASSERT_EQ(8u, commandChangesForUse.size());
+
+   // When
+   sController.remove_writer(commandWriter);
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+
+   // Then
+   fill(bulkChangesForUse, bulkChanges);
+   sController(bulkChangesForUse);
+   EXPECT_EQ(8u, bulkChangesForUse.size());
+
+   std::this_thread::sleep_for(std::chrono::milliseconds(periodMillisecs + 50));
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,222 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/rtps/common/CacheChange.h>
+#include <CacheChangeFreeList.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+TEST(CacheChangeFreeList, EmptyAndFull)
+{
+    std::vector<CacheChange_t> changes(4);
+    CacheChangeFreeList free_list(256, 4);
+
+    ASSERT_EQ(free_list.payload_size(), 256u);
+    ASSERT_EQ(free_list.pop(), nullptr);
+
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(free_list.push(&change));
+    }
+    ASSERT_FALSE(free_list.push(&changes[0]));
+
+    // Changes are returned in the same order they were pushed.
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_EQ(free_list.pop(), &change);
+    }
+    ASSERT_EQ(free_list.pop(), nullptr);
+}
+
+TEST(CacheChangeFreeList, CapacityRoundedToPowerOfTwo)
+{
+    std::vector<CacheChange_t> changes(4);
+
+    CacheChangeFreeList three(256, 3);
+    for (CacheChange_t& change : changes)
+    {
+        ASSERT_TRUE(three.push(&change));
+    }
+    ASSERT_FALSE(three.push(&changes[0]));
+
+    // At least two cells are used.
+    CacheChangeFreeList one(256, 1);
+    ASSERT_TRUE(one.push(&changes[0]));
+    ASSERT_TRUE(one.push(&changes[1]));
+    ASSERT_FALSE(one.push(&changes[2]));
+}
+
+TEST(CacheChangeFreeList, WrapAround)
+{
+    std::vector<CacheChange_t> changes(3);
+    CacheChangeFreeList free_list(256, 4);
+
+    // Each lap starts on a different cell, so cells are reused many times.
+    for (size_t lap = 0; lap < 100; ++lap)
+    {
+        for (CacheChange_t& change : changes)
+        {
+            ASSERT_TRUE(free_list.push(&change));
+        }
+        for (CacheChange_t& change : changes)
+        {
+            ASSERT_EQ(free_list.pop(), &change);
+        }
+        ASSERT_EQ(free_list.pop(), nullptr);
+    }
+
+    // Filling it after the wrap around still honours the capacity.
+    for (size_t i = 0; i < 4; ++i)
+    {
+        ASSERT_TRUE(free_list.push(&changes[i % changes.size()]));
+    }
+    ASSERT_FALSE(free_list.push(&changes[0]));
+}
+
+TEST(CacheChangeFreeList, ConcurrentProducersAndConsumers)
+{
+    const size_t num_threads = 4;
+    const size_t changes_per_producer = 10000;
+
+    std::vector<CacheChange_t> changes(num_threads * changes_per_producer);
+    std::vector<std::atomic<int>> times_popped(changes.size());
+    for (std::atomic<int>& count : times_popped)
+    {
+        count.store(0);
+    }
+
+    // A small capacity keeps the free list full and empty most of the time.
+    CacheChangeFreeList free_list(256, 8);
+    std::atomic<size_t> popped(0);
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (size_t i = 0; i < changes_per_producer; ++i)
+            {
+                while (!free_list.push(&changes[t * changes_per_producer + i]))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        threads.emplace_back([&]()
+        {
+            while (popped.load() < changes.size())
+            {
+                CacheChange_t* change = free_list.pop();
+                if (change == nullptr)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                ++times_popped[change - changes.data()];
+                ++popped;
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every change was received exactly once.
+    ASSERT_EQ(popped.load(), changes.size());
+    for (std::atomic<int>& count : times_popped)
+    {
+        ASSERT_EQ(count.load(), 1);
+    }
+    ASSERT_EQ(free_list.pop(), nullptr);
+}
+
+TEST(CacheChangeFreeList, ConcurrentReuse)
+{
+    const size_t num_threads = 8;
+    const size_t iterations = 10000;
+
+    // As on the pool, every change is either on the free list or owned by one thread.
+    std::vector<CacheChange_t> changes(8);
+    std::vector<std::atomic<bool>> owned(changes.size());
+    CacheChangeFreeList free_list(256, changes.size());
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        owned[i].store(false);
+        ASSERT_TRUE(free_list.push(&changes[i]));
+    }
+
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&]()
+        {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                CacheChange_t* change = free_list.pop();
+                if (change == nullptr)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                std::atomic<bool>& change_owned = owned[change - changes.data()];
+                if (change_owned.exchange(true))
+                {
+                    failed.store(true);
+                }
+                change_owned.store(false);
+
+                // The cell of a pop still in progress is not reusable yet, so a push may find the list full for a
+                // while, but it never loses the change.
+                while (!free_list.push(change))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(failed.load());
+
+    std::vector<bool> returned(changes.size(), false);
+    for (size_t i = 0; i < changes.size(); ++i)
+    {
+        CacheChange_t* change = free_list.pop();
+        ASSERT_NE(change, nullptr);
+        ASSERT_FALSE(returned[change - changes.data()]);
+        returned[change - changes.data()] = true;
+    }
+    ASSERT_EQ(free_list.pop(), nullptr);
+}
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
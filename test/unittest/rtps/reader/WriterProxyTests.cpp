@@ -41,24 +41,23 @@ namespace eprosima
                 // Update MISSING changes util sequence number 3.
                 wproxy.missing_changes_update(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 0));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 3u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 1))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 3u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 1)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).getStatus(), ChangeFromWriterStatus_t::MISSING);
 
                 // Add two UNKNOWN with sequence numberes 4 and 5.
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,4)));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,5)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 6));
 
                 // Update MISSING changes util sequence number 5.
                 wproxy.missing_changes_update(SequenceNumber_t(0,5));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 0));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 5u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 1))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 5u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 1)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::MISSING);
 
                 // Set all as received.
                 wproxy.received_change_set(SequenceNumber_t(0, 1));
@@ -67,39 +66,37 @@ namespace eprosima
                 wproxy.received_change_set(SequenceNumber_t(0, 4));
                 wproxy.received_change_set(SequenceNumber_t(0, 5));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 5));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
 
                 // Try to update MISSING changes util sequence number 4.
                 wproxy.missing_changes_update(SequenceNumber_t(0, 4));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 5));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
 
                 // Add three UNKNOWN changes with sequence number 6, 7 and 9.
                 // Add one RECEIVED change with sequence number 8.
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 6)));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 7)));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 8)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 8));
                 wproxy.received_change_set(SequenceNumber_t(0, 8));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 9)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 10));
 
                 // Update MISSING changes util sequence number 8.
                 wproxy.missing_changes_update(SequenceNumber_t(0, 8));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 5));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 4u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 9))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 4u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 9)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Update MISSING changes util sequence number 10.
                 wproxy.missing_changes_update(SequenceNumber_t(0, 10));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 5));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 5u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 9))->getStatus(), ChangeFromWriterStatus_t::MISSING);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 10))->getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 5u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 9)).getStatus(), ChangeFromWriterStatus_t::MISSING);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 10)).getStatus(), ChangeFromWriterStatus_t::MISSING);
             }
 
             TEST(WriterProxyTests, LostChangesUpdate)
@@ -111,43 +108,40 @@ namespace eprosima
                 // Update LOST changes util sequence number 3.
                 wproxy.lost_changes_update(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 2));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
 
                 // Add two UNKNOWN with sequence numberes 3 and 4.
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,3)));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,4)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 5));
 
                 // Update LOST changes util sequence number 5.
                 wproxy.lost_changes_update(SequenceNumber_t(0, 5));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 4));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
 
                 // Try to update LOST changes util sequence number 4.
                 wproxy.lost_changes_update(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 4));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
 
                 // Add two UNKNOWN changes with sequence number 5 and 8.
                 // Add one MISSING change with sequence number 6.
                 // Add one RECEIVED change with sequence number 7.
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 5)));
-                ChangeFromWriter_t missing_aux_change_from_w(SequenceNumber_t(0, 6));
-                missing_aux_change_from_w.setStatus(ChangeFromWriterStatus_t::MISSING);
-                wproxy.m_changesFromW.insert(missing_aux_change_from_w);
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 7)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 6));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 7), ChangeFromWriterStatus_t::MISSING);
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 8));
                 wproxy.received_change_set(SequenceNumber_t(0, 7));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0, 8)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 9));
 
                 // Update LOST changes util sequence number 8.
                 wproxy.lost_changes_update(SequenceNumber_t(0, 8));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 7));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 1u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 1u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Update LOST changes util sequence number 10.
                 wproxy.lost_changes_update(SequenceNumber_t(0, 10));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 9));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
             }
 
             TEST(WriterProxyTests, ReceivedChangeSet)
@@ -159,77 +153,76 @@ namespace eprosima
                 // Set received change with sequence number 3.
                 wproxy.received_change_set(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 0));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 3u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 1))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 3u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 1)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
 
                 // Add two UNKNOWN with sequence numberes 4 and 5.
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,4)));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,5)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 6));
 
                 // Set received change with sequence number 2
                 wproxy.received_change_set(SequenceNumber_t(0, 2));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 0));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 5u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 1))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 5u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 1)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Set received change with sequence number 1
                 wproxy.received_change_set(SequenceNumber_t(0, 1));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 2u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 2u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Try to update LOST changes util sequence number 3.
                 wproxy.received_change_set(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 2u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 2u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Add received change with sequence number 6
                 wproxy.received_change_set(SequenceNumber_t(0, 6));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 3u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 3u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
 
                 // Add received change with sequence number 8
                 wproxy.received_change_set(SequenceNumber_t(0, 8));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 5u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 5u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
 
                 // Add received change with sequence number 4
                 wproxy.received_change_set(SequenceNumber_t(0, 4));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 4));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 4u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 4u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
 
                 // Add received change with sequence number 5
                 wproxy.received_change_set(SequenceNumber_t(0, 5));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 6));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 2u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 2u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
 
                 // Add received change with sequence number 7
                 wproxy.received_change_set(SequenceNumber_t(0, 7));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 8));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
             }
 
             TEST(WriterProxyTests, IrrelevantChangeSet)
@@ -241,86 +234,165 @@ namespace eprosima
                 // Set irrelevant change with sequence number 3.
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 0));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 3u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 1))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->isRelevant(), false);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 3u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 1)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).isRelevant(), false);
 
                 // Add two UNKNOWN with sequence numberes 4 and 5.
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,4)));
-                wproxy.m_changesFromW.insert(ChangeFromWriter_t(SequenceNumber_t(0,5)));
+                wproxy.maybe_add_changes_from_writer_up_to(SequenceNumber_t(0, 6));
 
                 // Set irrelevant change with sequence number 2
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 2));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 0));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 5u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 1))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 2))->isRelevant(), false);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 3))->isRelevant(), false);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 5u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 1)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 2)).isRelevant(), false);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 3)).isRelevant(), false);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Set irrelevant change with sequence number 1
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 1));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 2u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 2u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Try to update LOST changes util sequence number 3.
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 3));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 2u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 2u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
 
                 // Add irrelevant change with sequence number 6
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 6));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 3u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->isRelevant(), false);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 3u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).isRelevant(), false);
 
                 // Add irrelevant change with sequence number 8
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 8));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 3));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 5u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 4))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->isRelevant(), false);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->isRelevant(), false);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 5u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 4)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).isRelevant(), false);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).isRelevant(), false);
 
                 // Add irrelevant change with sequence number 4
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 4));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 4));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 4u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 5))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 6))->isRelevant(), false);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->isRelevant(), false);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 4u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 5)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 6)).isRelevant(), false);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).isRelevant(), false);
 
                 // Add irrelevant change with sequence number 5
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 5));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 6));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 2u);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 7))->getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->getStatus(), ChangeFromWriterStatus_t::RECEIVED);
-                ASSERT_EQ(wproxy.m_changesFromW.find(SequenceNumber_t(0, 8))->isRelevant(), false);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 2u);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 7)).getStatus(), ChangeFromWriterStatus_t::UNKNOWN);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).getStatus(), ChangeFromWriterStatus_t::RECEIVED);
+                ASSERT_EQ(wproxy.change_from_writer(SequenceNumber_t(0, 8)).isRelevant(), false);
 
                 // Add irrelevant change with sequence number 7
                 wproxy.irrelevant_change_set(SequenceNumber_t(0, 7));
                 ASSERT_EQ(wproxy.changesFromWLowMark_, SequenceNumber_t(0, 8));
-                ASSERT_EQ(wproxy.m_changesFromW.size(), 0u);
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
+            }
+
+            TEST(WriterProxyTests, MissingChangesAckNackWindow)
+            {
+                RemoteWriterAttributes wattr;
+                StatefulReader readerMock;
+                WriterProxy wproxy(wattr, &readerMock);
+
+                // A heartbeat announcing a big range of changes.
+                wproxy.missing_changes_update(SequenceNumber_t(0, 100000));
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 100000u);
+                ASSERT_TRUE(wproxy.areThereMissing());
+                ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 50001)), 50000u);
+
+                // Receive the first change and one inside the ACKNACK window.
+                wproxy.received_change_set(SequenceNumber_t(0, 1));
+                wproxy.received_change_set(SequenceNumber_t(0, 3));
+                ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 1));
+                ASSERT_TRUE(wproxy.change_was_received(SequenceNumber_t(0, 3)));
+                ASSERT_FALSE(wproxy.change_was_received(SequenceNumber_t(0, 4)));
+
+                SequenceNumberSet_t sns(wproxy.available_changes_max() + 1);
+                wproxy.for_each_missing_change([&](const SequenceNumber_t& seq_num)
+                        {
+                            return sns.add(seq_num);
+                        });
+                ASSERT_EQ(sns.base(), SequenceNumber_t(0, 2));
+                ASSERT_EQ(sns.max(), SequenceNumber_t(0, 257));
+
+                std::vector<SequenceNumber_t> bitmap_changes;
+                sns.for_each([&](const SequenceNumber_t& seq_num)
+                        {
+                            bitmap_changes.push_back(seq_num);
+                        });
+                ASSERT_EQ(bitmap_changes.size(), 255u);
+                ASSERT_EQ(bitmap_changes[0], SequenceNumber_t(0, 2));
+                ASSERT_EQ(bitmap_changes[1], SequenceNumber_t(0, 4));
+
+                // Changes announced by later heartbeats are not MISSING until the heartbeat arrives.
+                wproxy.received_change_set(SequenceNumber_t(0, 100002));
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 100001u);
+                ASSERT_EQ(wproxy.missing_changes().size(), 99998u);
+                ASSERT_EQ(wproxy.unknown_missing_changes_up_to(SequenceNumber_t(0, 100002)), 99999u);
+
+                // Losing all of them leaves no state behind.
+                wproxy.lost_changes_update(SequenceNumber_t(0, 100002));
+                ASSERT_EQ(wproxy.available_changes_max(), SequenceNumber_t(0, 100002));
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 0u);
+                ASSERT_FALSE(wproxy.areThereMissing());
+            }
+
+            TEST(WriterProxyTests, MissingChangesUpToHeartbeat)
+            {
+                RemoteWriterAttributes wattr;
+                StatefulReader readerMock;
+                WriterProxy wproxy(wattr, &readerMock);
+
+                // A heartbeat announcing some changes, and a change received far after them.
+                wproxy.missing_changes_update(SequenceNumber_t(0, 10));
+                wproxy.received_change_set(SequenceNumber_t(0, 100000));
+                ASSERT_EQ(wproxy.numberOfChangeFromWriter(), 100000u);
+
+                // Only the changes announced by the heartbeat are visited as MISSING.
+                std::vector<SequenceNumber_t> missing;
+                wproxy.for_each_missing_change([&](const SequenceNumber_t& seq_num)
+                        {
+                            missing.push_back(seq_num);
+                            return true;
+                        });
+                ASSERT_EQ(missing.size(), 10u);
+                ASSERT_EQ(missing.front(), SequenceNumber_t(0, 1));
+                ASSERT_EQ(missing.back(), SequenceNumber_t(0, 10));
+
+                // The iteration stops when the function returns false.
+                size_t visited = 0;
+                wproxy.for_each_missing_change([&](const SequenceNumber_t&)
+                        {
+                            return ++visited < 3;
+                        });
+                ASSERT_EQ(visited, 3u);
             }
 
         } // namespace rtps
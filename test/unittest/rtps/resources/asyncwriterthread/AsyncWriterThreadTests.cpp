@@ -0,0 +1,174 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastrtps/rtps/resources/AsyncWriterThread.h>
+#include <fastrtps/rtps/writer/RTPSWriter.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using ::testing::Invoke;
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            class AsyncWriterThreadTests : public ::testing::Test
+            {
+                protected:
+
+                    AsyncWriterThreadTests()
+                        : released_(release_.get_future())
+                    {
+                    }
+
+                    void expect_send(
+                            RTPSWriter& writer,
+                            const std::string& name)
+                    {
+                        EXPECT_CALL(writer, send_any_unsent_changes()).WillOnce(Invoke([this, name]()
+                                    {
+                                        record(name);
+                                    }));
+                    }
+
+                    //! The thread is kept busy sending from this writer until release() is called.
+                    void expect_blocking_send(
+                            RTPSWriter& writer,
+                            const std::string& name)
+                    {
+                        EXPECT_CALL(writer, send_any_unsent_changes()).WillOnce(Invoke([this, name]()
+                                    {
+                                        record(name);
+                                        released_.wait();
+                                    }));
+                    }
+
+                    void release()
+                    {
+                        release_.set_value();
+                    }
+
+                    bool wait_sent(size_t count)
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        return cv_.wait_for(lock, std::chrono::seconds(5), [&]()
+                                {
+                                    return sent_.size() >= count;
+                                });
+                    }
+
+                    std::vector<std::string> sent()
+                    {
+                        std::lock_guard<std::mutex> guard(mutex_);
+                        return sent_;
+                    }
+
+                private:
+
+                    void record(const std::string& name)
+                    {
+                        std::lock_guard<std::mutex> guard(mutex_);
+                        sent_.push_back(name);
+                        cv_.notify_all();
+                    }
+
+                    std::promise<void> release_;
+                    std::shared_future<void> released_;
+                    std::mutex mutex_;
+                    std::condition_variable cv_;
+                    std::vector<std::string> sent_;
+            };
+
+            TEST_F(AsyncWriterThreadTests, WritersServicedByPriority)
+            {
+                RTPSWriter low(0);
+                RTPSWriter high(46);
+                RTPSWriter mid(10);
+                RTPSWriter blocker(100);
+
+                expect_blocking_send(blocker, "blocker");
+                expect_send(high, "high");
+                expect_send(mid, "mid");
+                expect_send(low, "low");
+
+                // Creation order is not the servicing order.
+                ASSERT_TRUE(AsyncWriterThread::addWriter(low));
+                ASSERT_TRUE(AsyncWriterThread::addWriter(high));
+                ASSERT_TRUE(AsyncWriterThread::addWriter(mid));
+                ASSERT_TRUE(AsyncWriterThread::addWriter(blocker));
+
+                AsyncWriterThread::wakeUp(&blocker);
+                EXPECT_TRUE(wait_sent(1));
+                AsyncWriterThread::wakeUp(&low);
+                AsyncWriterThread::wakeUp(&mid);
+                AsyncWriterThread::wakeUp(&high);
+                release();
+                EXPECT_TRUE(wait_sent(4));
+
+                EXPECT_EQ(sent(), std::vector<std::string>({"blocker", "high", "mid", "low"}));
+
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(low));
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(high));
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(mid));
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(blocker));
+            }
+
+            TEST_F(AsyncWriterThreadTests, HigherPriorityInterestRestartsServicing)
+            {
+                RTPSWriter high(46);
+                RTPSWriter first(0);
+                RTPSWriter second(0);
+
+                expect_blocking_send(first, "first");
+                expect_send(high, "high");
+                expect_send(second, "second");
+
+                ASSERT_TRUE(AsyncWriterThread::addWriter(high));
+                ASSERT_TRUE(AsyncWriterThread::addWriter(first));
+                ASSERT_TRUE(AsyncWriterThread::addWriter(second));
+
+                // The high priority writer becomes interested while the lower priority ones are being serviced.
+                AsyncWriterThread::wakeUp(&first);
+                EXPECT_TRUE(wait_sent(1));
+                AsyncWriterThread::wakeUp(&second);
+                AsyncWriterThread::wakeUp(&high);
+                release();
+                EXPECT_TRUE(wait_sent(3));
+
+                EXPECT_EQ(sent(), std::vector<std::string>({"first", "high", "second"}));
+
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(high));
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(first));
+                ASSERT_TRUE(AsyncWriterThread::removeWriter(second));
+            }
+
+        } // namespace rtps
+    } // namespace fastrtps
+} // namespace eprosima
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,55 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSWriter.h
+ */
+
+#ifndef _RTPS_WRITER_RTPSWRITER_H_
+#define _RTPS_WRITER_RTPSWRITER_H_
+
+#include <fastrtps/rtps/common/Guid.h>
+#include <fastrtps/rtps/attributes/EndpointAttributes.h>
+
+#include <gmock/gmock.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl;
+
+class RTPSWriter
+{
+    public:
+
+        RTPSWriter(int32_t transport_priority)
+        {
+            m_att.transport_priority = transport_priority;
+        }
+
+        const EndpointAttributes& getAttributes() const { return m_att; }
+
+        MOCK_METHOD0(send_any_unsent_changes, void());
+
+    private:
+
+        EndpointAttributes m_att;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_WRITER_RTPSWRITER_H_
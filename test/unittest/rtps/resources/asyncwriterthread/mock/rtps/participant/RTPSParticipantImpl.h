@@ -0,0 +1,50 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSParticipantImpl.h
+ */
+
+#ifndef RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
+#define RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
+
+#include <fastrtps/rtps/writer/RTPSWriter.h>
+
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSParticipantImpl
+{
+    public:
+
+        std::recursive_mutex* getParticipantMutex() const { return &mutex_; }
+
+        const std::vector<RTPSWriter*>& getAllWriters() const { return writers_; }
+
+        std::vector<RTPSWriter*> writers_;
+
+    private:
+
+        mutable std::recursive_mutex mutex_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_PARTICIPANT_RTPSPARTICIPANTIMPL_H_
@@ -36,7 +36,7 @@ TEST_F(SecurityTest, discovered_participant_begin_handshake_request_fail_and_the
     info.status = ParticipantAuthenticationInfo::UNAUTHORIZED_PARTICIPANT;
     info.guid = participant_data.m_guid;
     EXPECT_CALL(*participant_.getListener(), onParticipantAuthentication(_, info)).Times(1);
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
     ASSERT_FALSE(manager_.discovered_participant(participant_data));
 
@@ -55,13 +55,54 @@ TEST_F(SecurityTest, discovered_participant_begin_handshake_request_fail_and_the
         WillRepeatedly(Return(true));
     EXPECT_CALL(*auth_plugin_, return_handshake_handle(&handshake_handle,_)).Times(1).
         WillOnce(Return(true));
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
     ASSERT_TRUE(manager_.discovered_participant(participant_data));
 
     delete change;
 }
 
+TEST_F(SecurityTest, discovered_participant_begin_handshake_request_local_participant_data)
+{
+    initialization_ok();
+
+    MockIdentityHandle remote_identity_handle;
+    const std::vector<octet> local_participant_data = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+
+    // The serialized local participant data is copied into the message handed to the plugin.
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1).
+        WillOnce(Invoke([&local_participant_data](Endianness_t, CDRMessage_t& msg)
+                    {
+                        msg.buffer = (octet*)malloc(local_participant_data.size());
+                        msg.max_size = static_cast<uint32_t>(local_participant_data.size());
+                        msg.length = msg.max_size;
+                        msg.msg_endian = BIGEND;
+                        memcpy(msg.buffer, local_participant_data.data(), local_participant_data.size());
+                    }));
+    EXPECT_CALL(*auth_plugin_, validate_remote_identity_rvr(_, Ref(local_identity_handle_),_,_,_)).Times(1).
+        WillOnce(DoAll(SetArgPointee<0>(&remote_identity_handle), Return(ValidationResult_t::VALIDATION_PENDING_HANDSHAKE_REQUEST)));
+    EXPECT_CALL(*auth_plugin_, begin_handshake_request(_,_, Ref(local_identity_handle_),
+                Ref(remote_identity_handle), Truly([&local_participant_data](const CDRMessage_t& msg)
+                    {
+                        return msg.msg_endian == BIGEND && msg.length == local_participant_data.size() &&
+                            std::equal(local_participant_data.begin(), local_participant_data.end(), msg.buffer);
+                    }),_)).Times(1).
+        WillOnce(Return(ValidationResult_t::VALIDATION_FAILED));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&local_identity_handle_,_)).Times(1).
+        WillRepeatedly(Return(true));
+    EXPECT_CALL(*auth_plugin_, return_identity_handle(&remote_identity_handle,_)).Times(1).
+        WillRepeatedly(Return(true));
+
+    ParticipantProxyData participant_data;
+    fill_participant_key(participant_data.m_guid);
+    ParticipantAuthenticationInfo info;
+    info.status = ParticipantAuthenticationInfo::UNAUTHORIZED_PARTICIPANT;
+    info.guid = participant_data.m_guid;
+    EXPECT_CALL(*participant_.getListener(), onParticipantAuthentication(_, info)).Times(1);
+
+    ASSERT_FALSE(manager_.discovered_participant(participant_data));
+}
+
 TEST_F(SecurityTest, discovered_participant_process_message_not_remote_participant_key)
 {
     initialization_ok();
@@ -260,7 +301,7 @@ TEST_F(SecurityTest, discovered_participant_process_message_fail_begin_handshake
     info.status = ParticipantAuthenticationInfo::UNAUTHORIZED_PARTICIPANT;
     info.guid = participant_data.m_guid;
     EXPECT_CALL(*participant_.getListener(), onParticipantAuthentication(_, info)).Times(1);
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
     stateless_reader_->listener_->onNewCacheChangeAdded(stateless_reader_, change);
 }
@@ -324,7 +365,7 @@ TEST_F(SecurityTest, discovered_participant_process_message_ok_begin_handshake_r
     EXPECT_CALL(*stateless_reader_->history_, remove_change_mock(change)).Times(1).
         WillOnce(Return(true));
     EXPECT_CALL(*participant_.pdpsimple(), notifyAboveRemoteEndpoints(_)).Times(1);
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
     EXPECT_CALL(*auth_plugin_, get_shared_secret(Ref(handshake_handle),_)).Times(1).
         WillOnce(Return(&shared_secret_handle));
     EXPECT_CALL(*auth_plugin_, return_sharedsecret_handle(&shared_secret_handle,_)).Times(1).
@@ -405,7 +446,7 @@ TEST_F(SecurityTest, discovered_participant_process_message_new_change_fail)
         WillOnce(Return(true));
     EXPECT_CALL(*stateless_reader_->history_, remove_change_mock(change)).Times(1).
         WillOnce(Return(true));
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
     stateless_reader_->listener_->onNewCacheChangeAdded(stateless_reader_, change);
 }
@@ -472,7 +513,7 @@ TEST_F(SecurityTest, discovered_participant_process_message_add_change_fail)
         WillOnce(Return(true));
     EXPECT_CALL(*stateless_reader_->history_, remove_change_mock(change)).Times(1).
         WillOnce(Return(true));
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
     stateless_reader_->listener_->onNewCacheChangeAdded(stateless_reader_, change);
 
@@ -577,7 +618,7 @@ TEST_F(SecurityTest, discovered_participant_process_message_pending_handshake_re
     EXPECT_CALL(*stateless_reader_->history_, remove_change_mock(change)).Times(1).
         WillOnce(Return(true));
     EXPECT_CALL(*participant_.pdpsimple(), notifyAboveRemoteEndpoints(_)).Times(1);
-    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+    EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
     EXPECT_CALL(*auth_plugin_, get_shared_secret(Ref(handshake_handle),_)).Times(1).
         WillOnce(Return(&shared_secret_handle));
     EXPECT_CALL(*auth_plugin_, return_sharedsecret_handle(&shared_secret_handle,_)).Times(1).
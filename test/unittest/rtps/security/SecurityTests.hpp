@@ -172,7 +172,7 @@ class SecurityTest : public ::testing::Test
                 WillOnce(Return(change));
             EXPECT_CALL(*stateless_writer_->history_, add_change_mock(change)).Times(1).
                 WillOnce(Return(true));
-            EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+            EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
             fill_participant_key(participant_data_.m_guid);
             ASSERT_TRUE(manager_.discovered_participant(participant_data_));
@@ -236,7 +236,7 @@ class SecurityTest : public ::testing::Test
                 WillOnce(Return(true));
             EXPECT_CALL(*stateless_reader_->history_, remove_change_mock(change)).Times(1).
                 WillOnce(Return(true));
-            EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND)).Times(1);
+            EXPECT_CALL(*participant_.pdpsimple(), get_participant_proxy_data_serialized(BIGEND, _)).Times(1);
 
             stateless_reader_->listener_->onNewCacheChangeAdded(stateless_reader_, change);
 
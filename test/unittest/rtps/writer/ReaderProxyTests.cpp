@@ -0,0 +1,354 @@
+// Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastrtps/rtps/writer/ReaderProxy.h>
+#include <fastrtps/rtps/writer/StatefulWriter.h>
+#include <fastrtps/rtps/history/WriterHistory.h>
+
+#include <vector>
+
+namespace eprosima
+{
+    namespace fastrtps
+    {
+        namespace rtps
+        {
+            class ReaderProxyTests : public ::testing::Test
+            {
+                protected:
+
+                    ReaderProxyTests()
+                        : writer_(nullptr)
+                        , history_(HistoryAttributes())
+                    {
+                        writer_.mp_history = &history_;
+                        proxy_.reset(new ReaderProxy(WriterTimes(), &writer_));
+
+                        RemoteReaderAttributes rattr;
+                        rattr.guid = GUID_t(GuidPrefix_t(), 1u);
+                        rattr.endpoint.reliabilityKind = RELIABLE;
+                        proxy_->start(rattr);
+                    }
+
+                    void add_changes(
+                            uint32_t count,
+                            ChangeForReaderStatus_t status)
+                    {
+                        for (uint32_t i = 0; i < count; ++i)
+                        {
+                            changes_.emplace_back(new CacheChange_t());
+                            changes_.back()->sequenceNumber = SequenceNumber_t(0, (uint32_t)changes_.size());
+                            proxy_->add_change(changes_.back().get(), status, true, false);
+                        }
+                    }
+
+                    void add_fragmented_change(
+                            uint32_t fragment_count,
+                            ChangeForReaderStatus_t status)
+                    {
+                        changes_.emplace_back(new CacheChange_t());
+                        CacheChange_t* change = changes_.back().get();
+                        change->sequenceNumber = SequenceNumber_t(0, (uint32_t)changes_.size());
+                        change->serializedPayload.length = fragment_count * 100u;
+                        change->setFragmentSize(100u);
+                        proxy_->add_change(change, status, true, false);
+                    }
+
+                    std::vector<FragmentNumber_t> unsent_fragments(
+                            const SequenceNumber_t& seq_num)
+                    {
+                        std::vector<FragmentNumber_t> fragments;
+                        proxy_->for_each_unsent_change(seq_num + 1,
+                                [&](const SequenceNumber_t& seq, const ReaderProxy::UnsentChange* unsent_change)
+                                {
+                                    if (seq == seq_num && unsent_change != nullptr)
+                                    {
+                                        unsent_change->getUnsentFragments().for_each([&](FragmentNumber_t element)
+                                        {
+                                            fragments.push_back(element);
+                                        });
+                                    }
+                                });
+                        return fragments;
+                    }
+
+                    void nack_frag(
+                            const SequenceNumber_t& seq_num,
+                            const std::vector<FragmentNumber_t>& fragments)
+                    {
+                        FragmentNumberSet_t fragments_state(fragments.front());
+                        for (FragmentNumber_t element : fragments)
+                        {
+                            fragments_state.add(element);
+                        }
+                        ASSERT_TRUE(proxy_->process_nack_frag(proxy_->guid(), ++nack_frag_count_, seq_num,
+                                    fragments_state));
+                    }
+
+                    StatefulWriter writer_;
+                    WriterHistory history_;
+                    std::unique_ptr<ReaderProxy> proxy_;
+                    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+                    uint32_t nack_frag_count_ = 0;
+            };
+
+            TEST_F(ReaderProxyTests, AckedChangesMoveLowMark)
+            {
+                add_changes(4, UNACKNOWLEDGED);
+                ASSERT_EQ(proxy_->changes_low_mark(), SequenceNumber_t(0, 0));
+                ASSERT_TRUE(proxy_->has_unacknowledged());
+
+                // Acknack with base 3 acknowledges changes 1 and 2.
+                proxy_->acked_changes_set(SequenceNumber_t(0, 3));
+                ASSERT_EQ(proxy_->changes_low_mark(), SequenceNumber_t(0, 2));
+                ASSERT_TRUE(proxy_->change_is_acked(SequenceNumber_t(0, 2)));
+                ASSERT_FALSE(proxy_->change_is_acked(SequenceNumber_t(0, 3)));
+
+                // Acknowledging the change following the low mark moves it.
+                ASSERT_TRUE(proxy_->set_change_to_status(SequenceNumber_t(0, 3), ACKNOWLEDGED, false));
+                ASSERT_EQ(proxy_->changes_low_mark(), SequenceNumber_t(0, 3));
+
+                // A removed change leaves a hole that is considered acknowledged.
+                proxy_->change_has_been_removed(SequenceNumber_t(0, 4));
+                ASSERT_TRUE(proxy_->change_is_acked(SequenceNumber_t(0, 4)));
+                ASSERT_FALSE(proxy_->has_changes());
+                ASSERT_FALSE(proxy_->has_unacknowledged());
+            }
+
+            TEST_F(ReaderProxyTests, UnsentChangesAndHoles)
+            {
+                add_changes(3, UNSENT);
+                proxy_->change_has_been_removed(SequenceNumber_t(0, 2));
+                ASSERT_TRUE(proxy_->has_unsent_changes());
+
+                std::vector<SequenceNumber_t> unsent;
+                std::vector<SequenceNumber_t> holes;
+                proxy_->for_each_unsent_change(SequenceNumber_t(0, 5),
+                        [&](const SequenceNumber_t& seq, const ReaderProxy::UnsentChange* unsent_change)
+                        {
+                            if (unsent_change == nullptr)
+                            {
+                                holes.push_back(seq);
+                            }
+                            else
+                            {
+                                ASSERT_TRUE(unsent_change->isValid());
+                                ASSERT_TRUE(unsent_change->isRelevant());
+                                ASSERT_EQ(unsent_change->getChange(), changes_[seq.low - 1].get());
+                                unsent.push_back(seq);
+                            }
+                        });
+
+                ASSERT_EQ(unsent, std::vector<SequenceNumber_t>({SequenceNumber_t(0, 1), SequenceNumber_t(0, 3)}));
+                ASSERT_EQ(holes, std::vector<SequenceNumber_t>({SequenceNumber_t(0, 2), SequenceNumber_t(0, 4)}));
+
+                ASSERT_TRUE(proxy_->set_change_to_status(SequenceNumber_t(0, 1), UNDERWAY, false));
+                ASSERT_TRUE(proxy_->has_unsent_changes());
+                ASSERT_TRUE(proxy_->set_change_to_status(SequenceNumber_t(0, 3), UNDERWAY, false));
+                ASSERT_FALSE(proxy_->has_unsent_changes());
+            }
+
+            TEST_F(ReaderProxyTests, UnsentChangesCount)
+            {
+                add_changes(2, UNSENT);
+                add_changes(2, UNACKNOWLEDGED);
+                ASSERT_EQ(proxy_->unsent_changes_count(), 2u);
+
+                ASSERT_TRUE(proxy_->set_change_to_status(SequenceNumber_t(0, 1), UNDERWAY, false));
+                ASSERT_EQ(proxy_->unsent_changes_count(), 1u);
+                // Setting the same status twice doesn't count the change twice.
+                ASSERT_FALSE(proxy_->set_change_to_status(SequenceNumber_t(0, 2), UNSENT, false));
+                ASSERT_EQ(proxy_->unsent_changes_count(), 1u);
+
+                // Requested changes become unsent again when the acknack response is performed.
+                SequenceNumberSet_t requested(SequenceNumber_t(0, 3));
+                requested.add(SequenceNumber_t(0, 3));
+                requested.add(SequenceNumber_t(0, 4));
+                ASSERT_TRUE(proxy_->requested_changes_set(requested));
+                ASSERT_EQ(proxy_->unsent_changes_count(), 1u);
+                ASSERT_TRUE(proxy_->perform_acknack_response());
+                ASSERT_EQ(proxy_->unsent_changes_count(), 3u);
+
+                // Removed and acknowledged changes are no longer pending.
+                proxy_->change_has_been_removed(SequenceNumber_t(0, 4));
+                ASSERT_EQ(proxy_->unsent_changes_count(), 2u);
+                proxy_->acked_changes_set(SequenceNumber_t(0, 3));
+                ASSERT_EQ(proxy_->unsent_changes_count(), 1u);
+                ASSERT_TRUE(proxy_->has_unsent_changes());
+                ASSERT_TRUE(proxy_->set_change_to_status(SequenceNumber_t(0, 3), UNDERWAY, false));
+                ASSERT_FALSE(proxy_->has_unsent_changes());
+            }
+
+            TEST_F(ReaderProxyTests, FragmentsSentInOrder)
+            {
+                add_fragmented_change(3, UNSENT);
+                SequenceNumber_t seq(0, 1);
+                bool was_last = false;
+
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({1, 2, 3}));
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 1, was_last));
+                ASSERT_FALSE(was_last);
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 2, was_last));
+                ASSERT_FALSE(was_last);
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({3}));
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 3, was_last));
+                ASSERT_TRUE(was_last);
+
+                // Unknown changes are not found.
+                ASSERT_FALSE(proxy_->mark_fragment_as_sent_for_change(SequenceNumber_t(0, 2), 1, was_last));
+                ASSERT_FALSE(was_last);
+            }
+
+            TEST_F(ReaderProxyTests, FragmentSentOutOfOrderStaysUnsent)
+            {
+                add_fragmented_change(3, UNSENT);
+                SequenceNumber_t seq(0, 1);
+                bool was_last = false;
+
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 2, was_last));
+                ASSERT_FALSE(was_last);
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({1, 2, 3}));
+            }
+
+            TEST_F(ReaderProxyTests, NackFragAfterAllFragmentsSent)
+            {
+                add_fragmented_change(10, UNSENT);
+                SequenceNumber_t seq(0, 1);
+                bool was_last = false;
+
+                for (FragmentNumber_t frag = 1; frag <= 10; ++frag)
+                {
+                    ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, frag, was_last));
+                }
+                ASSERT_TRUE(was_last);
+                ASSERT_TRUE(proxy_->set_change_to_status(seq, UNDERWAY, false));
+                ASSERT_TRUE(proxy_->perform_nack_supression());
+
+                // Only the requested fragments are sent again.
+                nack_frag(seq, {3, 5});
+                ASSERT_TRUE(unsent_fragments(seq).empty());
+                ASSERT_TRUE(proxy_->perform_acknack_response());
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({3, 5}));
+
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 3, was_last));
+                ASSERT_FALSE(was_last);
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({5}));
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 5, was_last));
+                ASSERT_TRUE(was_last);
+                ASSERT_TRUE(unsent_fragments(seq).empty());
+            }
+
+            TEST_F(ReaderProxyTests, NackFragDuringFirstPass)
+            {
+                add_fragmented_change(10, UNSENT);
+                SequenceNumber_t seq(0, 1);
+                bool was_last = false;
+
+                for (FragmentNumber_t frag = 1; frag <= 4; ++frag)
+                {
+                    ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, frag, was_last));
+                }
+
+                // Requests for fragments not sent yet are already pending.
+                nack_frag(seq, {2, 7});
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({2, 5, 6, 7, 8, 9, 10}));
+
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 2, was_last));
+                ASSERT_FALSE(was_last);
+                for (FragmentNumber_t frag = 5; frag <= 10; ++frag)
+                {
+                    ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, frag, was_last));
+                }
+                ASSERT_TRUE(was_last);
+            }
+
+            TEST_F(ReaderProxyTests, NackFragOutOfWindow)
+            {
+                add_fragmented_change(300, UNSENT);
+                SequenceNumber_t seq(0, 1);
+                bool was_last = false;
+
+                // Unsent fragments are reported up to the size of one bitmap.
+                std::vector<FragmentNumber_t> fragments = unsent_fragments(seq);
+                ASSERT_EQ(fragments.size(), 256u);
+                ASSERT_EQ(fragments.front(), 1u);
+                ASSERT_EQ(fragments.back(), 256u);
+
+                for (FragmentNumber_t frag = 1; frag <= 300; ++frag)
+                {
+                    ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, frag, was_last));
+                }
+                ASSERT_TRUE(was_last);
+                ASSERT_TRUE(proxy_->set_change_to_status(seq, UNACKNOWLEDGED, false));
+
+                // Fragments 10 and 290 do not fit on one bitmap, so all from 290 on are sent again after 10.
+                nack_frag(seq, {290});
+                nack_frag(seq, {10});
+                ASSERT_TRUE(proxy_->perform_acknack_response());
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({10}));
+
+                ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, 10, was_last));
+                ASSERT_FALSE(was_last);
+                fragments = unsent_fragments(seq);
+                ASSERT_EQ(fragments.size(), 11u);
+                ASSERT_EQ(fragments.front(), 290u);
+                ASSERT_EQ(fragments.back(), 300u);
+
+                for (FragmentNumber_t frag = 290; frag <= 300; ++frag)
+                {
+                    ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, frag, was_last));
+                }
+                ASSERT_TRUE(was_last);
+                ASSERT_TRUE(unsent_fragments(seq).empty());
+            }
+
+            TEST_F(ReaderProxyTests, RequestedChangeSendsAllFragments)
+            {
+                add_fragmented_change(4, UNSENT);
+                SequenceNumber_t seq(0, 1);
+                bool was_last = false;
+
+                for (FragmentNumber_t frag = 1; frag <= 4; ++frag)
+                {
+                    ASSERT_TRUE(proxy_->mark_fragment_as_sent_for_change(seq, frag, was_last));
+                }
+                ASSERT_TRUE(proxy_->set_change_to_status(seq, UNACKNOWLEDGED, false));
+                nack_frag(seq, {2});
+                // Acknack response not performed yet.
+                ASSERT_TRUE(proxy_->set_change_to_status(seq, UNACKNOWLEDGED, false));
+
+                SequenceNumberSet_t requested(seq);
+                requested.add(seq);
+                ASSERT_TRUE(proxy_->requested_changes_set(requested));
+                ASSERT_TRUE(proxy_->perform_acknack_response());
+                ASSERT_EQ(unsent_fragments(seq), std::vector<FragmentNumber_t>({1, 2, 3, 4}));
+
+                // Acknowledging the change discards its pending fragments.
+                proxy_->acked_changes_set(SequenceNumber_t(0, 2));
+                ASSERT_FALSE(proxy_->has_changes());
+                ASSERT_FALSE(proxy_->mark_fragment_as_sent_for_change(seq, 1, was_last));
+            }
+
+        } // namespace rtps
+    } // namespace fastrtps
+} // namespace eprosima
+
+int main(int argc, char **argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -23,6 +23,7 @@
 #include <memory>
 #include <asio.hpp>
 #include <MockReceiverResource.h>
+#include <transport/TransportPriority.hpp>
 
 
 using namespace eprosima::fastrtps;
@@ -219,6 +220,69 @@ TEST_F(UDPv4Tests, send_to_loopback)
 }
 #endif
 
+// Windows ignores IP_TOS unless the system is configured to honour it.
+#ifndef _WIN32
+TEST_F(UDPv4Tests, transport_priority_marks_traffic_with_dscp)
+{
+    asio::io_service io_service;
+    asio::ip::udp::socket socket(io_service, asio::ip::udp::endpoint(asio::ip::udp::v4(), 0));
+    asio::error_code ec;
+
+    // Expedited Forwarding.
+    set_socket_transport_priority(socket, 46, ec);
+    ASSERT_FALSE(ec);
+    asio::detail::socket_option::integer<IPPROTO_IP, IP_TOS> tos;
+    socket.get_option(tos);
+    EXPECT_EQ(tos.value(), 46 << 2);
+
+    // Priorities beyond the 6 bits of DSCP are clamped.
+    set_socket_transport_priority(socket, 1000, ec);
+    ASSERT_FALSE(ec);
+    socket.get_option(tos);
+    EXPECT_EQ(tos.value(), 63 << 2);
+}
+#endif
+
+#ifndef __APPLE__
+TEST_F(UDPv4Tests, send_and_receive_with_transport_priority)
+{
+    UDPv4Transport transportUnderTest(descriptor);
+    transportUnderTest.init();
+
+    Locator_t multicastLocator;
+    multicastLocator.port = g_default_port;
+    multicastLocator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicastLocator, 239, 255, 0, 1);
+
+    Locator_t outputChannelLocator;
+    outputChannelLocator.port = g_default_port + 1;
+    outputChannelLocator.kind = LOCATOR_KIND_UDPv4;
+
+    MockReceiverResource receiver(transportUnderTest, multicastLocator);
+    MockMessageReceiver *msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    SendResourceList send_resource_list;
+    ASSERT_TRUE(transportUnderTest.OpenOutputChannel(send_resource_list, outputChannelLocator));
+    ASSERT_FALSE(send_resource_list.empty());
+    octet message[5] = { 'H','e','l','l','o' };
+
+    Semaphore sem;
+    std::function<void()> recCallback = [&]()
+    {
+        EXPECT_EQ(memcmp(message,msg_recv->data,5), 0);
+        sem.post();
+    };
+
+    msg_recv->setCallback(recCallback);
+
+    // Marked traffic goes through its own socket, and unmarked traffic keeps using the default one.
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, multicastLocator, 46));
+    sem.wait();
+    EXPECT_TRUE(send_resource_list.at(0)->send(message, 5, multicastLocator));
+    sem.wait();
+}
+#endif
+
 TEST_F(UDPv4Tests, send_is_rejected_if_buffer_size_is_bigger_to_size_specified_in_descriptor)
 {
     // Given
@@ -14,6 +14,7 @@
 
 #include <fastrtps/utils/StringMatching.h>
 #include <gtest/gtest.h>
+#include <vector>
 #include <fastrtps/log/Log.h>
 
 using namespace eprosima::fastrtps;
@@ -55,6 +56,48 @@ TEST_F(StringMatchingTests, patterns_with_wildcards)
     ASSERT_FALSE(StringMatching::matchString(path, pattern9));
 }
 
+TEST_F(StringMatchingTests, index_returns_first_matching_expression)
+{
+    StringMatchingIndex index;
+    index.add(pattern9, 0);
+    index.add(pattern3, 1);
+    index.add(pattern1, 2);
+    index.add(pattern0, 3);
+    index.add(pattern8, 4);
+
+    ASSERT_EQ(5u, index.size());
+    ASSERT_EQ(1u, index.find_first(path));
+    ASSERT_EQ(0u, index.find_first(pattern9));
+    ASSERT_EQ(2u, index.find_first("foo"));
+    ASSERT_EQ(4u, index.find_first("qux"));
+    ASSERT_EQ(4u, index.find_first(""));
+
+    // Inputs with wildcards are matched in both directions, as StringMatching::matchString does.
+    ASSERT_EQ(0u, index.find_first("*qux"));
+
+    index.clear();
+    ASSERT_TRUE(index.empty());
+    ASSERT_EQ(StringMatchingIndex::npos, index.find_first(path));
+}
+
+TEST_F(StringMatchingTests, index_agrees_with_match_string)
+{
+    std::vector<const char*> patterns = {pattern0, pattern1, pattern2, pattern3, pattern4, pattern5, pattern6,
+        pattern7, pattern8, pattern9};
+    std::vector<const char*> inputs = {path, "foo", "foo/bar", "bar", "baz", "foo/bar/bat", "", "*bar", "foo*"};
+
+    for (size_t i = 0; i < patterns.size(); ++i)
+    {
+        StringMatchingIndex index;
+        index.add(patterns[i], 0);
+
+        for (auto input : inputs)
+        {
+            ASSERT_EQ(StringMatching::matchString(patterns[i], input), index.matches(input))
+                << patterns[i] << " vs " << input;
+        }
+    }
+}
 
 int main(int argc, char **argv)
 {
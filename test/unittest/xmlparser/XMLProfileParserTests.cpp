@@ -136,6 +136,9 @@ TEST_F(XMLProfileParserTests, XMLParserParcipant)
     EXPECT_EQ(rtps_atts.throughputController.bytesPerPeriod, 2048u);
     EXPECT_EQ(rtps_atts.throughputController.periodMillisecs, 45u);
     EXPECT_EQ(rtps_atts.useBuiltinTransports, true);
+    EXPECT_EQ(rtps_atts.sharedEventThreads, 2u);
+    EXPECT_EQ(rtps_atts.submessageBatchingWindow.seconds, 0);
+    EXPECT_EQ(rtps_atts.submessageBatchingWindow.fraction, 8589934u);
     EXPECT_EQ(std::string(rtps_atts.getName()), "test_name");
 }
 
@@ -271,6 +274,9 @@ TEST_F(XMLProfileParserTests, XMLParserPublisher)
     //EXPECT_EQ(loc_list_it->get_port(), 2021);
     EXPECT_EQ(publisher_atts.throughputController.bytesPerPeriod, 9236u);
     EXPECT_EQ(publisher_atts.throughputController.periodMillisecs, 234u);
+    EXPECT_EQ(publisher_atts.flowScheduling.weight, 3u);
+    EXPECT_EQ(publisher_atts.flowScheduling.priority, -2);
+    EXPECT_FALSE(publisher_atts.sendKeyHash);
     EXPECT_EQ(publisher_atts.historyMemoryPolicy, DYNAMIC_RESERVE_MEMORY_MODE);
     EXPECT_EQ(publisher_atts.getUserDefinedID(), 67);
     EXPECT_EQ(publisher_atts.getEntityID(), 87);
@@ -339,6 +345,9 @@ TEST_F(XMLProfileParserTests, XMLParserDefaultPublisherProfile)
     //EXPECT_EQ(loc_list_it->get_port(), 2021);
     EXPECT_EQ(publisher_atts.throughputController.bytesPerPeriod, 9236u);
     EXPECT_EQ(publisher_atts.throughputController.periodMillisecs, 234u);
+    EXPECT_EQ(publisher_atts.flowScheduling.weight, 3u);
+    EXPECT_EQ(publisher_atts.flowScheduling.priority, -2);
+    EXPECT_FALSE(publisher_atts.sendKeyHash);
     EXPECT_EQ(publisher_atts.historyMemoryPolicy, DYNAMIC_RESERVE_MEMORY_MODE);
     EXPECT_EQ(publisher_atts.getUserDefinedID(), 67);
     EXPECT_EQ(publisher_atts.getEntityID(), 87);
@@ -0,0 +1,244 @@
+# Copyright 2019 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Per-sample latency breakdown from the static tracepoints of Fast RTPS.
+
+The library has to be built with -DTRACEPOINTS=ON. Usage:
+
+    # Generate the bpftrace program for the library and record a trace while the applications run.
+    python3 fastrtps_latency.py bpftrace /usr/local/lib/libfastrtps.so > fastrtps.bt
+    sudo bpftrace fastrtps.bt > trace.txt
+
+    # Reconstruct the latency of each sample.
+    python3 fastrtps_latency.py analyze trace.txt [--csv samples.csv]
+
+Each line of the trace is "<timestamp_ns> <pid> <tid> <probe> <arguments...>". Any other tool able to attach
+to USDT probes (i.e. systemtap) can be used while it writes the same format.
+
+Timestamps of different processes are only comparable when they run on the same host.
+
+Samples are identified by writer GUID and sequence number. The events without those fields are attributed by
+thread: the UDP sends are assigned to the last RTPS message sent by the same thread, and the DATA submessages to
+the last datagram received by the same thread.
+"""
+
+import argparse
+import collections
+import csv
+import sys
+
+PROBES = collections.OrderedDict([
+    ("write_begin", "%llx %llx"),
+    ("write_end", "%llx %llx %llu"),
+    ("message_send", "%llx %llx %llu %llu %u %u"),
+    ("udp_send", "%u %u"),
+    ("udp_receive", "%u %u"),
+    ("data_received", "%llx %llx %llu %u"),
+    ("history_received", "%llx %llx %llx %llx %llu"),
+    ("listener_begin", "%llx %llx %llx %llx %llu"),
+    ("listener_end", "%llx %llx %llx %llx %llu"),
+])
+
+# Consecutive stages of the breakdown. Each one goes from the previous event to the named one.
+STAGES = [
+    ("queue", "message_send"),
+    ("send", "udp_send"),
+    ("network", "udp_receive"),
+    ("receive", "data_received"),
+    ("history", "history_received"),
+    ("notify", "listener_begin"),
+]
+
+
+def bpftrace_program(library):
+    lines = []
+    for probe, fmt in PROBES.items():
+        nargs = len(fmt.split())
+        args = "".join(", arg%d" % i for i in range(nargs))
+        lines.append('usdt:%s:fastrtps:%s { printf("%%llu %%d %%d %s %s\\n", nsecs, pid, tid%s); }' %
+                (library, probe, probe, fmt, args))
+    return "\n".join(lines) + "\n"
+
+
+def guid(high, low):
+    value = "%016x%016x" % (int(high, 16), int(low, 16))
+    prefix = ".".join(value[i:i + 2] for i in range(0, 24, 2))
+    return prefix + "|" + ".".join(value[i:i + 2] for i in range(24, 32, 2))
+
+
+class Sample(object):
+    def __init__(self, writer, seq):
+        self.writer = writer
+        self.seq = seq
+        self.events = {}
+        # Reader side events, by (pid, reader).
+        self.readers = collections.defaultdict(dict)
+
+    def first(self, name, timestamp, events=None):
+        events = self.events if events is None else events
+        if name not in events:
+            events[name] = timestamp
+
+
+def parse(trace):
+    samples = {}
+    pending_write = {}
+    last_message = {}
+    last_datagram = {}
+    # Received DATA submessages, by (pid, writer, seq), waiting to be attributed to their readers.
+    received = {}
+
+    def sample(writer, seq):
+        key = (writer, seq)
+        if key not in samples:
+            samples[key] = Sample(writer, seq)
+        return samples[key]
+
+    for line in trace:
+        fields = line.split()
+        if len(fields) < 4 or fields[3] not in PROBES:
+            continue
+        try:
+            timestamp, pid, tid = int(fields[0]), int(fields[1]), int(fields[2])
+        except ValueError:
+            continue
+        probe, args = fields[3], fields[4:]
+
+        if probe == "write_begin":
+            pending_write[tid] = timestamp
+        elif probe == "write_end":
+            begin = pending_write.pop(tid, None)
+            seq = int(args[2])
+            if seq == 0:
+                # The sample was not written.
+                continue
+            s = sample(guid(args[0], args[1]), seq)
+            if begin is not None:
+                s.first("write_begin", begin)
+            s.first("write_end", timestamp)
+        elif probe == "message_send":
+            writer, first, last = guid(args[0], args[1]), int(args[2]), int(args[3])
+            seqs = []
+            if first != 0:
+                for seq in range(first, last + 1):
+                    sample(writer, seq).first("message_send", timestamp)
+                    seqs.append(seq)
+            last_message[tid] = (writer, seqs)
+        elif probe == "udp_send":
+            writer, seqs = last_message.get(tid, (None, []))
+            for seq in seqs:
+                samples[(writer, seq)].first("udp_send", timestamp)
+        elif probe == "udp_receive":
+            last_datagram[(pid, tid)] = timestamp
+        elif probe == "data_received":
+            key = (pid, guid(args[0], args[1]), int(args[2]))
+            if key not in received:
+                received[key] = (last_datagram.get((pid, tid)), timestamp)
+        else:
+            reader, writer, seq = guid(args[0], args[1]), guid(args[2], args[3]), int(args[4])
+            s = sample(writer, seq)
+            events = s.readers[(pid, reader)]
+            if "data_received" not in events and (pid, writer, seq) in received:
+                datagram, data = received[(pid, writer, seq)]
+                if datagram is not None:
+                    events["udp_receive"] = datagram
+                events["data_received"] = data
+            s.first(probe, timestamp, events)
+
+    return samples
+
+
+def breakdown(sample, reader_events):
+    events = dict(sample.events)
+    events.update(reader_events)
+    row = collections.OrderedDict()
+    previous = events.get("write_begin")
+    for stage, name in STAGES:
+        timestamp = events.get(name)
+        row[stage] = timestamp - previous if timestamp is not None and previous is not None else None
+        if timestamp is not None:
+            previous = timestamp
+    row["callback"] = (events["listener_end"] - events["listener_begin"]
+            if "listener_end" in events and "listener_begin" in events else None)
+    row["write_call"] = (events["write_end"] - events["write_begin"]
+            if "write_end" in events and "write_begin" in events else None)
+    row["total"] = (events["listener_begin"] - events["write_begin"]
+            if "listener_begin" in events and "write_begin" in events else None)
+    return row
+
+
+def percentile(values, p):
+    index = min(len(values) - 1, int(round(p * (len(values) - 1))))
+    return values[index]
+
+
+def analyze(trace_file, csv_file):
+    with open(trace_file) as trace:
+        samples = parse(trace)
+
+    rows = []
+    for key in sorted(samples):
+        s = samples[key]
+        for (pid, reader) in sorted(s.readers):
+            row = collections.OrderedDict([("writer", s.writer), ("seq", s.seq), ("pid", pid), ("reader", reader)])
+            row.update(breakdown(s, s.readers[(pid, reader)]))
+            rows.append(row)
+
+    if not rows:
+        print("No sample was delivered to a subscriber in the trace")
+        return 1
+
+    columns = [c for c in rows[0].keys() if c not in ("writer", "seq", "pid", "reader")]
+
+    if csv_file:
+        with open(csv_file, "w") as output:
+            writer = csv.writer(output)
+            writer.writerow(list(rows[0].keys()))
+            for row in rows:
+                writer.writerow(["" if v is None else v for v in row.values()])
+
+    print("%d samples delivered (times in microseconds)" % len(rows))
+    print("%-12s %8s %10s %10s %10s %10s %10s" % ("stage", "count", "min", "mean", "p50", "p99", "max"))
+    for column in columns:
+        values = sorted(row[column] for row in rows if row[column] is not None)
+        if not values:
+            continue
+        print("%-12s %8d %10.2f %10.2f %10.2f %10.2f %10.2f" % (column, len(values), values[0] / 1e3,
+            sum(values) / len(values) / 1e3, percentile(values, 0.5) / 1e3, percentile(values, 0.99) / 1e3,
+            values[-1] / 1e3))
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Per-sample latency breakdown from Fast RTPS tracepoints")
+    subparsers = parser.add_subparsers(dest="command")
+    program = subparsers.add_parser("bpftrace", help="print the bpftrace program recording the tracepoints")
+    program.add_argument("library", help="path of the fastrtps library built with TRACEPOINTS")
+    report = subparsers.add_parser("analyze", help="reconstruct the latency of each sample from a trace")
+    report.add_argument("trace", help="trace file recorded with the bpftrace program")
+    report.add_argument("--csv", help="write the breakdown of each sample to this file")
+    args = parser.parse_args()
+
+    if args.command == "bpftrace":
+        sys.stdout.write(bpftrace_program(args.library))
+        return 0
+    elif args.command == "analyze":
+        return analyze(args.trace, args.csv)
+
+    parser.print_help()
+    return 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())